@@ -67,6 +67,23 @@ struct EnumTraits<compute::QuantileOptions::Interpolation>
     return "<INVALID>";
   }
 };
+
+template <>
+struct EnumTraits<compute::PivotWiderOptions::UnexpectedKeyBehavior>
+    : BasicEnumTraits<compute::PivotWiderOptions::UnexpectedKeyBehavior,
+                      compute::PivotWiderOptions::kIgnore,
+                      compute::PivotWiderOptions::kRaise> {
+  static std::string name() { return "PivotWiderOptions::UnexpectedKeyBehavior"; }
+  static std::string value_name(compute::PivotWiderOptions::UnexpectedKeyBehavior value) {
+    switch (value) {
+      case compute::PivotWiderOptions::kIgnore:
+        return "IGNORE";
+      case compute::PivotWiderOptions::kRaise:
+        return "RAISE";
+    }
+    return "<INVALID>";
+  }
+};
 }  // namespace internal
 
 namespace compute {
@@ -84,6 +101,10 @@ static auto kScalarAggregateOptionsType = GetFunctionOptionsType<ScalarAggregate
     DataMember("min_count", &ScalarAggregateOptions::min_count));
 static auto kCountOptionsType =
     GetFunctionOptionsType<CountOptions>(DataMember("mode", &CountOptions::mode));
+static auto kApproxCountDistinctOptionsType =
+    GetFunctionOptionsType<ApproxCountDistinctOptions>(
+        DataMember("mode", &ApproxCountDistinctOptions::mode),
+        DataMember("precision", &ApproxCountDistinctOptions::precision));
 static auto kModeOptionsType = GetFunctionOptionsType<ModeOptions>(
     DataMember("n", &ModeOptions::n), DataMember("skip_nulls", &ModeOptions::skip_nulls),
     DataMember("min_count", &ModeOptions::min_count));
@@ -101,6 +122,13 @@ static auto kTDigestOptionsType = GetFunctionOptionsType<TDigestOptions>(
     DataMember("buffer_size", &TDigestOptions::buffer_size),
     DataMember("skip_nulls", &TDigestOptions::skip_nulls),
     DataMember("min_count", &TDigestOptions::min_count));
+static auto kKllQuantileOptionsType = GetFunctionOptionsType<KllQuantileOptions>(
+    DataMember("q", &KllQuantileOptions::q), DataMember("k", &KllQuantileOptions::k),
+    DataMember("skip_nulls", &KllQuantileOptions::skip_nulls),
+    DataMember("min_count", &KllQuantileOptions::min_count));
+static auto kPivotWiderOptionsType = GetFunctionOptionsType<PivotWiderOptions>(
+    DataMember("key_names", &PivotWiderOptions::key_names),
+    DataMember("unexpected_key_behavior", &PivotWiderOptions::unexpected_key_behavior));
 static auto kIndexOptionsType =
     GetFunctionOptionsType<IndexOptions>(DataMember("value", &IndexOptions::value));
 }  // namespace
@@ -116,6 +144,13 @@ CountOptions::CountOptions(CountMode mode)
     : FunctionOptions(internal::kCountOptionsType), mode(mode) {}
 constexpr char CountOptions::kTypeName[];
 
+ApproxCountDistinctOptions::ApproxCountDistinctOptions(CountOptions::CountMode mode,
+                                                       int32_t precision)
+    : FunctionOptions(internal::kApproxCountDistinctOptionsType),
+      mode(mode),
+      precision(precision) {}
+constexpr char ApproxCountDistinctOptions::kTypeName[];
+
 ModeOptions::ModeOptions(int64_t n, bool skip_nulls, uint32_t min_count)
     : FunctionOptions(internal::kModeOptionsType),
       n{n},
@@ -164,6 +199,31 @@ TDigestOptions::TDigestOptions(std::vector<double> q, uint32_t delta,
       min_count{min_count} {}
 constexpr char TDigestOptions::kTypeName[];
 
+KllQuantileOptions::KllQuantileOptions(double q, uint32_t k, bool skip_nulls,
+                                       uint32_t min_count)
+    : FunctionOptions(internal::kKllQuantileOptionsType),
+      q{q},
+      k{k},
+      skip_nulls{skip_nulls},
+      min_count{min_count} {}
+KllQuantileOptions::KllQuantileOptions(std::vector<double> q, uint32_t k, bool skip_nulls,
+                                       uint32_t min_count)
+    : FunctionOptions(internal::kKllQuantileOptionsType),
+      q{std::move(q)},
+      k{k},
+      skip_nulls{skip_nulls},
+      min_count{min_count} {}
+constexpr char KllQuantileOptions::kTypeName[];
+
+PivotWiderOptions::PivotWiderOptions(std::vector<std::string> key_names,
+                                     UnexpectedKeyBehavior unexpected_key_behavior)
+    : FunctionOptions(internal::kPivotWiderOptionsType),
+      key_names(std::move(key_names)),
+      unexpected_key_behavior(unexpected_key_behavior) {}
+PivotWiderOptions::PivotWiderOptions()
+    : PivotWiderOptions(std::vector<std::string>{}) {}
+constexpr char PivotWiderOptions::kTypeName[];
+
 IndexOptions::IndexOptions(std::shared_ptr<Scalar> value)
     : FunctionOptions(internal::kIndexOptionsType), value{std::move(value)} {}
 IndexOptions::IndexOptions() : IndexOptions(std::make_shared<NullScalar>()) {}
@@ -173,10 +233,13 @@ namespace internal {
 void RegisterAggregateOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kScalarAggregateOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kCountOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kApproxCountDistinctOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kModeOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kVarianceOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kQuantileOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kTDigestOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kKllQuantileOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kPivotWiderOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kIndexOptionsType));
 }
 }  // namespace internal
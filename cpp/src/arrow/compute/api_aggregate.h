@@ -78,6 +78,25 @@ class ARROW_EXPORT CountOptions : public FunctionOptions {
   CountMode mode;
 };
 
+/// \brief Control approximate distinct count aggregate kernel behavior.
+///
+/// By default, only non-null values are counted, and sketches use a precision
+/// of 14 (16384 registers, about 0.8% relative standard error).
+class ARROW_EXPORT ApproxCountDistinctOptions : public FunctionOptions {
+ public:
+  explicit ApproxCountDistinctOptions(
+      CountOptions::CountMode mode = CountOptions::CountMode::ONLY_VALID,
+      int32_t precision = 14);
+  static constexpr char const kTypeName[] = "ApproxCountDistinctOptions";
+  static ApproxCountDistinctOptions Defaults() { return ApproxCountDistinctOptions{}; }
+
+  CountOptions::CountMode mode;
+  /// Number of bits used to select a HyperLogLog register, between 4 and 18.
+  /// Higher values are more accurate but use more memory (2^precision bytes
+  /// per sketch).
+  int32_t precision;
+};
+
 /// \brief Control Mode kernel behavior
 ///
 /// Returns top-n common values and counts.
@@ -175,6 +194,54 @@ class ARROW_EXPORT TDigestOptions : public FunctionOptions {
   uint32_t min_count;
 };
 
+/// \brief Control KLL approximate quantile kernel behavior
+///
+/// By default, returns the median value.
+class ARROW_EXPORT KllQuantileOptions : public FunctionOptions {
+ public:
+  explicit KllQuantileOptions(double q = 0.5, uint32_t k = 200, bool skip_nulls = true,
+                              uint32_t min_count = 0);
+  explicit KllQuantileOptions(std::vector<double> q, uint32_t k = 200,
+                              bool skip_nulls = true, uint32_t min_count = 0);
+  static constexpr char const kTypeName[] = "KllQuantileOptions";
+  static KllQuantileOptions Defaults() { return KllQuantileOptions{}; }
+
+  /// quantile must be between 0 and 1 inclusive
+  std::vector<double> q;
+  /// accuracy parameter, the normalized rank error is about 1.7 / k, default 200
+  uint32_t k;
+  /// If true (the default), null values are ignored. Otherwise, if any value is null,
+  /// emit null.
+  bool skip_nulls;
+  /// If less than this many non-null values are observed, emit null.
+  uint32_t min_count;
+};
+
+/// \brief Control Pivot kernel behavior
+///
+/// The values are pivoted into one output column per key name, in the order
+/// of key_names.
+class ARROW_EXPORT PivotWiderOptions : public FunctionOptions {
+ public:
+  enum UnexpectedKeyBehavior {
+    /// Rows whose key name is not in key_names are ignored.
+    kIgnore = 0,
+    /// Error out on a key name which is not in key_names.
+    kRaise,
+  };
+
+  explicit PivotWiderOptions(std::vector<std::string> key_names,
+                             UnexpectedKeyBehavior unexpected_key_behavior = kIgnore);
+  // Default constructor for serialization
+  PivotWiderOptions();
+  static constexpr char const kTypeName[] = "PivotWiderOptions";
+
+  /// The key names to pivot on, each one becomes an output column
+  std::vector<std::string> key_names;
+  /// What to do with key names which are not in key_names
+  UnexpectedKeyBehavior unexpected_key_behavior;
+};
+
 /// \brief Control Index kernel behavior
 class ARROW_EXPORT IndexOptions : public FunctionOptions {
  public:
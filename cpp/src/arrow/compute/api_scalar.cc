@@ -311,6 +311,9 @@ static auto kMakeStructOptionsType = GetFunctionOptionsType<MakeStructOptions>(
 static auto kMapLookupOptionsType = GetFunctionOptionsType<MapLookupOptions>(
     DataMember("occurrence", &MapLookupOptions::occurrence),
     DataMember("query_key", &MapLookupOptions::query_key));
+static auto kMatchAnyRegexOptionsType = GetFunctionOptionsType<MatchAnyRegexOptions>(
+    DataMember("patterns", &MatchAnyRegexOptions::patterns),
+    DataMember("ignore_case", &MatchAnyRegexOptions::ignore_case));
 static auto kMatchSubstringOptionsType = GetFunctionOptionsType<MatchSubstringOptions>(
     DataMember("pattern", &MatchSubstringOptions::pattern),
     DataMember("ignore_case", &MatchSubstringOptions::ignore_case));
@@ -444,6 +447,14 @@ MapLookupOptions::MapLookupOptions()
     : MapLookupOptions(std::make_shared<NullScalar>(), Occurrence::FIRST) {}
 constexpr char MapLookupOptions::kTypeName[];
 
+MatchAnyRegexOptions::MatchAnyRegexOptions(std::vector<std::string> patterns,
+                                           bool ignore_case)
+    : FunctionOptions(internal::kMatchAnyRegexOptionsType),
+      patterns(std::move(patterns)),
+      ignore_case(ignore_case) {}
+MatchAnyRegexOptions::MatchAnyRegexOptions() : MatchAnyRegexOptions({}, false) {}
+constexpr char MatchAnyRegexOptions::kTypeName[];
+
 MatchSubstringOptions::MatchSubstringOptions(std::string pattern, bool ignore_case)
     : FunctionOptions(internal::kMatchSubstringOptionsType),
       pattern(std::move(pattern)),
@@ -640,6 +651,7 @@ void RegisterScalarOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kListSliceOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMakeStructOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMapLookupOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kMatchAnyRegexOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMatchSubstringOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kNullOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kPadOptionsType));
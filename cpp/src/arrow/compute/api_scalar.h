@@ -200,6 +200,19 @@ class ARROW_EXPORT MatchSubstringOptions : public FunctionOptions {
   bool ignore_case;
 };
 
+class ARROW_EXPORT MatchAnyRegexOptions : public FunctionOptions {
+ public:
+  explicit MatchAnyRegexOptions(std::vector<std::string> patterns,
+                                bool ignore_case = false);
+  MatchAnyRegexOptions();
+  static constexpr char const kTypeName[] = "MatchAnyRegexOptions";
+
+  /// The regexes to match input values against.
+  std::vector<std::string> patterns;
+  /// Whether to perform a case-insensitive match.
+  bool ignore_case;
+};
+
 class ARROW_EXPORT SplitOptions : public FunctionOptions {
  public:
   explicit SplitOptions(int64_t max_splits = -1, bool reverse = false);
@@ -682,6 +682,15 @@ std::shared_ptr<ChunkedArray> ToChunkedArray(const std::vector<Datum>& values,
       // Skip empty chunks
       continue;
     }
+    if (val.is_chunked_array()) {
+      // e.g. the result of VectorKernel::exec_chunked
+      for (const auto& chunk : val.chunked_array()->chunks()) {
+        if (chunk->length() > 0) {
+          arrays.push_back(chunk);
+        }
+      }
+      continue;
+    }
     arrays.emplace_back(val.make_array());
   }
   return std::make_shared<ChunkedArray>(std::move(arrays), type.GetSharedPtr());
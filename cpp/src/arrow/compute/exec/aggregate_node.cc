@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <map>
 #include <mutex>
 #include <sstream>
 #include <thread>
@@ -27,6 +29,7 @@
 #include "arrow/compute/exec/query_context.h"
 #include "arrow/compute/exec/util.h"
 #include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/row/grouper.h"
 #include "arrow/datum.h"
@@ -70,6 +73,56 @@ void AggregatesToString(std::stringstream* ss, const Schema& input_schema,
   *ss << ']';
 }
 
+// Aggregates of the same column computed together in a single pass over each batch
+struct FusedAggregates {
+  int field;
+  std::vector<size_t> aggregates;
+  // One per thread
+  std::vector<std::unique_ptr<internal::FusedAggregator>> fused;
+};
+
+// Group the aggregates whose kernels support fusing (count, sum, mean, min, max
+// and min_max) by target column, so that each column is scanned once per batch
+// rather than once per aggregate
+Result<std::vector<FusedAggregates>> FuseAggregates(
+    const Schema& input_schema, const std::vector<std::vector<int>>& target_fieldsets,
+    const std::vector<std::vector<std::unique_ptr<KernelState>>>& states) {
+  std::map<int, std::vector<size_t>> candidates;
+  for (size_t i = 0; i < target_fieldsets.size(); ++i) {
+    if (target_fieldsets[i].size() != 1) continue;
+    const bool fusable = std::all_of(
+        states[i].begin(), states[i].end(), [](const std::unique_ptr<KernelState>& state) {
+          return dynamic_cast<internal::FusableAggregator*>(state.get()) != nullptr;
+        });
+    if (fusable) {
+      candidates[target_fieldsets[i][0]].push_back(i);
+    }
+  }
+
+  std::vector<FusedAggregates> groups;
+  for (auto& candidate : candidates) {
+    const auto& aggregates = candidate.second;
+    if (aggregates.size() < 2) continue;
+    FusedAggregates group{candidate.first, aggregates, {}};
+    const auto& type = *input_schema.field(group.field)->type();
+    const size_t num_threads = states[aggregates[0]].size();
+    for (size_t thread_index = 0; thread_index < num_threads; ++thread_index) {
+      std::vector<KernelState*> thread_states;
+      for (size_t i : aggregates) {
+        thread_states.push_back(states[i][thread_index].get());
+      }
+      ARROW_ASSIGN_OR_RAISE(auto fused,
+                            internal::MakeFusedAggregator(type, thread_states));
+      if (fused == nullptr) break;
+      group.fused.push_back(std::move(fused));
+    }
+    if (group.fused.size() == num_threads) {
+      groups.push_back(std::move(group));
+    }
+  }
+  return groups;
+}
+
 class ScalarAggregateNode : public ExecNode, public TracedNode {
  public:
   ScalarAggregateNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
@@ -77,14 +130,23 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
                       std::vector<std::vector<int>> target_fieldsets,
                       std::vector<Aggregate> aggs,
                       std::vector<const ScalarAggregateKernel*> kernels,
-                      std::vector<std::vector<std::unique_ptr<KernelState>>> states)
+                      std::vector<std::vector<std::unique_ptr<KernelState>>> states,
+                      std::vector<FusedAggregates> fused)
       : ExecNode(plan, std::move(inputs), {"target"},
                  /*output_schema=*/std::move(output_schema)),
         TracedNode(this),
         target_fieldsets_(std::move(target_fieldsets)),
         aggs_(std::move(aggs)),
         kernels_(std::move(kernels)),
-        states_(std::move(states)) {}
+        states_(std::move(states)),
+        fused_(std::move(fused)),
+        is_fused_(kernels_.size(), false) {
+    for (const auto& group : fused_) {
+      for (size_t i : group.aggregates) {
+        is_fused_[i] = true;
+      }
+    }
+  }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -145,15 +207,28 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
       fields[i] = field(aggregate_options.aggregates[i].name, out_type.GetSharedPtr());
     }
 
+    ARROW_ASSIGN_OR_RAISE(auto fused,
+                          FuseAggregates(input_schema, target_fieldsets, states));
+
     return plan->EmplaceNode<ScalarAggregateNode>(
         plan, std::move(inputs), schema(std::move(fields)), std::move(target_fieldsets),
-        std::move(aggregates), std::move(kernels), std::move(states));
+        std::move(aggregates), std::move(kernels), std::move(states), std::move(fused));
   }
 
   const char* kind_name() const override { return "ScalarAggregateNode"; }
 
   Status DoConsume(const ExecSpan& batch, size_t thread_index) {
+    for (const auto& group : fused_) {
+      const ExecValue& values = batch.values[group.field];
+      if (values.is_array()) {
+        RETURN_NOT_OK(group.fused[thread_index]->Consume(values.array));
+      }
+    }
     for (size_t i = 0; i < kernels_.size(); ++i) {
+      if (is_fused_[i] && batch.values[target_fieldsets_[i][0]].is_array()) {
+        // Already consumed above
+        continue;
+      }
       util::tracing::Span span;
       START_COMPUTE_SPAN(span, aggs_[i].function,
                          {{"function.name", aggs_[i].function},
@@ -217,6 +292,14 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
     std::stringstream ss;
     const auto input_schema = inputs_[0]->output_schema();
     AggregatesToString(&ss, *input_schema, aggs_, target_fieldsets_);
+    if (!fused_.empty()) {
+      ss << ", fused=[";
+      for (size_t i = 0; i < fused_.size(); ++i) {
+        if (i > 0) ss << ", ";
+        ss << input_schema->field(fused_[i].field)->name();
+      }
+      ss << ']';
+    }
     return ss.str();
   }
 
@@ -247,6 +330,9 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
   const std::vector<const ScalarAggregateKernel*> kernels_;
 
   std::vector<std::vector<std::unique_ptr<KernelState>>> states_;
+  // The fused aggregators update states_ directly
+  const std::vector<FusedAggregates> fused_;
+  std::vector<bool> is_fused_;
 
   AtomicCounter input_counter_;
 };
@@ -0,0 +1,225 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <sstream>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/accumulation_queue.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/query_context.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace {
+
+// A cumulative function applied to a column, along with the kernel state carrying
+// its running value from one batch to the next
+struct CumulativeColumn {
+  CumulativeColumn(ExecContext* exec_ctx, const VectorKernel* kernel)
+      : kernel(kernel), kernel_ctx(exec_ctx, kernel) {}
+
+  int target;
+  const VectorKernel* kernel;
+  KernelContext kernel_ctx;
+  std::unique_ptr<KernelState> state;
+};
+
+class CumulativeNode : public ExecNode,
+                       public TracedNode,
+                       util::SerialSequencingQueue::Processor {
+ public:
+  CumulativeNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                 std::shared_ptr<Schema> output_schema,
+                 std::vector<std::unique_ptr<CumulativeColumn>> columns)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        columns_(std::move(columns)),
+        sequencing_queue_(util::SerialSequencingQueue::Make(this)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "CumulativeNode"));
+
+    const auto& cumulative_options = checked_cast<const CumulativeNodeOptions&>(options);
+    const auto& input_schema = inputs[0]->output_schema();
+    ExecContext* exec_ctx = plan->query_context()->exec_context();
+
+    FieldVector fields = input_schema->fields();
+    std::vector<std::unique_ptr<CumulativeColumn>> columns;
+    for (const auto& cumulative : cumulative_options.cumulatives) {
+      if (!::arrow::internal::StartsWith(cumulative.function, "cumulative_")) {
+        return Status::Invalid("CumulativeNode only supports cumulative functions, got '",
+                               cumulative.function, "'");
+      }
+      if (cumulative.target.size() != 1) {
+        return Status::Invalid("Cumulative function '", cumulative.function,
+                               "' must have exactly one target");
+      }
+      ARROW_ASSIGN_OR_RAISE(auto match, cumulative.target[0].FindOne(*input_schema));
+      if (match.indices().size() != 1) {
+        return Status::NotImplemented("Cumulative function '", cumulative.function,
+                                      "' on nested field ",
+                                      cumulative.target[0].ToString());
+      }
+      const int target = match[0];
+      const auto& type = input_schema->field(target)->type();
+
+      ARROW_ASSIGN_OR_RAISE(auto function,
+                            exec_ctx->func_registry()->GetFunction(cumulative.function));
+      if (function->kind() != Function::VECTOR) {
+        return Status::Invalid("Cumulative function '", cumulative.function,
+                               "' is not a vector function");
+      }
+      ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, function->DispatchExact({type}));
+
+      const FunctionOptions* function_options = cumulative.options
+                                                    ? cumulative.options.get()
+                                                    : function->default_options();
+      const FunctionOptions* default_options = function->default_options();
+      if (function_options && default_options &&
+          function_options->options_type() != default_options->options_type()) {
+        return Status::TypeError("Cumulative function '", cumulative.function,
+                                 "' expects options of type ",
+                                 default_options->type_name(), " but got ",
+                                 function_options->type_name());
+      }
+
+      auto column = std::make_unique<CumulativeColumn>(
+          exec_ctx, static_cast<const VectorKernel*>(kernel));
+      column->target = target;
+      if (kernel->init) {
+        ARROW_ASSIGN_OR_RAISE(
+            column->state,
+            kernel->init(&column->kernel_ctx, {kernel, {type}, function_options}));
+        column->kernel_ctx.SetState(column->state.get());
+      }
+      ARROW_ASSIGN_OR_RAISE(auto out_type,
+                            kernel->signature->out_type().Resolve(&column->kernel_ctx,
+                                                                  {type}));
+      fields.push_back(field(cumulative.name.empty() ? cumulative.function
+                                                       : cumulative.name,
+                             out_type.GetSharedPtr()));
+      columns.push_back(std::move(column));
+    }
+
+    return plan->EmplaceNode<CumulativeNode>(
+        plan, std::move(inputs), schema(std::move(fields), input_schema->metadata()),
+        std::move(columns));
+  }
+
+  const char* kind_name() const override { return "CumulativeNode"; }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    // Each input batch produces exactly one output batch
+    return output_->InputFinished(this, total_batches);
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+    if (batch.index == kUnsequencedIndex) {
+      return Status::Invalid("CumulativeNode requires its input to be sequenced");
+    }
+    return sequencing_queue_->InsertBatch(std::move(batch));
+  }
+
+  // Called on each batch in order, never concurrently
+  Status Process(ExecBatch batch) override {
+    const int64_t length = batch.length;
+    for (const auto& column : columns_) {
+      const Datum& value = batch.values[column->target];
+      std::shared_ptr<ArrayData> values;
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(auto array,
+                              MakeArrayFromScalar(*value.scalar(), length,
+                                                  plan_->query_context()->memory_pool()));
+        values = array->data();
+      } else {
+        values = value.array();
+      }
+      const ExecBatch input({std::move(values)}, length);
+      const ExecSpan span(input);
+      ExecResult out;
+      RETURN_NOT_OK(column->kernel->exec(&column->kernel_ctx, span, &out));
+      batch.values.emplace_back(out.array_data());
+    }
+    return output_->InputReceived(this, std::move(batch));
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "cumulatives=[";
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << output_schema_->field(inputs_[0]->output_schema()->num_fields() +
+                                  static_cast<int>(i))
+                ->name();
+    }
+    ss << ']';
+    return ss.str();
+  }
+
+ private:
+  std::vector<std::unique_ptr<CumulativeColumn>> columns_;
+  std::unique_ptr<util::SerialSequencingQueue> sequencing_queue_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterCumulativeNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(CumulativeNodeOptions::kName),
+                                 CumulativeNode::Make));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
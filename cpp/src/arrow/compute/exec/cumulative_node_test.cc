@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/compute/exec/options.h"
+#include "arrow/compute/exec/test_nodes.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+static constexpr int kRowsPerBatch = 16;
+static constexpr int kNumBatches = 32;
+
+std::shared_ptr<Table> TestTable() {
+  auto rand = random::RandomArrayGenerator(0x1234);
+  const int64_t length = kRowsPerBatch * kNumBatches;
+  auto schema = arrow::schema({field("i", int32()), field("f", float64())});
+  return Table::Make(schema,
+                     {rand.Int32(length, -100, 100, /*null_probability=*/0.05),
+                      rand.Float64(length, 0, 10, /*null_probability=*/0.05)});
+}
+
+// The node should produce the same result as the vector function applied to
+// the whole column
+void AssertCumulativeColumn(const ChunkedArray& actual, const std::string& function,
+                            const std::shared_ptr<ChunkedArray>& input,
+                            const FunctionOptions* options) {
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(function, {input}, options));
+  ASSERT_OK_AND_ASSIGN(auto actual_array, Concatenate(actual.chunks()));
+  ASSERT_OK_AND_ASSIGN(auto expected_array,
+                       Concatenate(expected.chunked_array()->chunks()));
+  AssertArraysEqual(*expected_array, *actual_array, /*verbose=*/true);
+}
+
+TEST(CumulativeNode, Basic) {
+  constexpr random::SeedType kSeed = 42;
+  constexpr int kJitterMod = 4;
+  RegisterTestNodes();
+  std::shared_ptr<Table> input = TestTable();
+
+  auto sum_options = std::make_shared<CumulativeSumOptions>(0, /*skip_nulls=*/true);
+  auto skip_nulls = std::make_shared<CumulativeOptions>(std::nullopt, true);
+  std::vector<Aggregate> cumulatives = {
+      {"cumulative_sum", sum_options, "i", "sum_i"},
+      {"cumulative_max", nullptr, "i", "max_i"},
+      {"cumulative_min", skip_nulls, "f", "min_f"},
+      {"cumulative_mean", skip_nulls, "f", "mean_f"},
+      {"cumulative_prod", skip_nulls, "f", "prod_f"}};
+
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(input, kRowsPerBatch)},
+       {"jitter", JitterNodeOptions(kSeed, kJitterMod)},
+       {"cumulative", CumulativeNodeOptions(cumulatives)}});
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads = ", use_threads);
+    QueryOptions query_options;
+    query_options.sequence_output = true;
+    query_options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         DeclarationToTable(plan, query_options));
+
+    ASSERT_EQ(actual->num_columns(), 7);
+    ASSERT_EQ(actual->num_rows(), input->num_rows());
+    AssertChunkedEqual(*input->column(0), *actual->column(0));
+    AssertChunkedEqual(*input->column(1), *actual->column(1));
+    for (size_t i = 0; i < cumulatives.size(); ++i) {
+      const auto& cumulative = cumulatives[i];
+      ARROW_SCOPED_TRACE("cumulative = ", cumulative.name);
+      ASSERT_EQ(actual->schema()->field(2 + static_cast<int>(i))->name(),
+                cumulative.name);
+      AssertCumulativeColumn(*actual->column(2 + static_cast<int>(i)),
+                             cumulative.function,
+                             input->GetColumnByName(*cumulative.target[0].name()),
+                             cumulative.options.get());
+    }
+  }
+}
+
+TEST(CumulativeNode, Invalid) {
+  std::shared_ptr<Table> input = TestTable();
+  auto check_invalid = [&](Aggregate cumulative, StatusCode code,
+                           const std::string& message) {
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(input)},
+         {"cumulative", CumulativeNodeOptions({std::move(cumulative)})}});
+    Status st = DeclarationToStatus(std::move(plan));
+    ASSERT_EQ(st.code(), code) << st.ToString();
+    ASSERT_THAT(st.message(), testing::HasSubstr(message));
+  };
+
+  check_invalid({"sum", nullptr, "i", "sum_i"}, StatusCode::Invalid,
+                "only supports cumulative functions");
+  check_invalid({"cumulative_sum", nullptr, "missing", "sum"}, StatusCode::Invalid,
+                "No match for FieldRef");
+  check_invalid({"cumulative_max", std::make_shared<CumulativeSumOptions>(), "i", "max"},
+                StatusCode::TypeError, "expects options of type CumulativeOptions");
+}
+
+}  // namespace compute
+}  // namespace arrow
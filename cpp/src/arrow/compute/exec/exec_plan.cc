@@ -968,6 +968,7 @@ void RegisterFilterNode(ExecFactoryRegistry*);
 void RegisterProjectNode(ExecFactoryRegistry*);
 void RegisterUnionNode(ExecFactoryRegistry*);
 void RegisterAggregateNode(ExecFactoryRegistry*);
+void RegisterCumulativeNode(ExecFactoryRegistry*);
 void RegisterSinkNode(ExecFactoryRegistry*);
 void RegisterHashJoinNode(ExecFactoryRegistry*);
 void RegisterAsofJoinNode(ExecFactoryRegistry*);
@@ -984,6 +985,7 @@ ExecFactoryRegistry* default_exec_factory_registry() {
       internal::RegisterProjectNode(this);
       internal::RegisterUnionNode(this);
       internal::RegisterAggregateNode(this);
+      internal::RegisterCumulativeNode(this);
       internal::RegisterSinkNode(this);
       internal::RegisterHashJoinNode(this);
       internal::RegisterAsofJoinNode(this);
@@ -31,6 +31,7 @@
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/hash_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
@@ -706,6 +707,480 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full
   return ExecuteScalarExpression(expr, input, exec_context);
 }
 
+namespace {
+
+// if_else, case_when and coalesce pick each output row from one of their value
+// arguments. Rather than evaluating every value argument over the whole batch, each
+// one is evaluated only over the rows it may be picked for, which saves the work
+// (and the errors) of expensive branches for the rows which don't need them.
+bool IsShortCircuitable(const Expression::Call& call, const ExecBatch& input) {
+  if (input.length == 0 ||
+      (call.function_name != "if_else" && call.function_name != "case_when" &&
+       call.function_name != "coalesce")) {
+    return false;
+  }
+  // The first argument is always evaluated over the whole batch (it is the condition
+  // of if_else and case_when), there is nothing to save for literals and field refs.
+  return std::any_of(call.arguments.begin() + 1, call.arguments.end(),
+                     [](const Expression& arg) { return arg.call() != nullptr; });
+}
+
+void MarkReferencedColumns(const Expression& expr, std::vector<bool>* referenced) {
+  if (auto param = expr.parameter()) {
+    if (!param->indices.empty()) {
+      (*referenced)[param->indices[0]] = true;
+    }
+  } else if (auto call = expr.call()) {
+    for (const Expression& arg : call->arguments) {
+      MarkReferencedColumns(arg, referenced);
+    }
+  }
+}
+
+// Evaluate `expr` only over the rows of `input` selected by `selection`, a boolean
+// datum without nulls. The result is spread back to the rows of `input`, the rows
+// which were not selected are null. Field refs and literals cost nothing to
+// evaluate, so they are evaluated directly and their unselected rows are kept.
+Result<Datum> ExecuteOverSelection(const Expression& expr, const ExecBatch& input,
+                                   const Datum& selection,
+                                   compute::ExecContext* exec_context) {
+  if (expr.call() == nullptr) {
+    return ExecuteScalarExpression(expr, input, exec_context);
+  }
+  int64_t num_selected;
+  if (selection.is_scalar()) {
+    num_selected = selection.scalar_as<BooleanScalar>().value ? input.length : 0;
+  } else {
+    num_selected = selection.array_as<BooleanArray>()->true_count();
+  }
+  if (num_selected == input.length) {
+    return ExecuteScalarExpression(expr, input, exec_context);
+  }
+  if (num_selected == 0) {
+    return MakeNullScalar(expr.type()->GetSharedPtr());
+  }
+
+  // Only the columns referenced by the expression need to be filtered
+  std::vector<bool> referenced(input.values.size(), false);
+  MarkReferencedColumns(expr, &referenced);
+  ExecBatch selected;
+  selected.length = num_selected;
+  selected.guarantee = input.guarantee;
+  selected.values.resize(input.values.size());
+  for (size_t i = 0; i < input.values.size(); ++i) {
+    if (!referenced[i]) {
+      selected.values[i] = MakeNullScalar(input.values[i].type());
+    } else if (input.values[i].is_scalar()) {
+      selected.values[i] = input.values[i];
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          selected.values[i],
+          Filter(input.values[i], selection, FilterOptions::Defaults(), exec_context));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        ExecuteScalarExpression(expr, selected, exec_context));
+  if (result.is_scalar()) {
+    return result;
+  }
+
+  // Take the i-th result for the i-th selected row, and null for the other rows
+  const auto& mask = *selection.array_as<BooleanArray>();
+  ARROW_ASSIGN_OR_RAISE(
+      auto validity, arrow::internal::CopyBitmap(exec_context->memory_pool(),
+                                                 mask.values()->data(), mask.offset(),
+                                                 input.length));
+  ARROW_ASSIGN_OR_RAISE(auto positions,
+                        AllocateBuffer(input.length * sizeof(int64_t),
+                                       exec_context->memory_pool()));
+  auto* position = reinterpret_cast<int64_t*>(positions->mutable_data());
+  int64_t next = 0;
+  for (int64_t i = 0; i < input.length; ++i) {
+    position[i] = next;
+    next += mask.Value(i);
+  }
+  auto indices = ArrayData::Make(int64(), input.length,
+                                 {std::move(validity), std::move(positions)},
+                                 input.length - num_selected);
+  return Take(result, indices, TakeOptions::Defaults(), exec_context);
+}
+
+// Rows where `cond` is true (and not null), as a boolean datum without nulls
+Result<Datum> IsTrue(const Datum& cond, compute::ExecContext* exec_context) {
+  ARROW_ASSIGN_OR_RAISE(Datum valid, CallFunction("is_valid", {cond}, exec_context));
+  return CallFunction("and_kleene", {cond, valid}, exec_context);
+}
+
+// Evaluate the arguments of a call to a short-circuitable function, see
+// IsShortCircuitable
+Result<std::vector<Datum>> ExecuteShortCircuitArguments(
+    const Expression::Call& call, const ExecBatch& input,
+    compute::ExecContext* exec_context) {
+  std::vector<Datum> arguments(call.arguments.size());
+  ARROW_ASSIGN_OR_RAISE(arguments[0],
+                        ExecuteScalarExpression(call.arguments[0], input, exec_context));
+
+  if (call.function_name == "if_else") {
+    ARROW_ASSIGN_OR_RAISE(Datum if_true, IsTrue(arguments[0], exec_context));
+    ARROW_ASSIGN_OR_RAISE(Datum inverted,
+                          CallFunction("invert", {arguments[0]}, exec_context));
+    ARROW_ASSIGN_OR_RAISE(Datum if_false, IsTrue(inverted, exec_context));
+    ARROW_ASSIGN_OR_RAISE(arguments[1], ExecuteOverSelection(call.arguments[1], input,
+                                                             if_true, exec_context));
+    ARROW_ASSIGN_OR_RAISE(arguments[2], ExecuteOverSelection(call.arguments[2], input,
+                                                             if_false, exec_context));
+  } else if (call.function_name == "case_when") {
+    // A case is picked for the rows where its condition is the first true one,
+    // the else value (if any) for the rows where no condition is true
+    const int num_conds = arguments[0].type()->num_fields();
+    Datum undecided(true);
+    for (size_t i = 1; i < arguments.size(); ++i) {
+      Datum selection = undecided;
+      if (static_cast<int>(i) <= num_conds) {
+        StructFieldOptions options({static_cast<int>(i) - 1});
+        ARROW_ASSIGN_OR_RAISE(
+            Datum cond, CallFunction("struct_field", {arguments[0]}, &options,
+                                     exec_context));
+        ARROW_ASSIGN_OR_RAISE(cond, IsTrue(cond, exec_context));
+        ARROW_ASSIGN_OR_RAISE(selection,
+                              CallFunction("and", {undecided, cond}, exec_context));
+        ARROW_ASSIGN_OR_RAISE(undecided,
+                              CallFunction("and_not", {undecided, cond}, exec_context));
+      }
+      ARROW_ASSIGN_OR_RAISE(arguments[i], ExecuteOverSelection(call.arguments[i], input,
+                                                               selection, exec_context));
+    }
+  } else {
+    DCHECK_EQ(call.function_name, "coalesce");
+    // A value is picked for the rows where all the previous values are null
+    ARROW_ASSIGN_OR_RAISE(Datum undecided,
+                          CallFunction("is_null", {arguments[0]}, exec_context));
+    for (size_t i = 1; i < arguments.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(arguments[i], ExecuteOverSelection(call.arguments[i], input,
+                                                               undecided, exec_context));
+      if (i + 1 < arguments.size()) {
+        ARROW_ASSIGN_OR_RAISE(Datum is_null,
+                              CallFunction("is_null", {arguments[i]}, exec_context));
+        ARROW_ASSIGN_OR_RAISE(undecided,
+                              CallFunction("and", {undecided, is_null}, exec_context));
+      }
+    }
+  }
+  return arguments;
+}
+
+// Execute the kernel of `call` over its already evaluated arguments
+Result<Datum> ExecuteCall(const Expression::Call& call, std::vector<Datum> arguments,
+                          int64_t length, compute::ExecContext* exec_context) {
+  const bool all_scalar = std::none_of(arguments.begin(), arguments.end(),
+                                       [](const Datum& arg) { return arg.is_array(); });
+
+  auto executor = compute::detail::KernelExecutor::MakeScalar();
+
+  compute::KernelContext kernel_context(exec_context, call.kernel);
+  kernel_context.SetState(call.kernel_state.get());
+
+  const Kernel* kernel = call.kernel;
+  std::vector<TypeHolder> types = GetTypes(arguments);
+  auto options = call.options.get();
+  RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, types, options}));
+
+  compute::detail::DatumAccumulator listener;
+  RETURN_NOT_OK(executor->Execute(
+      ExecBatch(std::move(arguments), all_scalar ? 1 : length), &listener));
+  const auto out = executor->WrapResults(arguments, listener.values());
+#ifndef NDEBUG
+  DCHECK_OK(executor->CheckResultType(out, call.function_name.c_str()));
+#endif
+  return out;
+}
+
+// Chains of elementwise kernels over fixed-width values, such as the arithmetic of
+// `(a * 2 + b) / c - 1`, are executed one cache-sized chunk of rows at a time: each
+// intermediate result only lives in a small scratch vector instead of being
+// materialized over the whole batch.
+constexpr int64_t kFusedChunkLength = util::MiniBatch::kMiniBatchLength;
+
+bool IsFusableType(const DataType* type) {
+  return type != nullptr && is_primitive(type->id()) && type->id() != Type::BOOL;
+}
+
+// Whether a call can be a step of a fused chain: its kernel must write fixed-width
+// values into preallocated slices of its output. Functions which pick each row from
+// one of their arguments are left out, so that their arguments are evaluated
+// through IsShortCircuitable rather than over every row.
+bool IsFusable(const Expression::Call& call) {
+  if (call.function->kind() != Function::SCALAR || call.arguments.empty() ||
+      !IsFusableType(call.type.type)) {
+    return false;
+  }
+  if (call.function_name == "if_else" || call.function_name == "case_when" ||
+      call.function_name == "coalesce" || call.function_name == "choose") {
+    return false;
+  }
+  const auto* kernel = static_cast<const ScalarKernel*>(call.kernel);
+  if (kernel->mem_allocation != MemAllocation::PREALLOCATE ||
+      !kernel->can_write_into_slices ||
+      kernel->null_handling == NullHandling::COMPUTED_NO_PREALLOCATE) {
+    return false;
+  }
+  return std::all_of(call.arguments.begin(), call.arguments.end(),
+                     [](const Expression& arg) { return IsFusableType(arg.type()); });
+}
+
+// Whether `call` and at least one of its arguments can be fused
+bool IsFusableChain(const Expression::Call& call, const ExecBatch& input) {
+  if (input.length == 0 || !IsFusable(call)) {
+    return false;
+  }
+  for (const Datum& value : input.values) {
+    if (value.is_chunked_array()) {
+      return false;
+    }
+  }
+  return std::any_of(call.arguments.begin(), call.arguments.end(),
+                     [](const Expression& arg) {
+                       auto arg_call = arg.call();
+                       return arg_call != nullptr && IsFusable(*arg_call);
+                     });
+}
+
+class FusedExecutor {
+ public:
+  FusedExecutor(const ExecBatch& input, compute::ExecContext* exec_context)
+      : input_(input), exec_context_(exec_context) {}
+
+  // Execute `call` and its fusable arguments, the other arguments are executed
+  // right away. Each argument is evaluated once, even when `call` has nothing to
+  // fuse after all.
+  Result<Datum> Execute(const Expression::Call& call) {
+    Datum value;
+    ARROW_ASSIGN_OR_RAISE(int root, AddStep(call, &value));
+    if (root < 0) {
+      return value;
+    }
+    DCHECK_EQ(root, static_cast<int>(steps_.size()) - 1);
+    if (has_unfusable_value_) {
+      return ExecuteUnfused();
+    }
+    return ExecuteFused();
+  }
+
+ private:
+  Result<Datum> ExecuteFused() {
+    const int64_t length = input_.length;
+    Step& root = steps_.back();
+
+    // The scratch vectors of the intermediate steps
+    int64_t scratch_size = 0;
+    for (size_t i = 0; i + 1 < steps_.size(); ++i) {
+      scratch_size += ScratchSize(steps_[i]);
+    }
+    util::TempVectorStack stack;
+    RETURN_NOT_OK(stack.Init(exec_context_->memory_pool(),
+                             scratch_size + 2 * kScratchAlignment));
+    util::TempVectorHolder<uint8_t> scratch(&stack,
+                                            static_cast<uint32_t>(scratch_size));
+    uint8_t* scratch_data = scratch.mutable_data();
+    for (size_t i = 0; i + 1 < steps_.size(); ++i) {
+      ArraySpan* out = steps_[i].result.array_span_mutable();
+      const bool has_validity = steps_[i].has_validity;
+      const int64_t byte_width = steps_[i].byte_width;
+      out->type = steps_[i].call->type.type;
+      out->offset = 0;
+      out->buffers[0].data = has_validity ? scratch_data : nullptr;
+      out->buffers[0].size = has_validity ? kValiditySize : 0;
+      scratch_data += has_validity ? kValiditySize : 0;
+      out->buffers[1].data = scratch_data;
+      out->buffers[1].size =
+          bit_util::RoundUp(kFusedChunkLength * byte_width, kScratchAlignment);
+      scratch_data += out->buffers[1].size;
+    }
+
+    // The root step writes into slices of the output
+    std::shared_ptr<Buffer> validity;
+    if (root.has_validity) {
+      ARROW_ASSIGN_OR_RAISE(validity,
+                            AllocateBitmap(length, exec_context_->memory_pool()));
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(length * root.byte_width,
+                                         exec_context_->memory_pool()));
+    auto out = ArrayData::Make(root.call->type.GetSharedPtr(), length,
+                               {std::move(validity), std::move(values)},
+                               root.has_validity ? kUnknownNullCount : 0);
+    root.result.array_span_mutable()->SetMembers(*out);
+
+    for (int64_t offset = 0; offset < length; offset += kFusedChunkLength) {
+      const int64_t chunk_length = std::min(kFusedChunkLength, length - offset);
+      for (size_t i = 0; i < steps_.size(); ++i) {
+        RETURN_NOT_OK(ExecuteStep(&steps_[i], offset, chunk_length,
+                                  /*is_root=*/i + 1 == steps_.size()));
+      }
+    }
+    return out;
+  }
+
+  // Execute the steps one after the other over the whole batch, for when some
+  // operand can't be sliced into chunks
+  Result<Datum> ExecuteUnfused() {
+    std::vector<Datum> results(steps_.size());
+    for (size_t i = 0; i < steps_.size(); ++i) {
+      std::vector<Datum> arguments;
+      for (const Operand& operand : steps_[i].operands) {
+        arguments.push_back(operand.step >= 0 ? results[operand.step] : operand.value);
+      }
+      ARROW_ASSIGN_OR_RAISE(results[i], ExecuteCall(*steps_[i].call, std::move(arguments),
+                                                    input_.length, exec_context_));
+    }
+    return results.back();
+  }
+
+  static constexpr int64_t kScratchAlignment = 64;
+  static constexpr int64_t kValiditySize =
+      bit_util::RoundUp(bit_util::BytesForBits(kFusedChunkLength), kScratchAlignment);
+
+  // An argument of a step: either the result of a previous step, or a value
+  // computed over the whole batch
+  struct Operand {
+    int step = -1;
+    Datum value;
+    ArraySpan array;
+  };
+
+  struct Step {
+    Step(const Expression::Call& call, compute::ExecContext* exec_context)
+        : call(&call),
+          kernel(static_cast<const ScalarKernel*>(call.kernel)),
+          kernel_context(exec_context, kernel) {
+      kernel_context.SetState(call.kernel_state.get());
+    }
+
+    const Expression::Call* call;
+    const ScalarKernel* kernel;
+    KernelContext kernel_context;
+    std::vector<Operand> operands;
+    int64_t byte_width;
+    bool has_validity;
+    ExecSpan batch;
+    // The output of the current chunk
+    ExecResult result;
+  };
+
+  static int64_t ScratchSize(const Step& step) {
+    return (step.has_validity ? kValiditySize : 0) +
+           bit_util::RoundUp(kFusedChunkLength * step.byte_width, kScratchAlignment);
+  }
+
+  // Add the step for `call` after the steps of its arguments. Return its index,
+  // or -1 if all its arguments are scalars, so there is nothing to fuse: `call` is
+  // then executed right away into `value`.
+  Result<int> AddStep(const Expression::Call& call, Datum* value) {
+    Step step(call, exec_context_);
+    step.byte_width =
+        checked_cast<const FixedWidthType&>(*call.type.type).bit_width() / 8;
+    step.has_validity = step.kernel->null_handling == NullHandling::COMPUTED_PREALLOCATE;
+    bool all_scalar = true;
+    for (const Expression& arg : call.arguments) {
+      Operand operand;
+      auto arg_call = arg.call();
+      if (arg_call != nullptr && IsFusable(*arg_call)) {
+        ARROW_ASSIGN_OR_RAISE(operand.step, AddStep(*arg_call, &operand.value));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(operand.value,
+                              ExecuteScalarExpression(arg, input_, exec_context_));
+      }
+      if (operand.step < 0) {
+        if (operand.value.is_array()) {
+          operand.array.SetMembers(*operand.value.array());
+        } else if (!operand.value.is_scalar()) {
+          // e.g. a chunked result from a non-fusable kernel
+          has_unfusable_value_ = true;
+        }
+      }
+      all_scalar = all_scalar && operand.value.is_scalar();
+      if (step.kernel->null_handling == NullHandling::INTERSECTION) {
+        step.has_validity = step.has_validity || MayHaveNulls(operand);
+      }
+      step.operands.push_back(std::move(operand));
+    }
+    if (all_scalar) {
+      std::vector<Datum> arguments;
+      for (Operand& operand : step.operands) {
+        arguments.push_back(std::move(operand.value));
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          *value, ExecuteCall(call, std::move(arguments), input_.length, exec_context_));
+      return -1;
+    }
+    step.batch.values.resize(step.operands.size());
+    for (size_t i = 0; i < step.operands.size(); ++i) {
+      if (step.operands[i].value.is_scalar()) {
+        step.batch.values[i].SetScalar(step.operands[i].value.scalar().get());
+      }
+    }
+    steps_.push_back(std::move(step));
+    return static_cast<int>(steps_.size()) - 1;
+  }
+
+  bool MayHaveNulls(const Operand& operand) const {
+    if (operand.step >= 0) {
+      return steps_[operand.step].has_validity;
+    }
+    if (operand.value.is_scalar()) {
+      return !operand.value.scalar()->is_valid;
+    }
+    return operand.array.MayHaveNulls();
+  }
+
+  Status ExecuteStep(Step* step, int64_t offset, int64_t length, bool is_root) {
+    step->batch.length = length;
+    for (size_t i = 0; i < step->operands.size(); ++i) {
+      const Operand& operand = step->operands[i];
+      ExecValue* value = &step->batch.values[i];
+      if (operand.step >= 0) {
+        value->array = *steps_[operand.step].result.array_span();
+      } else if (operand.value.is_array()) {
+        value->array = operand.array;
+        value->array.SetSlice(operand.array.offset + offset, length);
+        if (operand.array.null_count == 0) {
+          value->array.null_count = 0;
+        }
+      }
+    }
+
+    ArraySpan* out = step->result.array_span_mutable();
+    if (is_root) {
+      out->SetSlice(offset, length);
+    } else {
+      out->length = length;
+    }
+    if (step->kernel->null_handling == NullHandling::INTERSECTION) {
+      if (step->has_validity) {
+        detail::PropagateNullsSpans(step->batch, out);
+      } else {
+        out->null_count = 0;
+      }
+    } else if (step->kernel->null_handling == NullHandling::OUTPUT_NOT_NULL) {
+      out->null_count = 0;
+    } else {
+      out->null_count = kUnknownNullCount;
+    }
+
+    RETURN_NOT_OK(step->kernel->exec(&step->kernel_context, step->batch, &step->result));
+    // Preallocating kernels write into the given span
+    DCHECK(step->result.is_array_span());
+    return Status::OK();
+  }
+
+  const ExecBatch& input_;
+  compute::ExecContext* exec_context_;
+  std::vector<Step> steps_;
+  bool has_unfusable_value_ = false;
+};
+
+}  // namespace
+
 Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
                                       compute::ExecContext* exec_context) {
   if (exec_context == nullptr) {
@@ -748,34 +1223,19 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
   auto call = CallNotNull(expr);
 
   std::vector<Datum> arguments(call->arguments.size());
-
-  bool all_scalar = true;
-  for (size_t i = 0; i < arguments.size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(
-        arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
-    if (arguments[i].is_array()) {
-      all_scalar = false;
+  if (IsShortCircuitable(*call, input)) {
+    ARROW_ASSIGN_OR_RAISE(arguments,
+                          ExecuteShortCircuitArguments(*call, input, exec_context));
+  } else if (IsFusableChain(*call, input)) {
+    FusedExecutor executor(input, exec_context);
+    return executor.Execute(*call);
+  } else {
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(
+          arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
     }
   }
-
-  auto executor = compute::detail::KernelExecutor::MakeScalar();
-
-  compute::KernelContext kernel_context(exec_context, call->kernel);
-  kernel_context.SetState(call->kernel_state.get());
-
-  const Kernel* kernel = call->kernel;
-  std::vector<TypeHolder> types = GetTypes(arguments);
-  auto options = call->options.get();
-  RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, types, options}));
-
-  compute::detail::DatumAccumulator listener;
-  RETURN_NOT_OK(executor->Execute(
-      ExecBatch(std::move(arguments), all_scalar ? 1 : input.length), &listener));
-  const auto out = executor->WrapResults(arguments, listener.values());
-#ifndef NDEBUG
-  DCHECK_OK(executor->CheckResultType(out, call->function_name.c_str()));
-#endif
-  return out;
+  return ExecuteCall(*call, std::move(arguments), input.length, exec_context);
 }
 
 namespace {
@@ -150,6 +150,14 @@ auto complex_integer_expression =
     call("multiply", {call("add", {field_ref("x"), literal(20)}),
                       call("add", {field_ref("x"), literal(-3)})});
 auto simple_expression = call("negate", {field_ref("x")});
+// (x * 2 + x) / 3 - 1, executed as a fused chain of arithmetic kernels
+auto arithmetic_chain_expression = call(
+    "subtract",
+    {call("divide",
+          {call("add", {call("multiply", {field_ref("x"), literal(int64_t(2))}),
+                        field_ref("x")}),
+           literal(int64_t(3))}),
+     literal(int64_t(1))});
 auto zero_copy_expression =
     call("cast", {field_ref("x")}, compute::CastOptions::Safe(timestamp(TimeUnit::NANO)));
 auto ref_only_expression = field_ref("x");
@@ -274,6 +282,14 @@ BENCHMARK_TEMPLATE(ExecuteScalarExpressionBaseline, SimpleExpressionBaseline)
     ->DenseThreadRange(1, std::thread::hardware_concurrency(),
                        std::thread::hardware_concurrency())
     ->UseRealTime();
+BENCHMARK_CAPTURE(ExecuteScalarExpressionOverhead, arithmetic_chain_expression,
+                  arithmetic_chain_expression)
+    ->ArgNames({"rows_per_batch"})
+    ->RangeMultiplier(10)
+    ->Range(1000, 1000000)
+    ->DenseThreadRange(1, std::thread::hardware_concurrency(),
+                       std::thread::hardware_concurrency())
+    ->UseRealTime();
 BENCHMARK_CAPTURE(ExecuteScalarExpressionOverhead, zero_copy_expression,
                   zero_copy_expression)
     ->ArgNames({"rows_per_batch"})
@@ -31,6 +31,7 @@
 #include "arrow/compute/function_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 using testing::HasSubstr;
 using testing::UnorderedElementsAreArray;
@@ -607,9 +608,12 @@ TEST(Expression, BindWithImplicitCasts) {
     ExpectBindsTo(cmp(field_ref("i8"), field_ref("u32")),
                   cmp(cast(field_ref("i8"), int64()), cast(field_ref("u32"), int64())));
 
-    // cast dictionary to value type
-    ExpectBindsTo(cmp(field_ref("dict_str"), field_ref("str")),
-                  cmp(cast(field_ref("dict_str"), utf8()), field_ref("str")));
+    // dictionaries are compared without decoding
+    ExpectBindsTo(cmp(field_ref("dict_str"), field_ref("str")), no_change);
+
+    // cast dictionary to value type if the other side can't be cast
+    ExpectBindsTo(cmp(field_ref("dict_i32"), field_ref("i64")),
+                  cmp(cast(field_ref("dict_i32"), int64()), field_ref("i64")));
 
     // Should prefer the literal
     ExpectBindsTo(cmp(field_ref("dict_i32"), literal(int64_t(4))),
@@ -645,9 +649,8 @@ TEST(Expression, BindWithImplicitCasts) {
 
   compute::SetLookupOptions in_a{ArrayFromJSON(utf8(), R"(["a"])")};
 
-  // cast dictionary to value type
-  ExpectBindsTo(call("is_in", {field_ref("dict_str")}, in_a),
-                call("is_in", {cast(field_ref("dict_str"), utf8())}, in_a));
+  // dictionaries are looked up without decoding
+  ExpectBindsTo(call("is_in", {field_ref("dict_str")}, in_a), no_change);
 }
 
 TEST(Expression, BindNestedCall) {
@@ -874,6 +877,139 @@ TEST(Expression, ExecuteDictionaryTransparent) {
   ])"));
 }
 
+TEST(Expression, ExecuteShortCircuit) {
+  auto in = ArrayFromJSON(struct_({field("a", int64()), field("b", int64())}), R"([
+    {"a": 0,    "b": 1},
+    {"a": 2,    "b": 0},
+    {"a": 5,    "b": null},
+    {"a": -1,   "b": 3},
+    {"a": null, "b": 4}
+  ])");
+  auto divide_checked = [](Expression left, Expression right) {
+    return call("divide_checked", {std::move(left), std::move(right)});
+  };
+
+  // Same results as evaluating every argument over the whole batch
+  ExpectExecute(call("if_else", {greater(field_ref("a"), literal(int64_t(0))),
+                                 add(field_ref("a"), field_ref("b")),
+                                 call("negate", {field_ref("b")})}),
+                in);
+  ExpectExecute(call("coalesce", {field_ref("b"), call("negate", {field_ref("a")}),
+                                  literal(int64_t(42))}),
+                in);
+  ExpectExecute(
+      call("case_when",
+           {call("make_struct",
+                 {equal(field_ref("b"), literal(int64_t(0))),
+                  greater(field_ref("a"), literal(int64_t(0)))},
+                 compute::MakeStructOptions({"b0", "a_pos"})),
+            literal(int64_t(1)), add(field_ref("a"), literal(int64_t(1))),
+            call("negate", {field_ref("b")})}),
+      in);
+
+  // Branches are only evaluated over the rows they are picked for, so they don't
+  // fail because of the other rows
+  auto ExpectExecutesTo = [&](Expression expr, const std::string& expected_json) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(in->type()));
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         ExecuteScalarExpression(expr, Schema(in->type()->fields()), in));
+    AssertDatumsEqual(actual, ArrayFromJSON(int64(), expected_json), /*verbose=*/true);
+  };
+  ExpectExecutesTo(call("if_else", {not_equal(field_ref("a"), literal(int64_t(0))),
+                                    divide_checked(literal(int64_t(100)), field_ref("a")),
+                                    literal(int64_t(-7))}),
+                   "[-7, 50, 20, -100, null]");
+  ExpectExecutesTo(call("coalesce", {field_ref("b"), divide_checked(literal(int64_t(100)),
+                                                                     field_ref("a"))}),
+                   "[1, 0, 20, 3, 4]");
+  // ... also when they are arguments of a fusable chain
+  ExpectExecutesTo(add(call("coalesce", {field_ref("b"),
+                                         divide_checked(literal(int64_t(100)),
+                                                        field_ref("a"))}),
+                       call("negate", {field_ref("a")})),
+                   "[1, -2, 15, 4, null]");
+  ExpectExecutesTo(
+      call("case_when",
+           {call("make_struct",
+                 {equal(field_ref("b"), literal(int64_t(0))),
+                  greater(field_ref("a"), literal(int64_t(0)))},
+                 compute::MakeStructOptions({"b0", "a_pos"})),
+            literal(int64_t(1)), divide_checked(literal(int64_t(100)), field_ref("a")),
+            divide_checked(literal(int64_t(100)), field_ref("b"))}),
+      "[100, 1, 20, 33, 25]");
+  ExpectExecutesTo(call("if_else", {literal(false),
+                                    divide_checked(field_ref("a"), literal(int64_t(0))),
+                                    field_ref("a")}),
+                   "[0, 2, 5, -1, null]");
+
+  // Errors in the rows which need a branch are still raised
+  ASSERT_OK_AND_ASSIGN(
+      auto expr, call("if_else", {greater(field_ref("a"), literal(int64_t(-5))),
+                                  divide_checked(literal(int64_t(100)), field_ref("a")),
+                                  literal(int64_t(-7))})
+                     .Bind(in->type()));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("divide by zero"),
+      ExecuteScalarExpression(expr, Schema(in->type()->fields()), in));
+}
+
+TEST(Expression, ExecuteFusedArithmetic) {
+  // Chains of arithmetic kernels are executed chunk by chunk, use several chunks
+  // and a partial one
+  const int64_t length = 3 * 1024 + 17;
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  auto type = struct_({field("i", int32()), field("f", float64()), field("g", float64()),
+                       field("u", uint8()), field("s", utf8())});
+  for (double null_probability : {0.0, 0.1}) {
+    ARROW_SCOPED_TRACE("null_probability = ", null_probability);
+    ASSERT_OK_AND_ASSIGN(
+        std::shared_ptr<Array> in, StructArray::Make(
+                     {rand.Int32(length + 5, -1000, 1000, null_probability),
+                      rand.Float64(length + 5, -10, 10, null_probability),
+                      rand.Float64(length + 5, 1, 2, /*null_probability=*/0),
+                      rand.UInt8(length + 5, 0, 7, null_probability),
+                      rand.String(length + 5, 0, 5, null_probability)},
+                     type->fields()));
+    for (const auto& input : {in, in->Slice(5)}) {
+      // (i * 2 + f) / g - 1
+      ExpectExecute(call("subtract",
+                         {call("divide", {add(call("multiply", {field_ref("i"),
+                                                                literal(2)}),
+                                                  field_ref("f")),
+                                          field_ref("g")}),
+                          literal(1.0)}),
+                    input);
+      auto product = call("multiply_checked", {field_ref("i"), field_ref("u")});
+      ExpectExecute(call("abs", {call("negate", {product})}), input);
+      ExpectExecute(call("sqrt", {call("power", {field_ref("f"), literal(2.0)})}), input);
+      // Fused arguments of a non-fusable call, and non-fusable arguments of a fused
+      // call
+      ExpectExecute(greater(add(field_ref("f"), field_ref("g")), literal(0.5)), input);
+      ExpectExecute(add(call("utf8_length", {field_ref("s")}),
+                        call("shift_left", {field_ref("i"), field_ref("u")})),
+                    input);
+      // Constant arguments
+      ExpectExecute(add(call("multiply", {literal(2), literal(3)}), field_ref("i")),
+                    input);
+      ExpectExecute(add(call("multiply", {field_ref("f"), literal(2.0)}),
+                        literal(MakeNullScalar(float64()))),
+                    input);
+    }
+  }
+
+  // Errors are raised from any step
+  auto in = ArrayFromJSON(struct_({field("a", int32())}),
+                          R"([{"a": 1}, {"a": 65536}, {"a": null}])");
+  ASSERT_OK_AND_ASSIGN(auto expr, call("add_checked", {call("multiply_checked",
+                                                            {field_ref("a"),
+                                                             field_ref("a")}),
+                                                       literal(1)})
+                                      .Bind(in->type()));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("overflow"),
+      ExecuteScalarExpression(expr, Schema(in->type()->fields()), in));
+}
+
 void ExpectIdenticalIfUnchanged(Expression modified, Expression original) {
   if (modified == original) {
     // no change -> must be identical
@@ -216,6 +216,26 @@ class ARROW_EXPORT AggregateNodeOptions : public ExecNodeOptions {
   std::vector<FieldRef> keys;
 };
 
+/// \brief Make a node which appends the running values of cumulative functions
+///
+/// Each cumulative is described like an aggregate: the name of a cumulative vector
+/// function (e.g. "cumulative_sum" or "cumulative_mean"), its options, a single
+/// target field and the name of the output field.  The input is processed in order
+/// and the state of each function is carried from one batch to the next, so that
+/// the output matches that of the function applied to the whole column, without
+/// materializing it.
+///
+/// The input batches must be sequenced, i.e. have a batch index.
+class ARROW_EXPORT CumulativeNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "cumulative";
+  explicit CumulativeNodeOptions(std::vector<Aggregate> cumulatives)
+      : cumulatives(std::move(cumulatives)) {}
+
+  // cumulative functions which will be applied to the targetted fields
+  std::vector<Aggregate> cumulatives;
+};
+
 constexpr int32_t kDefaultBackpressureHighBytes = 1 << 30;  // 1GiB
 constexpr int32_t kDefaultBackpressureLowBytes = 1 << 28;   // 256MiB
 
@@ -1298,6 +1298,81 @@ TEST(ExecPlanExecution, ScalarSourceScalarAggSink) {
   AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
 }
 
+TEST(ExecPlanExecution, ScalarAggSinkFusedAggregates) {
+  // count, sum, mean, min, max and min_max of the same column are computed
+  // together in one pass over each array, scalars are consumed separately
+  BatchesWithSchema data;
+  data.batches = {
+      ExecBatchFromJSON({int32(), float64()}, "[[1, 1.5], [null, null], [3, -0.5]]"),
+      ExecBatchFromJSON({int32(), float64()}, {ArgShape::SCALAR, ArgShape::SCALAR},
+                        "[[2, 0.25], [2, 0.25]]"),
+      ExecBatchFromJSON({int32(), float64()}, "[[4, 2], [5, 4], [null, null]]")};
+  data.schema = schema({field("a", int32()), field("b", float64())});
+
+  auto keep_nulls = std::make_shared<ScalarAggregateOptions>(/*skip_nulls=*/false);
+  auto only_null = std::make_shared<CountOptions>(CountOptions::ONLY_NULL);
+  auto min_max_type = [](const std::shared_ptr<DataType>& type) {
+    return struct_({field("min", type), field("max", type)});
+  };
+  auto expected = ExecBatchFromJSON(
+      {int64(), float64(), int32(), int32(), min_max_type(int32()), int64(), int64(),
+       int64(), int64(), float64(), min_max_type(float64())},
+      {ArgShape::SCALAR, ArgShape::SCALAR, ArgShape::SCALAR, ArgShape::SCALAR,
+       ArgShape::SCALAR, ArgShape::SCALAR, ArgShape::SCALAR, ArgShape::SCALAR,
+       ArgShape::SCALAR, ArgShape::SCALAR, ArgShape::SCALAR},
+      R"([[17, 2.8333333333333335, 1, 5, {"min": 1, "max": 5}, 6, 2, null, 240, 7.5,
+           {"min": -0.5, "max": 4}]])");
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+    Declaration plan = Declaration::Sequence(
+        {{"source", SourceNodeOptions{data.schema, data.gen(parallel, /*slow=*/false)}},
+         {"aggregate", AggregateNodeOptions{/*aggregates=*/{
+                           {"sum", nullptr, "a", "sum(a)"},
+                           {"mean", nullptr, "a", "mean(a)"},
+                           {"min", nullptr, "a", "min(a)"},
+                           {"max", nullptr, "a", "max(a)"},
+                           {"min_max", nullptr, "a", "min_max(a)"},
+                           {"count", nullptr, "a", "count(a)"},
+                           {"count", only_null, "a", "count_null(a)"},
+                           {"sum", keep_nulls, "a", "sum_keep_nulls(a)"},
+                           {"product", nullptr, "a", "product(a)"},
+                           {"sum", nullptr, "b", "sum(b)"},
+                           {"min_max", nullptr, "b", "min_max(b)"},
+                       }}}});
+    // The aggregates of each column are computed by a single fused aggregator
+    ASSERT_OK_AND_ASSIGN(std::string plan_str, DeclarationToString(plan));
+    EXPECT_THAT(plan_str, HasSubstr("fused=[a, b]"));
+    ASSERT_OK_AND_ASSIGN(auto result, DeclarationToExecBatches(std::move(plan)));
+    AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, {expected});
+  }
+}
+
+TEST(ExecPlanExecution, ScalarAggSinkFusedMinMaxNaN) {
+  // NaN is skipped by min_max, a batch of only NaN must not widen the result
+  BatchesWithSchema data;
+  data.batches = {ExecBatchFromJSON({float64()}, "[[1], [2]]"),
+                  ExecBatchFromJSON({float64()}, "[[NaN], [null]]")};
+  data.schema = schema({field("b", float64())});
+  auto expected = ExecBatchFromJSON(
+      {int64(), struct_({field("min", float64()), field("max", float64())})},
+      {ArgShape::SCALAR, ArgShape::SCALAR}, R"([[3, {"min": 1, "max": 2}]])");
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+    Declaration plan = Declaration::Sequence(
+        {{"source", SourceNodeOptions{data.schema, data.gen(parallel, /*slow=*/false)}},
+         {"aggregate", AggregateNodeOptions{/*aggregates=*/{
+                           {"count", nullptr, "b", "count(b)"},
+                           {"min_max", nullptr, "b", "min_max(b)"},
+                       }}}});
+    ASSERT_OK_AND_ASSIGN(std::string plan_str, DeclarationToString(plan));
+    EXPECT_THAT(plan_str, HasSubstr("fused=[b]"));
+    ASSERT_OK_AND_ASSIGN(auto result, DeclarationToExecBatches(std::move(plan)));
+    AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, {expected});
+  }
+}
+
 TEST(ExecPlanExecution, ScalarSourceStandaloneNullaryScalarAggSink) {
   BatchesWithSchema scalar_data;
   scalar_data.batches = {
@@ -139,6 +139,11 @@ static inline std::string GenericToString(const std::shared_ptr<Scalar>& value)
   return ss.str();
 }
 
+static inline std::string GenericToString(
+    const std::optional<std::shared_ptr<Scalar>>& value) {
+  return value.has_value() ? GenericToString(value.value()) : "nullopt";
+}
+
 static inline std::string GenericToString(
     const std::shared_ptr<const KeyValueMetadata>& value) {
   std::stringstream ss;
@@ -225,6 +230,15 @@ static inline bool GenericEquals(const std::shared_ptr<T>& left,
   return left == right;
 }
 
+template <typename T>
+static inline bool GenericEquals(const std::optional<T>& left,
+                                 const std::optional<T>& right) {
+  if (left.has_value() && right.has_value()) {
+    return GenericEquals(left.value(), right.value());
+  }
+  return left.has_value() == right.has_value();
+}
+
 static inline bool IsEmpty(const std::shared_ptr<const KeyValueMetadata>& meta) {
   return !meta || meta->size() == 0;
 }
@@ -366,6 +380,11 @@ static inline Result<std::shared_ptr<Scalar>> GenericToScalar(
   return value;
 }
 
+static inline Result<std::shared_ptr<Scalar>> GenericToScalar(
+    const std::optional<std::shared_ptr<Scalar>>& value) {
+  return value.has_value() ? value.value() : MakeNullScalar(null());
+}
+
 static inline Result<std::shared_ptr<Scalar>> GenericToScalar(
     const std::shared_ptr<Array>& value) {
   return std::make_shared<ListScalar>(value);
@@ -417,13 +436,6 @@ using is_optional =
 template <typename T, typename R = void>
 using enable_if_optional = enable_if_t<is_optional<T>::value, Result<T>>;
 
-template <typename T>
-static inline enable_if_optional<T> GenericFromScalar(
-    const std::shared_ptr<Scalar>& value) {
-  using value_type = typename T::value_type;
-  return GenericFromScalar<value_type>(value);
-}
-
 template <typename T, typename U>
 using enable_if_same_result = enable_if_same<T, U, Result<T>>;
 
@@ -528,6 +540,16 @@ GenericFromScalar(const std::shared_ptr<Scalar>& value) {
   return result;
 }
 
+template <typename T>
+static inline enable_if_optional<T> GenericFromScalar(
+    const std::shared_ptr<Scalar>& value) {
+  using value_type = typename T::value_type;
+  if (value->type->id() == Type::NA) {
+    return std::nullopt;
+  }
+  return GenericFromScalar<value_type>(value);
+}
+
 template <typename Options>
 struct StringifyImpl {
   template <typename Tuple>
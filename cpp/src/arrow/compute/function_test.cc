@@ -47,6 +47,9 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new ScalarAggregateOptions(/*skip_nulls=*/false, /*min_count=*/1));
   options.emplace_back(new CountOptions());
   options.emplace_back(new CountOptions(CountOptions::ALL));
+  options.emplace_back(new ApproxCountDistinctOptions());
+  options.emplace_back(
+      new ApproxCountDistinctOptions(CountOptions::ALL, /*precision=*/10));
   options.emplace_back(new ModeOptions());
   options.emplace_back(new ModeOptions(/*n=*/2));
   options.emplace_back(new VarianceOptions());
@@ -57,6 +60,10 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new TDigestOptions());
   options.emplace_back(
       new TDigestOptions(/*q=*/0.75, /*delta=*/50, /*buffer_size=*/1024));
+  options.emplace_back(new KllQuantileOptions());
+  options.emplace_back(new KllQuantileOptions(/*q=*/{0.5, 0.99}, /*k=*/400));
+  options.emplace_back(new PivotWiderOptions({"height", "width"}));
+  options.emplace_back(new PivotWiderOptions({"height"}, PivotWiderOptions::kRaise));
   options.emplace_back(new IndexOptions(ScalarFromJSON(int64(), "16")));
   options.emplace_back(new IndexOptions(ScalarFromJSON(boolean(), "true")));
   options.emplace_back(new IndexOptions(ScalarFromJSON(boolean(), "null")));
@@ -76,6 +83,8 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new ElementWiseAggregateOptions(/*skip_nulls=*/false));
   options.emplace_back(new JoinOptions());
   options.emplace_back(new JoinOptions(JoinOptions::REPLACE, "replacement"));
+  options.emplace_back(new MatchAnyRegexOptions({"a+", "b?c"}));
+  options.emplace_back(new MatchAnyRegexOptions({"a+"}, /*ignore_case=*/true));
   options.emplace_back(new MatchSubstringOptions("pattern"));
   options.emplace_back(new MatchSubstringOptions("pattern", /*ignore_case=*/true));
   options.emplace_back(new SplitOptions());
@@ -133,6 +142,8 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new PartitionNthOptions(/*pivot=*/42));
   options.emplace_back(new SelectKOptions(0, {}));
   options.emplace_back(new SelectKOptions(5, {{SortKey("key", SortOrder::Ascending)}}));
+  options.emplace_back(new CumulativeOptions());
+  options.emplace_back(new CumulativeOptions(ScalarFromJSON(int64(), "2"), true));
   options.emplace_back(new Utf8NormalizeOptions());
   options.emplace_back(new Utf8NormalizeOptions(Utf8NormalizeOptions::NFD));
 
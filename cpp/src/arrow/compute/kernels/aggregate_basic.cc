@@ -23,7 +23,10 @@
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/hashing.h"
 
+#include <cmath>
 #include <memory>
+#include <optional>
+#include <string_view>
 
 namespace arrow {
 namespace compute {
@@ -90,7 +93,7 @@ struct CountAllImpl : public ScalarAggregator {
   int64_t count = 0;
 };
 
-struct CountImpl : public ScalarAggregator {
+struct CountImpl : public ScalarAggregator, public FusableAggregator {
   explicit CountImpl(CountOptions options) : options(std::move(options)) {}
 
   Status Consume(KernelContext*, const ExecSpan& batch) override {
@@ -109,6 +112,15 @@ struct CountImpl : public ScalarAggregator {
     return Status::OK();
   }
 
+  void ConsumeStats(const BasicStatsBase& stats) override {
+    if (options.mode == CountOptions::ALL) {
+      this->non_nulls += stats.length;
+    } else {
+      this->nulls += stats.null_count;
+      this->non_nulls += stats.length - stats.null_count;
+    }
+  }
+
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other_state = checked_cast<const CountImpl&>(src);
     this->non_nulls += other_state.non_nulls;
@@ -267,6 +279,208 @@ void AddCountDistinctKernels(ScalarAggregateFunction* func) {
       match::FixedSizeBinaryLike(), func);
 }
 
+// ----------------------------------------------------------------------
+// Approximate Distinct Count implementation
+
+template <typename Type, typename VisitorArgType>
+struct ApproxCountDistinctImpl : public ScalarAggregator {
+  explicit ApproxCountDistinctImpl(ApproxCountDistinctOptions options)
+      : options(std::move(options)), hll(this->options.precision) {}
+
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    if (batch[0].is_array()) {
+      const ArraySpan& arr = batch[0].array;
+      this->has_nulls = this->has_nulls || arr.GetNullCount() > 0;
+
+      VisitArraySpanInline<Type>(
+          arr, [&](VisitorArgType arg) { hll.Add(HyperLogLogHash(arg)); }, [] {});
+    } else {
+      const Scalar& input = *batch[0].scalar;
+      this->has_nulls = this->has_nulls || !input.is_valid;
+
+      if (input.is_valid) {
+        hll.Add(HyperLogLogHash(UnboxScalar<Type>::Unbox(input)));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other_state = checked_cast<const ApproxCountDistinctImpl&>(src);
+    RETURN_NOT_OK(this->hll.Merge(other_state.hll));
+    this->has_nulls = this->has_nulls || other_state.has_nulls;
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    const auto& state = checked_cast<const ApproxCountDistinctImpl&>(*ctx->state());
+    const int64_t non_nulls = std::llround(state.hll.Estimate());
+    const int64_t nulls = state.has_nulls ? 1 : 0;
+    switch (state.options.mode) {
+      case CountOptions::ONLY_VALID:
+        *out = Datum(non_nulls);
+        break;
+      case CountOptions::ALL:
+        *out = Datum(non_nulls + nulls);
+        break;
+      case CountOptions::ONLY_NULL:
+        *out = Datum(nulls);
+        break;
+      default:
+        DCHECK(false) << "unreachable";
+    }
+    return Status::OK();
+  }
+
+  const ApproxCountDistinctOptions options;
+  bool has_nulls = false;
+  arrow::internal::HyperLogLog hll;
+};
+
+// Output the serialized sketch instead of its estimate, to be merged later by
+// approx_count_distinct_merge
+template <typename Type, typename VisitorArgType>
+struct ApproxCountDistinctSketchImpl
+    : public ApproxCountDistinctImpl<Type, VisitorArgType> {
+  using Base = ApproxCountDistinctImpl<Type, VisitorArgType>;
+  using Base::Base;
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    const auto& state = checked_cast<const Base&>(*ctx->state());
+    *out = Datum(
+        std::make_shared<BinaryScalar>(Buffer::FromString(state.hll.Serialize())));
+    return Status::OK();
+  }
+};
+
+// Merge sketches output by approx_count_distinct_sketch and estimate the number of
+// distinct values they were built from
+struct ApproxCountDistinctMergeImpl : public ScalarAggregator {
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    if (batch[0].is_array()) {
+      return VisitArraySpanInline<BinaryType>(
+          batch[0].array, [&](std::string_view sketch) { return MergeSketch(sketch); },
+          [] { return Status::OK(); });
+    }
+    const Scalar& input = *batch[0].scalar;
+    if (!input.is_valid) {
+      return Status::OK();
+    }
+    return MergeSketch(UnboxScalar<BinaryType>::Unbox(input));
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    auto& other_state = checked_cast<ApproxCountDistinctMergeImpl&>(src);
+    if (other_state.hll.has_value()) {
+      return Merge(std::move(*other_state.hll));
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    const auto& state = checked_cast<const ApproxCountDistinctMergeImpl&>(*ctx->state());
+    const int64_t estimate =
+        state.hll.has_value() ? std::llround(state.hll->Estimate()) : 0;
+    *out = Datum(estimate);
+    return Status::OK();
+  }
+
+  Status MergeSketch(std::string_view data) {
+    ARROW_ASSIGN_OR_RAISE(auto sketch, arrow::internal::HyperLogLog::Deserialize(data));
+    return Merge(std::move(sketch));
+  }
+
+  Status Merge(arrow::internal::HyperLogLog sketch) {
+    if (!hll.has_value()) {
+      hll = std::move(sketch);
+      return Status::OK();
+    }
+    return hll->Merge(sketch);
+  }
+
+  // Unset until the first sketch, whose precision the others must share
+  std::optional<arrow::internal::HyperLogLog> hll;
+};
+
+Result<std::unique_ptr<KernelState>> ApproxCountDistinctMergeInit(
+    KernelContext*, const KernelInitArgs&) {
+  return std::make_unique<ApproxCountDistinctMergeImpl>();
+}
+
+Status ValidateHyperLogLogPrecision(int32_t precision) {
+  if (precision < arrow::internal::HyperLogLog::kMinPrecision ||
+      precision > arrow::internal::HyperLogLog::kMaxPrecision) {
+    return Status::Invalid("HyperLogLog precision must be between ",
+                           arrow::internal::HyperLogLog::kMinPrecision, " and ",
+                           arrow::internal::HyperLogLog::kMaxPrecision, ", got ",
+                           precision);
+  }
+  return Status::OK();
+}
+
+template <template <typename...> class Impl, typename Type, typename VisitorArgType>
+Result<std::unique_ptr<KernelState>> ApproxCountDistinctInit(KernelContext* ctx,
+                                                             const KernelInitArgs& args) {
+  const auto& options = static_cast<const ApproxCountDistinctOptions&>(*args.options);
+  RETURN_NOT_OK(ValidateHyperLogLogPrecision(options.precision));
+  return std::make_unique<Impl<Type, VisitorArgType>>(options);
+}
+
+template <template <typename...> class Impl, typename Type,
+          typename VisitorArgType = typename Type::c_type>
+void AddApproxCountDistinctKernel(InputType type, std::shared_ptr<DataType> out_type,
+                                  ScalarAggregateFunction* func) {
+  AddAggKernel(KernelSignature::Make({type}, std::move(out_type)),
+               ApproxCountDistinctInit<Impl, Type, VisitorArgType>, func);
+}
+
+template <template <typename...> class Impl>
+void AddApproxCountDistinctKernels(const std::shared_ptr<DataType>& out_type,
+                                   ScalarAggregateFunction* func) {
+  // Boolean
+  AddApproxCountDistinctKernel<Impl, BooleanType>(boolean(), out_type, func);
+  // Number
+  AddApproxCountDistinctKernel<Impl, Int8Type>(int8(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, Int16Type>(int16(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, Int32Type>(int32(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, Int64Type>(int64(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, UInt8Type>(uint8(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, UInt16Type>(uint16(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, UInt32Type>(uint32(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, UInt64Type>(uint64(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, HalfFloatType>(float16(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, FloatType>(float32(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, DoubleType>(float64(), out_type, func);
+  // Date
+  AddApproxCountDistinctKernel<Impl, Date32Type>(date32(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, Date64Type>(date64(), out_type, func);
+  // Time
+  AddApproxCountDistinctKernel<Impl, Time32Type>(match::SameTypeId(Type::TIME32),
+                                                 out_type, func);
+  AddApproxCountDistinctKernel<Impl, Time64Type>(match::SameTypeId(Type::TIME64),
+                                                 out_type, func);
+  // Timestamp & Duration
+  AddApproxCountDistinctKernel<Impl, TimestampType>(match::SameTypeId(Type::TIMESTAMP),
+                                                    out_type, func);
+  AddApproxCountDistinctKernel<Impl, DurationType>(match::SameTypeId(Type::DURATION),
+                                                   out_type, func);
+  // Interval
+  AddApproxCountDistinctKernel<Impl, MonthIntervalType>(month_interval(), out_type,
+                                                        func);
+  AddApproxCountDistinctKernel<Impl, DayTimeIntervalType>(day_time_interval(),
+                                                          out_type, func);
+  AddApproxCountDistinctKernel<Impl, MonthDayNanoIntervalType>(
+      month_day_nano_interval(), out_type, func);
+  // Binary & String
+  AddApproxCountDistinctKernel<Impl, BinaryType, std::string_view>(
+      match::BinaryLike(), out_type, func);
+  AddApproxCountDistinctKernel<Impl, LargeBinaryType, std::string_view>(
+      match::LargeBinaryLike(), out_type, func);
+  // Fixed binary & Decimal
+  AddApproxCountDistinctKernel<Impl, FixedSizeBinaryType, std::string_view>(
+      match::FixedSizeBinaryLike(), out_type, func);
+}
+
 // ----------------------------------------------------------------------
 // Sum implementation
 
@@ -825,6 +1039,33 @@ void AddArrayScalarAggKernels(KernelInit init,
   AddScalarAggKernels(init, types, out_ty, func);
 }
 
+Result<std::unique_ptr<FusedAggregator>> MakeFusedAggregator(
+    const DataType& type, const std::vector<KernelState*>& states) {
+  std::vector<FusableAggregator*> members;
+  for (auto* state : states) {
+    auto* member = dynamic_cast<FusableAggregator*>(state);
+    if (member == nullptr) {
+      return nullptr;
+    }
+    members.push_back(member);
+  }
+#if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
+  auto cpu_info = arrow::internal::CpuInfo::GetInstance();
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
+    return MakeFusedAggregatorAvx512(type, std::move(members));
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
+    return MakeFusedAggregatorAvx2(type, std::move(members));
+  }
+#endif
+  FusedAggregatorInit<SimdLevel::NONE> visitor(std::move(members));
+  return visitor.Create(type);
+}
+
 namespace {
 
 Result<TypeHolder> MinMaxType(KernelContext*, const std::vector<TypeHolder>& types) {
@@ -866,6 +1107,31 @@ const FunctionDoc count_distinct_doc{"Count the number of unique values",
                                      {"array"},
                                      "CountOptions"};
 
+const FunctionDoc approx_count_distinct_doc{
+    "Approximately count the number of unique values",
+    ("The HyperLogLog++ algorithm is used, so that memory usage is bounded\n"
+     "regardless of the number of unique values.  The sketch precision and\n"
+     "whether nulls/values are counted are controlled by\n"
+     "ApproxCountDistinctOptions.  NaNs and signed zeroes are normalized."),
+    {"array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc approx_count_distinct_sketch_doc{
+    "Build a HyperLogLog++ sketch of the unique values",
+    ("Like approx_count_distinct, but the sketch is output serialized as a\n"
+     "binary scalar instead of being estimated, so that sketches computed\n"
+     "separately can be merged with approx_count_distinct_merge.  Null values\n"
+     "are not recorded in the sketch, only the precision of\n"
+     "ApproxCountDistinctOptions is used."),
+    {"array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc approx_count_distinct_merge_doc{
+    "Merge HyperLogLog++ sketches and estimate the number of unique values",
+    ("The input holds the sketches output by approx_count_distinct_sketch,\n"
+     "which must all have the same precision.  Null sketches are ignored."),
+    {"sketches"}};
+
 const FunctionDoc sum_doc{
     "Compute the sum of a numeric array",
     ("Null values are ignored by default. Minimum count of non-null\n"
@@ -935,6 +1201,8 @@ const FunctionDoc index_doc{"Find the index of the first occurrence of a given v
 void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   static auto default_scalar_aggregate_options = ScalarAggregateOptions::Defaults();
   static auto default_count_options = CountOptions::Defaults();
+  static auto default_approx_count_distinct_options =
+      ApproxCountDistinctOptions::Defaults();
 
   auto func = std::make_shared<ScalarAggregateFunction>("count_all", Arity::Nullary(),
                                                         count_all_doc, NULLPTR);
@@ -957,6 +1225,26 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddCountDistinctKernels(func.get());
   DCHECK_OK(registry->AddFunction(std::move(func)));
 
+  func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct", Arity::Unary(), approx_count_distinct_doc,
+      &default_approx_count_distinct_options);
+  // Takes any input, outputs int64 scalar
+  AddApproxCountDistinctKernels<ApproxCountDistinctImpl>(int64(), func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct_sketch", Arity::Unary(), approx_count_distinct_sketch_doc,
+      &default_approx_count_distinct_options);
+  // Takes any input, outputs binary scalar
+  AddApproxCountDistinctKernels<ApproxCountDistinctSketchImpl>(binary(), func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct_merge", Arity::Unary(), approx_count_distinct_merge_doc);
+  AddAggKernel(KernelSignature::Make({binary()}, int64()), ApproxCountDistinctMergeInit,
+               func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
   func = std::make_shared<ScalarAggregateFunction>("sum", Arity::Unary(), sum_doc,
                                                    &default_scalar_aggregate_options);
   AddArrayScalarAggKernels(SumInit, {boolean()}, uint64(), func.get());
@@ -63,6 +63,15 @@ Result<std::unique_ptr<KernelState>> MinMaxInitAvx2(KernelContext* ctx,
   return visitor.Create();
 }
 
+// ----------------------------------------------------------------------
+// Fused aggregation
+
+Result<std::unique_ptr<FusedAggregator>> MakeFusedAggregatorAvx2(
+    const DataType& type, std::vector<FusableAggregator*> members) {
+  FusedAggregatorInit<SimdLevel::AVX2> visitor(std::move(members));
+  return visitor.Create(type);
+}
+
 void AddSumAvx2AggKernels(ScalarAggregateFunction* func) {
   AddBasicAggKernels(SumInitAvx2, SignedIntTypes(), int64(), func, SimdLevel::AVX2);
   AddBasicAggKernels(SumInitAvx2, UnsignedIntTypes(), uint64(), func, SimdLevel::AVX2);
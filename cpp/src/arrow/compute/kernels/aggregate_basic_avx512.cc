@@ -63,6 +63,15 @@ Result<std::unique_ptr<KernelState>> MinMaxInitAvx512(KernelContext* ctx,
   return visitor.Create();
 }
 
+// ----------------------------------------------------------------------
+// Fused aggregation
+
+Result<std::unique_ptr<FusedAggregator>> MakeFusedAggregatorAvx512(
+    const DataType& type, std::vector<FusableAggregator*> members) {
+  FusedAggregatorInit<SimdLevel::AVX512> visitor(std::move(members));
+  return visitor.Create(type);
+}
+
 void AddSumAvx512AggKernels(ScalarAggregateFunction* func) {
   AddBasicAggKernels(SumInitAvx512, SignedIntTypes(), int64(), func, SimdLevel::AVX512);
   AddBasicAggKernels(SumInitAvx512, UnsignedIntTypes(), uint64(), func,
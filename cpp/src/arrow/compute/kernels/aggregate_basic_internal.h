@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
 
@@ -55,11 +56,34 @@ void AddSumAvx512AggKernels(ScalarAggregateFunction* func);
 void AddMeanAvx512AggKernels(ScalarAggregateFunction* func);
 void AddMinMaxAvx512AggKernels(ScalarAggregateFunction* func);
 
+Result<std::unique_ptr<FusedAggregator>> MakeFusedAggregatorAvx2(
+    const DataType& type, std::vector<FusableAggregator*> members);
+Result<std::unique_ptr<FusedAggregator>> MakeFusedAggregatorAvx512(
+    const DataType& type, std::vector<FusableAggregator*> members);
+
+// ----------------------------------------------------------------------
+// Basic statistics shared by fused aggregates
+
+template <typename ArrowType>
+struct BasicStats : public BasicStatsBase {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using SumCType =
+      typename TypeTraits<typename FindAccumulatorType<ArrowType>::Type>::CType;
+
+  BasicStats() { this->type_id = ArrowType::type_id; }
+
+  // Sum, min and max of the non-null values (NaNs are ignored by min and max).
+  // min and max are only meaningful if there is at least one non-null value.
+  SumCType sum = 0;
+  CType min{};
+  CType max{};
+};
+
 // ----------------------------------------------------------------------
 // Sum implementation
 
 template <typename ArrowType, SimdLevel::type SimdLevel>
-struct SumImpl : public ScalarAggregator {
+struct SumImpl : public ScalarAggregator, public FusableAggregator {
   using ThisType = SumImpl<ArrowType, SimdLevel>;
   using CType = typename TypeTraits<ArrowType>::CType;
   using SumType = typename FindAccumulatorType<ArrowType>::Type;
@@ -96,6 +120,17 @@ struct SumImpl : public ScalarAggregator {
     return Status::OK();
   }
 
+  void ConsumeStats(const BasicStatsBase& base) override {
+    DCHECK_EQ(base.type_id, ArrowType::type_id);
+    const auto& stats = static_cast<const BasicStats<ArrowType>&>(base);
+    this->count += stats.length - stats.null_count;
+    this->nulls_observed = this->nulls_observed || stats.null_count;
+    if (!options.skip_nulls && this->nulls_observed) {
+      return;
+    }
+    this->sum += stats.sum;
+  }
+
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other = checked_cast<const ThisType&>(src);
     this->count += other.count;
@@ -274,6 +309,33 @@ struct MeanKernelInit : public SumLikeInit<KernelClass> {
 // ----------------------------------------------------------------------
 // MinMax implementation
 
+// Update min and max from contiguous values. Independent lanes are kept so
+// that the loop can be vectorized; NaNs are skipped, like std::fmin/fmax do.
+template <typename T>
+void MinMaxRun(const T* values, int64_t length, T* min, T* max) {
+  constexpr int kLanes = 8;
+  T mins[kLanes];
+  T maxes[kLanes];
+  std::fill(mins, mins + kLanes, *min);
+  std::fill(maxes, maxes + kLanes, *max);
+  int64_t i = 0;
+  for (; i + kLanes <= length; i += kLanes) {
+    for (int j = 0; j < kLanes; ++j) {
+      const T value = values[i + j];
+      mins[j] = value < mins[j] ? value : mins[j];
+      maxes[j] = value > maxes[j] ? value : maxes[j];
+    }
+  }
+  for (; i < length; ++i) {
+    mins[0] = values[i] < mins[0] ? values[i] : mins[0];
+    maxes[0] = values[i] > maxes[0] ? values[i] : maxes[0];
+  }
+  for (int j = 0; j < kLanes; ++j) {
+    *min = mins[j] < *min ? mins[j] : *min;
+    *max = maxes[j] > *max ? maxes[j] : *max;
+  }
+}
+
 template <typename ArrowType, SimdLevel::type SimdLevel, typename Enable = void>
 struct MinMaxState {};
 
@@ -317,6 +379,10 @@ struct MinMaxState<ArrowType, SimdLevel, enable_if_integer<ArrowType>> {
     this->max = std::max(this->max, value);
   }
 
+  void MergeRun(const T* values, int64_t length) {
+    MinMaxRun(values, length, &this->min, &this->max);
+  }
+
   T min = std::numeric_limits<T>::max();
   T max = std::numeric_limits<T>::min();
   bool has_nulls = false;
@@ -340,6 +406,10 @@ struct MinMaxState<ArrowType, SimdLevel, enable_if_floating_point<ArrowType>> {
     this->max = std::fmax(this->max, value);
   }
 
+  void MergeRun(const T* values, int64_t length) {
+    MinMaxRun(values, length, &this->min, &this->max);
+  }
+
   T min = std::numeric_limits<T>::infinity();
   T max = -std::numeric_limits<T>::infinity();
   bool has_nulls = false;
@@ -419,7 +489,7 @@ struct MinMaxState<ArrowType, SimdLevel,
 };
 
 template <typename ArrowType, SimdLevel::type SimdLevel>
-struct MinMaxImpl : public ScalarAggregator {
+struct MinMaxImpl : public ScalarAggregator, public FusableAggregator {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
   using ThisType = MinMaxImpl<ArrowType, SimdLevel>;
   using StateType = MinMaxState<ArrowType, SimdLevel>;
@@ -470,6 +540,8 @@ struct MinMaxImpl : public ScalarAggregator {
     return Status::OK();
   }
 
+  void ConsumeStats(const BasicStatsBase& base) override { ConsumeStatsImpl(base); }
+
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other = checked_cast<const ThisType&>(src);
     this->state += other.state;
@@ -504,6 +576,29 @@ struct MinMaxImpl : public ScalarAggregator {
   MinMaxState<ArrowType, SimdLevel> state;
 
  private:
+  template <typename T = ArrowType>
+  enable_if_t<is_integer_type<T>::value || is_floating_type<T>::value>
+  ConsumeStatsImpl(const BasicStatsBase& base) {
+    DCHECK_EQ(base.type_id, ArrowType::type_id);
+    const auto& stats = static_cast<const BasicStats<ArrowType>&>(base);
+    StateType local;
+    local.has_nulls = stats.null_count > 0;
+    this->count += stats.length - stats.null_count;
+    if (stats.length > stats.null_count && (!local.has_nulls || options.skip_nulls)) {
+      // The batch extrema are already in the state's identity form (e.g. NaN-only
+      // batches keep +inf/-inf), so they are copied rather than merged
+      local.min = stats.min;
+      local.max = stats.max;
+    }
+    this->state += local;
+  }
+
+  template <typename T = ArrowType>
+  enable_if_t<!(is_integer_type<T>::value || is_floating_type<T>::value)>
+  ConsumeStatsImpl(const BasicStatsBase&) {
+    DCHECK(false) << "min_max of " << ArrowType::type_name() << " cannot be fused";
+  }
+
   StateType ConsumeWithNulls(const ArrayType& arr) const {
     StateType local;
     const int64_t length = arr.length();
@@ -624,6 +719,70 @@ struct NullMinMaxImpl : public ScalarAggregator {
   }
 };
 
+// ----------------------------------------------------------------------
+// Fused aggregation
+
+template <typename ArrowType, SimdLevel::type SimdLevel>
+struct FusedBasicAggregator : public FusedAggregator {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using SumCType = typename BasicStats<ArrowType>::SumCType;
+
+  explicit FusedBasicAggregator(std::vector<FusableAggregator*> members)
+      : members(std::move(members)) {}
+
+  Status Consume(const ArraySpan& data) override {
+    BasicStats<ArrowType> stats;
+    stats.length = data.length;
+    stats.null_count = data.GetNullCount();
+
+    // Compute the sum exactly as SumImpl does (including the pairwise
+    // summation of floating point values)
+    stats.sum = SumArray<CType, SumCType, SimdLevel>(data);
+    // Then min/max over the runs of valid values, while the batch is still
+    // in cache
+    MinMaxState<ArrowType, SimdLevel> min_max;
+    const CType* values = data.GetValues<CType>(1);
+    arrow::internal::VisitSetBitRunsVoid(
+        data.buffers[0].data, data.offset, data.length,
+        [&](int64_t pos, int64_t len) { min_max.MergeRun(values + pos, len); });
+    stats.min = min_max.min;
+    stats.max = min_max.max;
+
+    for (auto* member : members) {
+      member->ConsumeStats(stats);
+    }
+    return Status::OK();
+  }
+
+  std::vector<FusableAggregator*> members;
+};
+
+template <SimdLevel::type SimdLevel>
+struct FusedAggregatorInit {
+  std::unique_ptr<FusedAggregator> fused;
+  std::vector<FusableAggregator*> members;
+
+  explicit FusedAggregatorInit(std::vector<FusableAggregator*> members)
+      : members(std::move(members)) {}
+
+  // Other types can't be fused
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  Status Visit(const HalfFloatType&) { return Status::OK(); }
+
+  template <typename Type>
+  enable_if_t<is_integer_type<Type>::value || is_floating_type<Type>::value, Status>
+  Visit(const Type&) {
+    fused.reset(new FusedBasicAggregator<Type, SimdLevel>(std::move(members)));
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<FusedAggregator>> Create(const DataType& type) {
+    RETURN_NOT_OK(VisitTypeInline(type, this));
+    return std::move(fused);
+  }
+};
+
 template <SimdLevel::type SimdLevel>
 struct MinMaxInitState {
   std::unique_ptr<KernelState> state;
@@ -22,6 +22,8 @@
 #include "arrow/array/array_primitive.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/exec/aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/registry.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
@@ -656,6 +658,65 @@ static void CountKernelBenchInt64(benchmark::State& state) {
 }
 BENCHMARK(CountKernelBenchInt64)->Args({1 * 1024 * 1024, 2});  // 1M with 50% null.
 
+//
+// Fused count/sum/mean/min_max of the same column
+//
+
+template <typename ArrowType>
+static void BasicAggregatesBench(benchmark::State& state, bool fused) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(CType);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Numeric<ArrowType>(array_size, -100, 100, args.null_proportion);
+  ExecBatch batch({array}, array_size);
+  ExecSpan span(batch);
+
+  ExecContext exec_ctx;
+  KernelContext kernel_ctx(&exec_ctx);
+  std::vector<const ScalarAggregateKernel*> kernels;
+  std::vector<std::unique_ptr<KernelState>> states;
+  std::vector<KernelState*> raw_states;
+  for (const std::string name : {"count", "sum", "mean", "min_max"}) {
+    ASSIGN_OR_ABORT(auto function, GetFunctionRegistry()->GetFunction(name));
+    ASSIGN_OR_ABORT(auto kernel, function->DispatchExact({array->type()}));
+    kernels.push_back(static_cast<const ScalarAggregateKernel*>(kernel));
+    ASSIGN_OR_ABORT(auto kernel_state,
+                    kernel->init(&kernel_ctx, {kernel, {array->type()},
+                                               function->default_options()}));
+    raw_states.push_back(kernel_state.get());
+    states.push_back(std::move(kernel_state));
+  }
+  ASSIGN_OR_ABORT(auto fused_aggregator,
+                  internal::MakeFusedAggregator(*array->type(), raw_states));
+
+  for (auto _ : state) {
+    if (fused) {
+      ABORT_NOT_OK(fused_aggregator->Consume(span[0].array));
+    } else {
+      for (size_t i = 0; i < kernels.size(); ++i) {
+        kernel_ctx.SetState(states[i].get());
+        ABORT_NOT_OK(kernels[i]->consume(&kernel_ctx, span));
+      }
+    }
+  }
+}
+
+#define BASIC_AGGREGATES_BENCHMARK(FuncName, Type)             \
+  static void FuncName##Separate(benchmark::State& state) {    \
+    BasicAggregatesBench<Type>(state, /*fused=*/false);        \
+  }                                                            \
+  static void FuncName##Fused(benchmark::State& state) {       \
+    BasicAggregatesBench<Type>(state, /*fused=*/true);         \
+  }                                                            \
+  BENCHMARK(FuncName##Separate)->Apply(MinMaxKernelBenchArgs); \
+  BENCHMARK(FuncName##Fused)->Apply(MinMaxKernelBenchArgs)
+
+BASIC_AGGREGATES_BENCHMARK(BasicAggregatesDouble, DoubleType);
+BASIC_AGGREGATES_BENCHMARK(BasicAggregatesInt32, Int32Type);
+BASIC_AGGREGATES_BENCHMARK(BasicAggregatesInt64, Int64Type);
+
 //
 // Variance
 //
@@ -17,10 +17,22 @@
 
 #pragma once
 
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/basic_decimal.h"
 #include "arrow/util/bit_run_reader.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
 #include "arrow/util/int128_internal.h"
 #include "arrow/util/logging.h"
 
@@ -62,6 +74,16 @@ struct FindAccumulatorType<I, enable_if_decimal256<I>> {
   using Type = Decimal256Type;
 };
 
+// Helpers for implementing quantile aggregations, shared between the
+// quantile and hash_quantile kernels
+
+// output is at some input data point, not interpolated
+bool IsDataPoint(const QuantileOptions& options);
+
+// quantile to exact datapoint index (IsDataPoint == true)
+uint64_t QuantileToDataPoint(size_t length, double q,
+                             enum QuantileOptions::Interpolation interpolation);
+
 // Helpers for implementing aggregations on decimals
 
 template <typename Type, typename Enable = void>
@@ -96,6 +118,39 @@ struct ScalarAggregator : public KernelState {
   virtual Status Finalize(KernelContext* ctx, Datum* out) = 0;
 };
 
+// Statistics of an array, computed once and shared by all the aggregates
+// fused together by a FusedAggregator (see BasicStats for the typed part)
+struct BasicStatsBase {
+  Type::type type_id;
+  int64_t length = 0;
+  int64_t null_count = 0;
+};
+
+// Implemented by the aggregators whose state can be updated from the basic
+// statistics of an array rather than from the array itself
+struct FusableAggregator {
+  virtual ~FusableAggregator() = default;
+  virtual void ConsumeStats(const BasicStatsBase& stats) = 0;
+};
+
+// Computes several aggregates of the same column in a single pass over
+// each input array, instead of one pass per aggregate
+class FusedAggregator {
+ public:
+  virtual ~FusedAggregator() = default;
+  virtual Status Consume(const ArraySpan& values) = 0;
+};
+
+/// \brief Fuse the states of aggregates consuming the same column of the given type
+///
+/// Only count, sum, mean, min, max and min_max of integer and floating point
+/// columns can be fused.  Returns nullptr if the type or any of the states
+/// doesn't support fusing.  Scalar inputs must still be consumed through the
+/// kernels of the individual aggregates.
+ARROW_EXPORT
+Result<std::unique_ptr<FusedAggregator>> MakeFusedAggregator(
+    const DataType& type, const std::vector<KernelState*>& states);
+
 // Helper to differentiate between var/std calculation so we can fold
 // kernel implementations together
 enum class VarOrStd : bool { Var, Std };
@@ -114,6 +169,32 @@ void AddAggKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
 
 using arrow::internal::VisitSetBitRunsVoid;
 
+// Helpers for approximate distinct counting: hash a value so that it can be
+// fed to a HyperLogLog sketch.  Floating point values are normalized so that
+// NaNs, and positive and negative zeroes, count as a single value.
+
+inline uint64_t HyperLogLogHash(std::string_view value) {
+  return arrow::internal::HyperLogLog::MixHash(arrow::internal::ComputeStringHash<0>(
+      value.data(), static_cast<int64_t>(value.size())));
+}
+
+template <typename T>
+enable_if_t<!std::is_floating_point<T>::value, uint64_t> HyperLogLogHash(const T& value) {
+  return arrow::internal::HyperLogLog::MixHash(
+      arrow::internal::ComputeStringHash<0>(&value, sizeof(T)));
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, uint64_t> HyperLogLogHash(T value) {
+  if (std::isnan(value)) {
+    value = std::numeric_limits<T>::quiet_NaN();
+  } else if (value == 0) {
+    value = 0;
+  }
+  return arrow::internal::HyperLogLog::MixHash(
+      arrow::internal::ComputeStringHash<0>(&value, sizeof(T)));
+}
+
 template <typename T, typename Enable = void>
 struct GetSumType;
 
@@ -235,11 +316,56 @@ enable_if_t<!std::is_floating_point<SumType>::value, SumType> SumArray(
 }
 
 template <typename ValueType, typename SumType, SimdLevel::type SimdLevel>
-SumType SumArray(const ArraySpan& data) {
+enable_if_t<!std::is_base_of<BasicDecimal128, ValueType>::value &&
+                !std::is_base_of<BasicDecimal256, ValueType>::value,
+            SumType>
+SumArray(const ArraySpan& data) {
   return SumArray<ValueType, SumType, SimdLevel>(
       data, [](ValueType v) { return static_cast<SumType>(v); });
 }
 
+// summation for decimals: rather than adding multi-word decimals one at a time,
+// each 64-bit word of the values is accumulated in its own lane, counting the
+// carries out of it, which the compiler can vectorize. The lanes are combined
+// once at the end, the result wraps around exactly like decimal additions.
+template <typename ValueType, typename SumType, SimdLevel::type SimdLevel>
+enable_if_t<std::is_base_of<BasicDecimal128, ValueType>::value ||
+                std::is_base_of<BasicDecimal256, ValueType>::value,
+            SumType>
+SumArray(const ArraySpan& data) {
+  using arrow::internal::VisitSetBitRunsVoid;
+  using WordArray = typename SumType::WordArray;
+  constexpr int kNumWords = static_cast<int>(std::tuple_size<WordArray>::value);
+
+  WordArray sums{};
+  WordArray carries{};
+  const uint64_t* words = data.GetValues<uint64_t>(1, data.offset * kNumWords);
+  VisitSetBitRunsVoid(data.buffers[0].data, data.offset, data.length,
+                      [&](int64_t pos, int64_t len) {
+                        const uint64_t* v = words + pos * kNumWords;
+                        for (int64_t i = 0; i < len; ++i, v += kNumWords) {
+                          for (int k = 0; k < kNumWords; ++k) {
+                            sums[k] += v[k];
+                            carries[k] += sums[k] < v[k];
+                          }
+                        }
+                      });
+
+  // native word k weighs 2^(64 * k) on little-endian platforms
+  SumType sum = 0;
+  for (int k = 0; k < kNumWords; ++k) {
+    const int position = ARROW_LITTLE_ENDIAN ? k : kNumWords - 1 - k;
+    WordArray word{}, carry{};
+    word[position] = sums[k];
+    if (position + 1 < kNumWords) {
+      carry[position + 1] = carries[k];
+    }
+    sum += SumType(SumType::LittleEndianArray, word);
+    sum += SumType(SumType::LittleEndianArray, carry);
+  }
+  return sum;
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
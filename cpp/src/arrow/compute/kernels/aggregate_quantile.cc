@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/stl_allocator.h"
@@ -28,10 +29,6 @@ namespace arrow {
 namespace compute {
 namespace internal {
 
-namespace {
-
-using QuantileState = internal::OptionsWrapper<QuantileOptions>;
-
 // output is at some input data point, not interpolated
 bool IsDataPoint(const QuantileOptions& options) {
   // some interpolation methods return exact data point
@@ -72,6 +69,10 @@ uint64_t QuantileToDataPoint(size_t length, double q,
   return datapoint_index;
 }
 
+namespace {
+
+using QuantileState = internal::OptionsWrapper<QuantileOptions>;
+
 template <typename T>
 double DataPointToDouble(T value, const DataType&) {
   return static_cast<double>(value);
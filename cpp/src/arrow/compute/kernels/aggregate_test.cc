@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <type_traits>
@@ -40,6 +41,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_overflow.h"
 
+#include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/testing/random.h"
@@ -534,6 +536,31 @@ TEST(TestDecimalSumKernel, SimpleSum) {
   }
 }
 
+TEST(TestDecimalSumKernel, CarryAcrossWords) {
+  // Decimal words are summed in separate lanes, check that carries propagate
+  auto ty = decimal128(38, 0);
+  auto arr = ArrayFromJSON(ty, R"(["18446744073709551615", "18446744073709551615",
+                                   null, "-1", "99999999999999999999999999999999999999",
+                                   "-99999999999999999999999999999999999999",
+                                   "-18446744073709551616"])");
+  EXPECT_THAT(Sum(arr), ResultWith(ScalarFromJSON(ty, R"(null)")));
+  EXPECT_THAT(Sum(arr, ScalarAggregateOptions(/*skip_nulls=*/true, /*min_count=*/0)),
+              ResultWith(ScalarFromJSON(ty, R"("18446744073709551613")")));
+  EXPECT_THAT(Sum(arr->Slice(3)),
+              ResultWith(ScalarFromJSON(ty, R"("-18446744073709551617")")));
+
+  ty = decimal256(76, 0);
+  arr = ArrayFromJSON(
+      ty, R"(["340282366920938463463374607431768211455",
+              "340282366920938463463374607431768211455",
+              "6277101735386680763835789423207666416102355444464034512895",
+              "-1"])");
+  EXPECT_THAT(
+      Sum(arr),
+      ResultWith(ScalarFromJSON(
+          ty, R"("6277101735386680764516354157049543343029104659327570935804")")));
+}
+
 TEST(TestDecimalSumKernel, ScalarAggregateOptions) {
   for (const auto& ty : {decimal128(3, 2), decimal256(3, 2)}) {
     Datum null = ScalarFromJSON(ty, R"(null)");
@@ -1140,6 +1167,169 @@ TEST_F(TestCountDistinctKernel, Random) {
   Check(input, memo.size(), false);
 }
 
+//
+// Approximate Count Distinct
+//
+
+class TestApproxCountDistinctKernel : public ::testing::Test {
+ protected:
+  Datum Expected(int64_t value) { return MakeScalar(static_cast<int64_t>(value)); }
+
+  // Small cardinalities are estimated exactly by the sparse representation
+  void Check(Datum input, int64_t expected_all, bool has_nulls = true) {
+    int64_t expected_valid = has_nulls ? expected_all - 1 : expected_all;
+    int64_t expected_null = has_nulls ? 1 : 0;
+    CheckScalar("approx_count_distinct", {input}, Expected(expected_valid),
+                &only_valid);
+    CheckScalar("approx_count_distinct", {input}, Expected(expected_null), &only_null);
+    CheckScalar("approx_count_distinct", {input}, Expected(expected_all), &all);
+  }
+
+  void Check(const std::shared_ptr<DataType>& type, std::string_view json,
+             int64_t expected_all, bool has_nulls = true) {
+    Check(ArrayFromJSON(type, json), expected_all, has_nulls);
+  }
+
+  ApproxCountDistinctOptions only_valid{CountOptions::ONLY_VALID};
+  ApproxCountDistinctOptions only_null{CountOptions::ONLY_NULL};
+  ApproxCountDistinctOptions all{CountOptions::ALL};
+};
+
+TEST_F(TestApproxCountDistinctKernel, AllArrayTypesWithNulls) {
+  Check(boolean(), "[]", 0, /*has_nulls=*/false);
+  Check(boolean(), "[true, null, false, null, false, true]", 3);
+  for (auto ty : NumericTypes()) {
+    Check(ty, "[1, 1, null, 2, 5, 8, 9, 9, null, 10, 6, 6]", 8);
+    Check(ty, "[1, 1, 8, 2, 5, 8, 9, 9, 10, 10, 6, 6]", 7, /*has_nulls=*/false);
+  }
+  Check(date32(), "[0, 11016, 0, null, 14241, 14241, null]", 4);
+  Check(time64(TimeUnit::NANO), "[11715003000000,  0, null, 0, 0]", 3);
+  for (auto u : TimeUnit::values()) {
+    Check(duration(u), "[123456789, null, 987654321, 123456789, null]", 3);
+    auto ts = R"(["2009-12-31T04:20:20", "2020-01-01", null, "2009-12-31T04:20:20"])";
+    Check(timestamp(u, "Pacific/Marquesas"), ts, 3);
+  }
+  Check(month_interval(), "[9012, 5678, null, 9012, 5678, null, 9012]", 3);
+  Check(day_time_interval(), "[[0, 1], [0, 1], null, [0, 1], [1234, 5678]]", 3);
+  Check(month_day_nano_interval(), "[[0, 1, 2], [0, 1, 2], null, [0, 1, 2]]", 2);
+  auto samples = R"([null, "abc", null, "abc", "abc", "cba", "bca", "cba", null])";
+  Check(binary(), samples, 4);
+  Check(large_utf8(), samples, 4);
+  Check(fixed_size_binary(3), samples, 4);
+  samples = R"(["12345.679", "98765.421", null, "12345.679", "98765.421"])";
+  Check(decimal128(21, 3), samples, 3);
+  Check(decimal256(13, 3), samples, 3);
+}
+
+TEST_F(TestApproxCountDistinctKernel, ChunkedArrayAndScalar) {
+  Check(ChunkedArrayFromJSON(int64(), {"[1, 1, null, 2]", "[5, 8, 9, 9, null]", "[2]"}),
+        6);
+  Check(ChunkedArrayFromJSON(utf8(), {"[]", R"(["a", "b"])", R"(["b", "c"])"}), 3,
+        /*has_nulls=*/false);
+  EXPECT_THAT(CallFunction("approx_count_distinct", {ScalarFromJSON(int32(), "5")}, &all),
+              ResultWith(Expected(1)));
+  EXPECT_THAT(CallFunction("approx_count_distinct", {MakeNullScalar(int32())}, &all),
+              ResultWith(Expected(1)));
+  EXPECT_THAT(
+      CallFunction("approx_count_distinct", {MakeNullScalar(int32())}, &only_valid),
+      ResultWith(Expected(0)));
+}
+
+TEST_F(TestApproxCountDistinctKernel, FloatingPointNormalization) {
+  Check(float64(), "[0.0, -0.0, NaN, NaN, 1.5, null]", 4);
+  Check(float32(), "[0.0, -0.0, NaN, NaN, 1.5, null]", 4);
+}
+
+TEST_F(TestApproxCountDistinctKernel, LargeCardinality) {
+  for (int32_t precision : {10, 14}) {
+    ARROW_SCOPED_TRACE("precision = ", precision);
+    const int64_t num_distinct = 200000;
+    Int64Builder builder;
+    for (int64_t i = 0; i < num_distinct; ++i) {
+      ASSERT_OK(builder.Append(i * 7919));
+    }
+    ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+    // Values are repeated across chunks
+    auto input = std::make_shared<ChunkedArray>(
+        ArrayVector{values, values->Slice(num_distinct / 2), values});
+
+    ApproxCountDistinctOptions options(CountOptions::ONLY_VALID, precision);
+    ASSERT_OK_AND_ASSIGN(Datum result,
+                         CallFunction("approx_count_distinct", {input}, &options));
+    const double relative_error =
+        4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    ASSERT_NEAR(static_cast<double>(result.scalar_as<Int64Scalar>().value),
+                static_cast<double>(num_distinct), num_distinct * relative_error);
+  }
+}
+
+TEST_F(TestApproxCountDistinctKernel, SketchAndMerge) {
+  auto sketch = [](const Datum& input, int32_t precision) -> Result<Datum> {
+    ApproxCountDistinctOptions options(CountOptions::ONLY_VALID, precision);
+    return CallFunction("approx_count_distinct_sketch", {input}, &options);
+  };
+  auto merge = [](const std::vector<Datum>& sketches) -> Result<Datum> {
+    ScalarVector scalars;
+    for (const auto& sketch : sketches) {
+      EXPECT_EQ(*sketch.type(), *binary());
+      scalars.push_back(sketch.scalar());
+    }
+    // Null sketches are ignored
+    scalars.push_back(MakeNullScalar(binary()));
+    ARROW_ASSIGN_OR_RAISE(auto sketch_array, ScalarVectorToArray(scalars));
+    return CallFunction("approx_count_distinct_merge", {sketch_array});
+  };
+
+  // Small cardinalities are estimated exactly, nulls are not recorded
+  ASSERT_OK_AND_ASSIGN(auto left, sketch(ArrayFromJSON(utf8(), R"(["a", "b", null])"),
+                                         /*precision=*/14));
+  ASSERT_OK_AND_ASSIGN(auto right, sketch(ArrayFromJSON(utf8(), R"(["b", "c"])"),
+                                          /*precision=*/14));
+  EXPECT_THAT(merge({left, right}), ResultWith(Expected(3)));
+  EXPECT_THAT(merge({}), ResultWith(Expected(0)));
+  EXPECT_THAT(CallFunction("approx_count_distinct_merge",
+                           {ScalarFromJSON(binary(), "null")}),
+              ResultWith(Expected(0)));
+
+  for (int32_t precision : {10, 14}) {
+    ARROW_SCOPED_TRACE("precision = ", precision);
+    const int64_t num_distinct = 200000;
+    Int64Builder builder;
+    for (int64_t i = 0; i < num_distinct; ++i) {
+      ASSERT_OK(builder.Append(i * 7919));
+    }
+    ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+
+    // The two halves overlap
+    ASSERT_OK_AND_ASSIGN(left, sketch(values->Slice(0, num_distinct * 3 / 4), precision));
+    ASSERT_OK_AND_ASSIGN(right, sketch(values->Slice(num_distinct / 4), precision));
+    ASSERT_OK_AND_ASSIGN(Datum result, merge({left, right}));
+    const double relative_error =
+        4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    ASSERT_NEAR(static_cast<double>(result.scalar_as<Int64Scalar>().value),
+                static_cast<double>(num_distinct), num_distinct * relative_error);
+  }
+
+  // Sketches of different precisions cannot be merged
+  ASSERT_OK_AND_ASSIGN(right, sketch(ArrayFromJSON(utf8(), R"(["b", "c"])"),
+                                     /*precision=*/10));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("different precisions"), merge({left, right}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("HyperLogLog"),
+      CallFunction("approx_count_distinct_merge", {ArrayFromJSON(binary(), R"(["x"])")}));
+}
+
+TEST_F(TestApproxCountDistinctKernel, InvalidPrecision) {
+  auto input = ArrayFromJSON(int32(), "[1, 2]");
+  for (int32_t precision : {0, 3, 19}) {
+    ApproxCountDistinctOptions options(CountOptions::ONLY_VALID, precision);
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("HyperLogLog precision must be between 4 and 18"),
+        CallFunction("approx_count_distinct", {input}, &options));
+  }
+}
+
 //
 // Mean
 //
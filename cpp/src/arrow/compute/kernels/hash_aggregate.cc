@@ -15,15 +15,19 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/buffer_builder.h"
@@ -47,8 +51,11 @@
 #include "arrow/util/bitmap_writer.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
 #include "arrow/util/int128_internal.h"
 #include "arrow/util/int_util_overflow.h"
+#include "arrow/util/kll.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/tdigest.h"
 #include "arrow/util/thread_pool.h"
@@ -1255,6 +1262,381 @@ HashAggregateKernel MakeApproximateMedianKernel(HashAggregateFunction* tdigest_f
   return kernel;
 }
 
+// ----------------------------------------------------------------------
+// Exact quantile implementation
+
+Status CheckQuantiles(const std::vector<double>& q) {
+  if (q.empty()) {
+    return Status::Invalid("Requires quantile argument");
+  }
+  for (double v : q) {
+    if (v < 0 || v > 1) {
+      return Status::Invalid("Quantile must be between 0 and 1");
+    }
+  }
+  return Status::OK();
+}
+
+// The state is kept as two flat, append-only columns (group ids and values)
+// rather than one container per group: consuming and merging only append to
+// them, and they can be partitioned by group when finalizing.
+template <typename Type>
+struct GroupedQuantileImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    options_ = *checked_cast<const QuantileOptions*>(args.options);
+    RETURN_NOT_OK(CheckQuantiles(options_.q));
+    type_ = args.inputs[0].GetSharedPtr();
+    if (is_decimal_type<Type>::value) {
+      decimal_scale_ = checked_cast<const DecimalType&>(*type_).scale();
+    } else {
+      decimal_scale_ = 0;
+    }
+    pool_ = ctx->memory_pool();
+    group_ids_ = TypedBufferBuilder<uint32_t>(pool_);
+    values_ = TypedBufferBuilder<CType>(pool_);
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    no_nulls_ = TypedBufferBuilder<bool>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    const int64_t added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(counts_.Append(added_groups, 0));
+    RETURN_NOT_OK(no_nulls_.Append(added_groups, true));
+    return Status::OK();
+  }
+
+  template <typename T>
+  double ToDouble(T value) const {
+    return static_cast<double>(value);
+  }
+  double ToDouble(const Decimal128& value) const {
+    return value.ToDouble(decimal_scale_);
+  }
+  double ToDouble(const Decimal256& value) const {
+    return value.ToDouble(decimal_scale_);
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    RETURN_NOT_OK(group_ids_.Reserve(batch.length));
+    RETURN_NOT_OK(values_.Reserve(batch.length));
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, CType value) {
+          // NaNs are ignored, like in the quantile function
+          if (is_floating_type<Type>::value && value != value) return;
+          group_ids_.UnsafeAppend(g);
+          values_.UnsafeAppend(value);
+          counts[g]++;
+        },
+        [&](uint32_t g) { bit_util::SetBitTo(no_nulls, g, false); });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedQuantileImpl*>(&raw_other);
+
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+
+    const int64_t* other_counts = other->counts_.data();
+    const uint8_t* other_no_nulls = other->no_nulls_.data();
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      counts[g[other_g]] += other_counts[other_g];
+      bit_util::SetBitTo(no_nulls, g[other_g],
+                         bit_util::GetBit(no_nulls, g[other_g]) &&
+                             bit_util::GetBit(other_no_nulls, other_g));
+    }
+
+    const int64_t other_length = other->values_.length();
+    RETURN_NOT_OK(group_ids_.Reserve(other_length));
+    RETURN_NOT_OK(values_.Reserve(other_length));
+    const uint32_t* other_group_ids = other->group_ids_.data();
+    const CType* other_values = other->values_.data();
+    for (int64_t i = 0; i < other_length; ++i) {
+      group_ids_.UnsafeAppend(g[other_group_ids[i]]);
+      values_.UnsafeAppend(other_values[i]);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const bool is_datapoint = IsDataPoint(options_);
+    const int64_t slot_length = options_.q.size();
+    const int64_t num_values = num_groups_ * slot_length;
+    const int64_t* counts = counts_.data();
+    const uint8_t* no_nulls = no_nulls_.data();
+
+    // Partition the values by group (counting sort on the group ids)
+    std::vector<int64_t> offsets(num_groups_ + 1, 0);
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      offsets[i + 1] = offsets[i] + counts[i];
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> partitioned_buffer,
+                          AllocateBuffer(values_.length() * sizeof(CType), pool_));
+    CType* partitioned = reinterpret_cast<CType*>(partitioned_buffer->mutable_data());
+    {
+      std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+      const uint32_t* group_ids = group_ids_.data();
+      const CType* values = values_.data();
+      for (int64_t i = 0; i < values_.length(); ++i) {
+        partitioned[positions[group_ids[i]]++] = values[i];
+      }
+    }
+    group_ids_.Reset();
+    values_.Reset();
+
+    const int64_t value_width = is_datapoint ? sizeof(CType) : sizeof(double);
+    std::shared_ptr<Buffer> null_bitmap;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(num_values * value_width, pool_));
+    std::memset(values->mutable_data(), 0, values->size());
+    int64_t null_count = 0;
+
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      if (counts[i] > 0 && counts[i] >= options_.min_count &&
+          (options_.skip_nulls || bit_util::GetBit(no_nulls, i))) {
+        // Sorting the group once serves all requested quantiles
+        CType* begin = partitioned + offsets[i];
+        std::sort(begin, begin + counts[i]);
+        if (is_datapoint) {
+          CType* results = reinterpret_cast<CType*>(values->mutable_data());
+          for (int64_t j = 0; j < slot_length; j++) {
+            results[i * slot_length + j] = begin[QuantileToDataPoint(
+                counts[i], options_.q[j], options_.interpolation)];
+          }
+        } else {
+          double* results = reinterpret_cast<double*>(values->mutable_data());
+          for (int64_t j = 0; j < slot_length; j++) {
+            results[i * slot_length + j] = InterpolateQuantile(begin, counts[i], j);
+          }
+        }
+        continue;
+      }
+
+      if (!null_bitmap) {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_values, pool_));
+        bit_util::SetBitsTo(null_bitmap->mutable_data(), 0, num_values, true);
+      }
+      null_count += slot_length;
+      bit_util::SetBitsTo(null_bitmap->mutable_data(), i * slot_length, slot_length,
+                          false);
+    }
+
+    auto child =
+        ArrayData::Make(is_datapoint ? type_ : float64(), num_values,
+                        {std::move(null_bitmap), std::move(values)}, null_count);
+    return ArrayData::Make(out_type(), num_groups_, {nullptr}, {std::move(child)},
+                           /*null_count=*/0);
+  }
+
+  // interpolate the j-th quantile from the sorted group values
+  double InterpolateQuantile(const CType* sorted, int64_t length, int64_t j) const {
+    const double index = (length - 1) * options_.q[j];
+    const int64_t lower_index = static_cast<int64_t>(index);
+    const double fraction = index - lower_index;
+    const double lower_value = ToDouble(sorted[lower_index]);
+    if (fraction == 0) {
+      return lower_value;
+    }
+    const double higher_value = ToDouble(sorted[lower_index + 1]);
+    if (options_.interpolation == QuantileOptions::LINEAR) {
+      // more stable than naive linear interpolation
+      return fraction * higher_value + (1 - fraction) * lower_value;
+    }
+    DCHECK_EQ(options_.interpolation, QuantileOptions::MIDPOINT);
+    return lower_value / 2 + higher_value / 2;
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return fixed_size_list(IsDataPoint(options_) ? type_ : float64(),
+                           static_cast<int32_t>(options_.q.size()));
+  }
+
+  QuantileOptions options_;
+  std::shared_ptr<DataType> type_;
+  int32_t decimal_scale_;
+  int64_t num_groups_ = 0;
+  TypedBufferBuilder<uint32_t> group_ids_;
+  TypedBufferBuilder<CType> values_;
+  TypedBufferBuilder<int64_t> counts_;
+  TypedBufferBuilder<bool> no_nulls_;
+  MemoryPool* pool_;
+};
+
+// ----------------------------------------------------------------------
+// KLL quantile implementation
+
+using arrow::internal::KllSketch;
+
+template <typename Type>
+struct GroupedKllQuantileImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    options_ = *checked_cast<const KllQuantileOptions*>(args.options);
+    RETURN_NOT_OK(CheckQuantiles(options_.q));
+    if (options_.k < 8) {
+      return Status::Invalid("KLL parameter k must be at least 8, got ", options_.k);
+    }
+    if (is_decimal_type<Type>::value) {
+      decimal_scale_ = checked_cast<const DecimalType&>(*args.inputs[0].type).scale();
+    } else {
+      decimal_scale_ = 0;
+    }
+    pool_ = ctx->memory_pool();
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    no_nulls_ = TypedBufferBuilder<bool>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    const int64_t added_groups = new_num_groups - sketches_.size();
+    sketches_.reserve(new_num_groups);
+    for (int64_t i = 0; i < added_groups; i++) {
+      sketches_.emplace_back(options_.k);
+    }
+    RETURN_NOT_OK(counts_.Append(added_groups, 0));
+    RETURN_NOT_OK(no_nulls_.Append(added_groups, true));
+    return Status::OK();
+  }
+
+  template <typename T>
+  double ToDouble(T value) const {
+    return static_cast<double>(value);
+  }
+  double ToDouble(const Decimal128& value) const {
+    return value.ToDouble(decimal_scale_);
+  }
+  double ToDouble(const Decimal256& value) const {
+    return value.ToDouble(decimal_scale_);
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, CType value) {
+          const double v = ToDouble(value);
+          // NaNs are ignored, like in the quantile function
+          if (std::isnan(v)) return;
+          sketches_[g].Add(v);
+          counts[g]++;
+        },
+        [&](uint32_t g) { bit_util::SetBitTo(no_nulls, g, false); });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedKllQuantileImpl*>(&raw_other);
+
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+
+    const int64_t* other_counts = other->counts_.data();
+    const uint8_t* other_no_nulls = other->no_nulls_.data();
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      sketches_[*g].Merge(other->sketches_[other_g]);
+      counts[*g] += other_counts[other_g];
+      bit_util::SetBitTo(
+          no_nulls, *g,
+          bit_util::GetBit(no_nulls, *g) && bit_util::GetBit(other_no_nulls, other_g));
+    }
+
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t slot_length = options_.q.size();
+    const int64_t num_values = sketches_.size() * slot_length;
+    const int64_t* counts = counts_.data();
+    std::shared_ptr<Buffer> null_bitmap;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(num_values * sizeof(double), pool_));
+    int64_t null_count = 0;
+
+    double* results = reinterpret_cast<double*>(values->mutable_data());
+    for (int64_t i = 0; static_cast<size_t>(i) < sketches_.size(); ++i) {
+      if (!sketches_[i].is_empty() && counts[i] >= options_.min_count &&
+          (options_.skip_nulls || bit_util::GetBit(no_nulls_.data(), i))) {
+        const std::vector<double> quantiles = sketches_[i].Quantiles(options_.q);
+        std::copy(quantiles.begin(), quantiles.end(), &results[i * slot_length]);
+        continue;
+      }
+
+      if (!null_bitmap) {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_values, pool_));
+        bit_util::SetBitsTo(null_bitmap->mutable_data(), 0, num_values, true);
+      }
+      null_count += slot_length;
+      bit_util::SetBitsTo(null_bitmap->mutable_data(), i * slot_length, slot_length,
+                          false);
+      std::fill(&results[i * slot_length], &results[(i + 1) * slot_length], 0.0);
+    }
+
+    auto child = ArrayData::Make(float64(), num_values,
+                                 {std::move(null_bitmap), std::move(values)}, null_count);
+    return ArrayData::Make(out_type(), sketches_.size(), {nullptr}, {std::move(child)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return fixed_size_list(float64(), static_cast<int32_t>(options_.q.size()));
+  }
+
+  KllQuantileOptions options_;
+  int32_t decimal_scale_;
+  std::vector<KllSketch> sketches_;
+  TypedBufferBuilder<int64_t> counts_;
+  TypedBufferBuilder<bool> no_nulls_;
+  MemoryPool* pool_;
+};
+
+template <template <typename> class Impl>
+struct GroupedQuantileFactory {
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<Impl<T>>);
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_decimal<T, Status> Visit(const T&) {
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<Impl<T>>);
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Computing quantiles of data of type ", type);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Computing quantiles of data of type ", type);
+  }
+
+  static Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
+    GroupedQuantileFactory factory;
+    factory.argument_type = type->id();
+    RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+    return std::move(factory.kernel);
+  }
+
+  HashAggregateKernel kernel;
+  InputType argument_type;
+};
+
 // ----------------------------------------------------------------------
 // MinMax implementation
 
@@ -2025,6 +2407,239 @@ Result<std::unique_ptr<KernelState>> GroupedDistinctInit(KernelContext* ctx,
   return std::move(impl);
 }
 
+// ----------------------------------------------------------------------
+// ApproxCountDistinct implementation
+
+using arrow::internal::HyperLogLog;
+
+template <typename Type>
+struct GroupedApproxCountDistinctImpl : public GroupedAggregator {
+  using ViewType = typename GetViewType<Type>::T;
+
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    options_ = checked_cast<const ApproxCountDistinctOptions&>(*args.options);
+    if (options_.precision < HyperLogLog::kMinPrecision ||
+        options_.precision > HyperLogLog::kMaxPrecision) {
+      return Status::Invalid("HyperLogLog precision must be between ",
+                             HyperLogLog::kMinPrecision, " and ",
+                             HyperLogLog::kMaxPrecision, ", got ", options_.precision);
+    }
+    pool_ = ctx->memory_pool();
+    has_nulls_ = TypedBufferBuilder<bool>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    const int64_t added_groups = new_num_groups - sketches_.size();
+    sketches_.reserve(new_num_groups);
+    for (int64_t i = 0; i < added_groups; i++) {
+      sketches_.emplace_back(options_.precision);
+    }
+    return has_nulls_.Append(added_groups, false);
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    uint8_t* has_nulls = has_nulls_.mutable_data();
+    return VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, ViewType value) {
+          sketches_[g].Add(HyperLogLogHash(value));
+          return Status::OK();
+        },
+        [&](uint32_t g) {
+          bit_util::SetBit(has_nulls, g);
+          return Status::OK();
+        });
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedApproxCountDistinctImpl*>(&raw_other);
+
+    uint8_t* has_nulls = has_nulls_.mutable_data();
+    const uint8_t* other_has_nulls = other->has_nulls_.data();
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      RETURN_NOT_OK(sketches_[*g].Merge(other->sketches_[other_g]));
+      if (bit_util::GetBit(other_has_nulls, other_g)) {
+        bit_util::SetBit(has_nulls, *g);
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t num_groups = static_cast<int64_t>(sketches_.size());
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(num_groups * sizeof(int64_t), pool_));
+    int64_t* counts = reinterpret_cast<int64_t*>(values->mutable_data());
+    const uint8_t* has_nulls = has_nulls_.data();
+
+    for (int64_t i = 0; i < num_groups; ++i) {
+      const int64_t nulls = bit_util::GetBit(has_nulls, i) ? 1 : 0;
+      switch (options_.mode) {
+        case CountOptions::ONLY_VALID:
+          counts[i] = std::llround(sketches_[i].Estimate());
+          break;
+        case CountOptions::ALL:
+          counts[i] = std::llround(sketches_[i].Estimate()) + nulls;
+          break;
+        case CountOptions::ONLY_NULL:
+          counts[i] = nulls;
+          break;
+      }
+    }
+    return ArrayData::Make(int64(), num_groups, {nullptr, std::move(values)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+  ApproxCountDistinctOptions options_;
+  MemoryPool* pool_;
+  std::vector<HyperLogLog> sketches_;
+  TypedBufferBuilder<bool> has_nulls_;
+};
+
+// Output the serialized sketch of each group instead of its estimate, to be merged
+// later by hash_approx_count_distinct_merge
+template <typename Type>
+struct GroupedApproxCountDistinctSketchImpl
+    : public GroupedApproxCountDistinctImpl<Type> {
+  Result<Datum> Finalize() override {
+    BinaryBuilder builder(this->pool_);
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(this->sketches_.size())));
+    for (const auto& sketch : this->sketches_) {
+      RETURN_NOT_OK(builder.Append(sketch.Serialize()));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto sketches, builder.Finish());
+    return sketches->data();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return binary(); }
+};
+
+// Merge the sketches output by hash_approx_count_distinct_sketch and estimate the
+// number of distinct values of each group
+struct GroupedApproxCountDistinctMergeImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const KernelInitArgs&) override {
+    pool_ = ctx->memory_pool();
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    sketches_.resize(new_num_groups);
+    return Status::OK();
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    return VisitGroupedValues<BinaryType>(
+        batch,
+        [&](uint32_t g, std::string_view data) {
+          ARROW_ASSIGN_OR_RAISE(auto sketch, HyperLogLog::Deserialize(data));
+          return MergeSketch(g, std::move(sketch));
+        },
+        [](uint32_t) { return Status::OK(); });
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedApproxCountDistinctMergeImpl*>(&raw_other);
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      if (other->sketches_[other_g].has_value()) {
+        RETURN_NOT_OK(MergeSketch(*g, std::move(*other->sketches_[other_g])));
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t num_groups = static_cast<int64_t>(sketches_.size());
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(num_groups * sizeof(int64_t), pool_));
+    int64_t* counts = reinterpret_cast<int64_t*>(values->mutable_data());
+
+    for (int64_t i = 0; i < num_groups; ++i) {
+      counts[i] =
+          sketches_[i].has_value() ? std::llround(sketches_[i]->Estimate()) : 0;
+    }
+    return ArrayData::Make(int64(), num_groups, {nullptr, std::move(values)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+  Status MergeSketch(uint32_t g, HyperLogLog sketch) {
+    if (!sketches_[g].has_value()) {
+      sketches_[g] = std::move(sketch);
+      return Status::OK();
+    }
+    return sketches_[g]->Merge(sketch);
+  }
+
+  MemoryPool* pool_;
+  // Unset until the group's first sketch, whose precision the others must share
+  std::vector<std::optional<HyperLogLog>> sketches_;
+};
+
+template <template <typename> class Impl>
+struct GroupedApproxCountDistinctFactory {
+  template <typename T>
+  enable_if_physical_integer<T, Status> Visit(const T&) {
+    using PhysicalType = typename T::PhysicalType;
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<Impl<PhysicalType>>);
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<is_physical_floating_type<T>::value || is_decimal_type<T>::value ||
+                  is_base_binary_type<T>::value,
+              Status>
+  Visit(const T&) {
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<Impl<T>>);
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<std::is_same<T, BooleanType>::value ||
+                  std::is_same<T, FixedSizeBinaryType>::value ||
+                  std::is_same<T, DayTimeIntervalType>::value ||
+                  std::is_same<T, MonthDayNanoIntervalType>::value,
+              Status>
+  Visit(const T&) {
+    kernel = MakeKernel(std::move(argument_type), HashAggregateInit<Impl<T>>);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Approximately counting distinct values of type ",
+                                  type);
+  }
+
+  static Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
+    GroupedApproxCountDistinctFactory<Impl> factory;
+    factory.argument_type = type->id();
+    RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+    return std::move(factory.kernel);
+  }
+
+  HashAggregateKernel kernel;
+  InputType argument_type;
+};
+
+std::vector<std::shared_ptr<DataType>> ApproxCountDistinctTypes() {
+  std::vector<std::shared_ptr<DataType>> types = NumericTypes();
+  types.insert(types.end(), TemporalTypes().begin(), TemporalTypes().end());
+  types.insert(types.end(), BaseBinaryTypes().begin(), BaseBinaryTypes().end());
+  types.insert(types.end(),
+               {boolean(), decimal128(1, 1), decimal256(1, 1), month_interval(),
+                day_time_interval(), month_day_nano_interval(), fixed_size_binary(1)});
+  return types;
+}
+
 // ----------------------------------------------------------------------
 // One implementation
 
@@ -2724,6 +3339,194 @@ struct GroupedListFactory {
   HashAggregateKernel kernel;
   InputType argument_type;
 };
+
+// ----------------------------------------------------------------------
+// Pivot implementation
+
+template <typename KeyType>
+struct GroupedPivotImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    ctx_ = ctx;
+    if (args.options == nullptr) {
+      return Status::Invalid("hash_pivot_wider requires PivotWiderOptions");
+    }
+    options_ = *checked_cast<const PivotWiderOptions*>(args.options);
+    num_keys_ = static_cast<int64_t>(options_.key_names.size());
+    value_type_ = args.inputs[1].GetSharedPtr();
+    FieldVector fields;
+    fields.reserve(num_keys_);
+    for (const auto& key_name : options_.key_names) {
+      fields.push_back(field(key_name, value_type_));
+    }
+    out_type_ = struct_(std::move(fields));
+    indices_ = TypedBufferBuilder<int64_t>(ctx_->memory_pool());
+    RETURN_NOT_OK(MakeBuilder(ctx_->memory_pool(), value_type_, &values_builder_));
+
+    // The key names are assigned the ids [0, num_keys) in the order of the
+    // output fields; other keys are only looked up, never inserted
+    key_names_ = std::make_unique<MemoTable>(ctx_->memory_pool(), num_keys_);
+    for (const auto& key_name : options_.key_names) {
+      int32_t unused_memo_index;
+      RETURN_NOT_OK(key_names_->GetOrInsert(key_name, &unused_memo_index));
+    }
+    if (key_names_->size() != num_keys_) {
+      return Status::Invalid("Duplicate key name in PivotWiderOptions");
+    }
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    return indices_.Append(added_groups * num_keys_, -1);
+  }
+
+  // The id of a key name, or -1 if the key is unexpected and ignored
+  Result<int32_t> LookupKey(std::string_view key) const {
+    const int32_t key_id = key_names_->Get(key);
+    if (key_id == ::arrow::internal::kKeyNotFound &&
+        options_.unexpected_key_behavior == PivotWiderOptions::kRaise) {
+      return Status::KeyError("Unexpected pivot key: ", key);
+    }
+    return key_id;
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    const int64_t length = batch.length;
+    // -1 for null and ignored keys
+    std::vector<int32_t> key_ids(length, -1);
+    if (batch[0].is_scalar()) {
+      const Scalar& key = *batch[0].scalar;
+      if (key.is_valid) {
+        ARROW_ASSIGN_OR_RAISE(int32_t key_id,
+                              LookupKey(UnboxScalar<KeyType>::Unbox(key)));
+        std::fill(key_ids.begin(), key_ids.end(), key_id);
+      }
+    } else {
+      int64_t i = 0;
+      RETURN_NOT_OK(VisitArraySpanInline<KeyType>(
+          batch[0].array,
+          [&](std::string_view key) {
+            ARROW_ASSIGN_OR_RAISE(key_ids[i], LookupKey(key));
+            ++i;
+            return Status::OK();
+          },
+          [&]() {
+            ++i;
+            return Status::OK();
+          }));
+    }
+
+    // Only the values which are pivoted are retained
+    const ExecValue& values = batch[1];
+    const auto* groups = batch[2].array.GetValues<uint32_t>(1);
+    int64_t* indices = indices_.mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      if (key_ids[i] < 0) continue;
+      if (values.is_scalar() ? !values.scalar->is_valid : values.array.IsNull(i)) {
+        continue;
+      }
+      int64_t* index = &indices[groups[i] * num_keys_ + key_ids[i]];
+      if (*index >= 0) {
+        return DuplicateValueError();
+      }
+      *index = values_builder_->length();
+      if (values.is_scalar()) {
+        RETURN_NOT_OK(values_builder_->AppendScalar(*values.scalar));
+      } else {
+        RETURN_NOT_OK(values_builder_->AppendArraySlice(values.array, i, 1));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedPivotImpl*>(&raw_other);
+    const auto* g = group_id_mapping.GetValues<uint32_t>(1);
+    const int64_t* other_indices = other->indices_.data();
+    int64_t* indices = indices_.mutable_data();
+    const int64_t values_offset = values_builder_->length();
+
+    for (int64_t other_g = 0; other_g < other->num_groups_; ++other_g) {
+      for (int64_t k = 0; k < num_keys_; ++k) {
+        const int64_t other_index = other_indices[other_g * num_keys_ + k];
+        if (other_index < 0) continue;
+        int64_t* index = &indices[g[other_g] * num_keys_ + k];
+        if (*index >= 0) {
+          return DuplicateValueError();
+        }
+        *index = values_offset + other_index;
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto other_values, other->values_builder_->Finish());
+    return values_builder_->AppendArraySlice(ArraySpan(*other_values->data()), 0,
+                                             other_values->length());
+  }
+
+  Result<Datum> Finalize() override {
+    ARROW_ASSIGN_OR_RAISE(auto values, values_builder_->Finish());
+    const int64_t* indices = indices_.data();
+
+    ArrayVector columns(num_keys_);
+    for (int64_t k = 0; k < num_keys_; ++k) {
+      Int64Builder take_indices_builder(ctx_->memory_pool());
+      RETURN_NOT_OK(take_indices_builder.Reserve(num_groups_));
+      for (int64_t g = 0; g < num_groups_; ++g) {
+        const int64_t index = indices[g * num_keys_ + k];
+        if (index >= 0) {
+          take_indices_builder.UnsafeAppend(index);
+        } else {
+          take_indices_builder.UnsafeAppendNull();
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(auto take_indices, take_indices_builder.Finish());
+      ARROW_ASSIGN_OR_RAISE(Datum column,
+                            CallFunction("take", {values, std::move(take_indices)},
+                                         /*options=*/nullptr, ctx_));
+      columns[k] = column.make_array();
+    }
+    return std::make_shared<StructArray>(out_type_, num_groups_, std::move(columns));
+  }
+
+  static Status DuplicateValueError() {
+    return Status::Invalid(
+        "Encountered more than one non-null value for the same grouping key and "
+        "key name");
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+  using MemoTable = ::arrow::internal::BinaryMemoTable<BinaryBuilder>;
+
+  ExecContext* ctx_;
+  PivotWiderOptions options_;
+  int64_t num_keys_;
+  int64_t num_groups_ = 0;
+  std::shared_ptr<DataType> value_type_, out_type_;
+  std::unique_ptr<MemoTable> key_names_;
+  // index into the retained values for each (group, key name), or -1
+  TypedBufferBuilder<int64_t> indices_;
+  std::unique_ptr<ArrayBuilder> values_builder_;
+};
+
+template <typename KeyType>
+Status AddPivotKernel(const std::shared_ptr<DataType>& key_type,
+                      HashAggregateFunction* func) {
+  return func->AddKernel(MakeKernel(
+      KernelSignature::Make(
+          {InputType(key_type->id()), InputType::Any(), InputType(Type::UINT32)},
+          OutputType(ResolveGroupOutputType)),
+      HashAggregateInit<GroupedPivotImpl<KeyType>>));
+}
+
+Status AddPivotKernels(HashAggregateFunction* func) {
+  // String keys are handled like binary keys of the same offset width
+  RETURN_NOT_OK(AddPivotKernel<BinaryType>(binary(), func));
+  RETURN_NOT_OK(AddPivotKernel<BinaryType>(utf8(), func));
+  RETURN_NOT_OK(AddPivotKernel<LargeBinaryType>(large_binary(), func));
+  return AddPivotKernel<LargeBinaryType>(large_utf8(), func);
+}
 }  // namespace
 
 namespace {
@@ -2792,6 +3595,28 @@ const FunctionDoc hash_approximate_median_doc{
     {"array", "group_id_array"},
     "ScalarAggregateOptions"};
 
+const FunctionDoc hash_quantile_doc{
+    "Compute exact quantiles of values in each group",
+    ("By default, the 0.5 quantile (median) is returned.\n"
+     "If a quantile lies between two data points, an interpolated value is\n"
+     "returned based on the selected interpolation method.\n"
+     "Nulls and NaNs are ignored.\n"
+     "Nulls are returned if there are no valid data points.\n"
+     "All values are retained until finalization; for bounded memory use\n"
+     "hash_tdigest or hash_kll_quantile instead."),
+    {"array", "group_id_array"},
+    "QuantileOptions"};
+
+const FunctionDoc hash_kll_quantile_doc{
+    "Compute approximate quantiles of values in each group",
+    ("The KLL algorithm is used for an approximation with bounded memory\n"
+     "and a guaranteed rank error.  The returned values are data points\n"
+     "from the input.\n"
+     "Nulls and NaNs are ignored.\n"
+     "Nulls are returned if there are no valid data points."),
+    {"array", "group_id_array"},
+    "KllQuantileOptions"};
+
 const FunctionDoc hash_min_max_doc{
     "Compute the minimum and maximum of values in each group",
     ("Null values are ignored by default.\n"
@@ -2823,6 +3648,31 @@ const FunctionDoc hash_count_distinct_doc{
     {"array", "group_id_array"},
     "CountOptions"};
 
+const FunctionDoc hash_approx_count_distinct_doc{
+    "Approximately count the distinct values in each group",
+    ("The HyperLogLog++ algorithm is used, so that memory usage is bounded\n"
+     "regardless of the number of distinct values in each group.  The sketch\n"
+     "precision and whether nulls/values are counted are controlled by\n"
+     "ApproxCountDistinctOptions.  NaNs and signed zeroes are normalized."),
+    {"array", "group_id_array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hash_approx_count_distinct_sketch_doc{
+    "Build a HyperLogLog++ sketch of the distinct values in each group",
+    ("Like hash_approx_count_distinct, but the sketch of each group is output\n"
+     "serialized as binary instead of being estimated, so that sketches\n"
+     "computed separately can be merged with hash_approx_count_distinct_merge.\n"
+     "Null values are not recorded in the sketches, only the precision of\n"
+     "ApproxCountDistinctOptions is used."),
+    {"array", "group_id_array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hash_approx_count_distinct_merge_doc{
+    "Merge HyperLogLog++ sketches and estimate the distinct values in each group",
+    ("The input holds the sketches output by hash_approx_count_distinct_sketch,\n"
+     "which must all have the same precision.  Null sketches are ignored."),
+    {"sketches", "group_id_array"}};
+
 const FunctionDoc hash_distinct_doc{
     "Keep the distinct values in each group",
     ("Whether nulls/values are kept is controlled by CountOptions.\n"
@@ -2837,12 +3687,31 @@ const FunctionDoc hash_one_doc{"Get one value from each group",
 const FunctionDoc hash_list_doc{"List all values in each group",
                                 ("Null values are also returned."),
                                 {"array", "group_id_array"}};
+
+const FunctionDoc hash_pivot_wider_doc{
+    "Pivot values according to a pivot key column in each group",
+    ("Output is a struct with as many fields as `PivotWiderOptions.key_names`.\n"
+     "All output struct fields have the same type as `pivot_values`.\n"
+     "Each pivot key decides in which output field the corresponding pivot value\n"
+     "is emitted. If a pivot key doesn't appear in a given group, null is emitted.\n"
+     "If more than one non-null value is encountered for the same pivot key in a\n"
+     "given group, Invalid is raised.\n"
+     "Null pivot keys and null pivot values are ignored. The behavior for\n"
+     "pivot keys not in `PivotWiderOptions.key_names` is controlled by\n"
+     "`PivotWiderOptions.unexpected_key_behavior`."),
+    {"pivot_keys", "pivot_values", "group_id_array"},
+    "PivotWiderOptions",
+    /*options_required=*/true};
 }  // namespace
 
 void RegisterHashAggregateBasic(FunctionRegistry* registry) {
   static auto default_count_options = CountOptions::Defaults();
+  static auto default_approx_count_distinct_options =
+      ApproxCountDistinctOptions::Defaults();
   static auto default_scalar_aggregate_options = ScalarAggregateOptions::Defaults();
   static auto default_tdigest_options = TDigestOptions::Defaults();
+  static auto default_quantile_options = QuantileOptions::Defaults();
+  static auto default_kll_quantile_options = KllQuantileOptions::Defaults();
   static auto default_variance_options = VarianceOptions::Defaults();
 
   {
@@ -2965,6 +3834,33 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_quantile", Arity::Binary(), hash_quantile_doc, &default_quantile_options);
+    DCHECK_OK(AddHashAggKernels(NumericTypes(),
+                                GroupedQuantileFactory<GroupedQuantileImpl>::Make,
+                                func.get()));
+    // Type parameters are ignored
+    DCHECK_OK(AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)},
+                                GroupedQuantileFactory<GroupedQuantileImpl>::Make,
+                                func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_kll_quantile", Arity::Binary(), hash_kll_quantile_doc,
+        &default_kll_quantile_options);
+    DCHECK_OK(AddHashAggKernels(NumericTypes(),
+                                GroupedQuantileFactory<GroupedKllQuantileImpl>::Make,
+                                func.get()));
+    // Type parameters are ignored
+    DCHECK_OK(AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)},
+                                GroupedQuantileFactory<GroupedKllQuantileImpl>::Make,
+                                func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
   HashAggregateFunction* min_max_func = nullptr;
   {
     auto func = std::make_shared<HashAggregateFunction>(
@@ -3021,6 +3917,38 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_approx_count_distinct", Arity::Binary(), hash_approx_count_distinct_doc,
+        &default_approx_count_distinct_options);
+    DCHECK_OK(AddHashAggKernels(
+        ApproxCountDistinctTypes(),
+        GroupedApproxCountDistinctFactory<GroupedApproxCountDistinctImpl>::Make,
+        func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_approx_count_distinct_sketch", Arity::Binary(),
+        hash_approx_count_distinct_sketch_doc, &default_approx_count_distinct_options);
+    DCHECK_OK(AddHashAggKernels(
+        ApproxCountDistinctTypes(),
+        GroupedApproxCountDistinctFactory<GroupedApproxCountDistinctSketchImpl>::Make,
+        func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_approx_count_distinct_merge", Arity::Binary(),
+        hash_approx_count_distinct_merge_doc);
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(InputType(Type::BINARY),
+                   HashAggregateInit<GroupedApproxCountDistinctMergeImpl>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
   {
     auto func = std::make_shared<HashAggregateFunction>(
         "hash_distinct", Arity::Binary(), hash_distinct_doc, &default_count_options);
@@ -3052,6 +3980,13 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
                                 GroupedListFactory::Make, func.get()));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_pivot_wider", Arity::Ternary(), hash_pivot_wider_doc);
+    DCHECK_OK(AddPivotKernels(func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
 }
 
 }  // namespace internal
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -44,6 +45,7 @@
 #include "arrow/compute/registry.h"
 #include "arrow/compute/row/grouper.h"
 #include "arrow/table.h"
+#include "arrow/testing/builder.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
@@ -422,6 +424,15 @@ struct TestGrouper {
     }
   }
 
+  // Dictionaries are unified across batches, so compare dictionary keys by value
+  static std::shared_ptr<Array> Decode(const std::shared_ptr<Array>& array) {
+    if (array->type_id() != Type::DICTIONARY) {
+      return array;
+    }
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*array);
+    return *Take(*dict_array.dictionary(), *dict_array.indices());
+  }
+
   void ValidateConsume(const ExecBatch& key_batch, const Datum& id_batch) {
     if (uniques_.length == -1) {
       ASSERT_OK_AND_ASSIGN(uniques_, grouper_->GetUniques());
@@ -433,7 +444,8 @@ struct TestGrouper {
         auto new_unique = new_uniques[i].make_array();
         ValidateOutput(*new_unique);
 
-        AssertDatumsEqual(uniques_[i], new_unique->Slice(0, uniques_.length),
+        AssertArraysEqual(*Decode(uniques_[i].make_array()),
+                          *Decode(new_unique->Slice(0, uniques_.length)),
                           /*verbose=*/true);
       }
 
@@ -451,7 +463,7 @@ struct TestGrouper {
               ? key_batch[i].make_array()
               : *MakeArrayFromScalar(*key_batch[i].scalar(), key_batch.length);
       ASSERT_OK_AND_ASSIGN(auto encoded, Take(*uniques_[i].make_array(), *ids));
-      AssertArraysEqual(*original, *encoded, /*verbose=*/true,
+      AssertArraysEqual(*Decode(original), *Decode(encoded), /*verbose=*/true,
                         EqualOptions().nans_equal(true));
     }
   }
@@ -540,9 +552,6 @@ TEST(Grouper, StringKey) {
 TEST(Grouper, DictKey) {
   TestGrouper g({dictionary(int32(), utf8())});
 
-  // For dictionary keys, all batches must share a single dictionary.
-  // Eventually, differing dictionaries will be unified and indices transposed
-  // during encoding to relieve this restriction.
   const auto dict = ArrayFromJSON(utf8(), R"(["ex", "why", "zee", null])");
 
   auto WithIndices = [&](const std::string& indices) {
@@ -561,13 +570,62 @@ TEST(Grouper, DictKey) {
   g.ExpectConsume({WithIndices("           [3, 1, null, 0, 2]")},
                   ArrayFromJSON(uint32(), "[3, 1, 4,    0, 2]"));
 
+  // Differing dictionaries are unified
   auto dict_arr = *DictionaryArray::FromArrays(
-      ArrayFromJSON(int32(), "[0, 1]"),
-      ArrayFromJSON(utf8(), R"(["different", "dictionary"])"));
-  ExecSpan dict_span({*dict_arr->data()}, 2);
-  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
-                                  HasSubstr("Unifying differing dictionaries"),
-                                  g.grouper_->Consume(dict_span));
+      ArrayFromJSON(int32(), "[0, 1, 1, null]"),
+      ArrayFromJSON(utf8(), R"(["different", "why"])"));
+  g.ExpectConsume({dict_arr}, ArrayFromJSON(uint32(), "[5, 1, 1, 4]"));
+  g.ExpectConsume({WithIndices("           [2, 1]")}, ArrayFromJSON(uint32(), "[2, 1]"));
+
+  auto dict_type = dictionary(int32(), utf8());
+  g.ExpectUniques(ExecBatch(
+      {DictArrayFromJSON(dict_type, "[0, 1, 2, 3, null, 4]",
+                         R"(["ex", "why", "zee", null, "different"])")},
+      6));
+}
+
+TEST(Grouper, MultipleDictKeys) {
+  auto dict_type = dictionary(int8(), utf8());
+  TestGrouper g({dict_type, dictionary(int16(), int32())});
+
+  g.ExpectConsume({DictArrayFromJSON(dict_type, "[0, 1, 0, 1, null]", R"(["a", "b"])"),
+                   DictArrayFromJSON(dictionary(int16(), int32()), "[0, 0, 1, 1, 1]",
+                                     "[10, 20]")},
+                  ArrayFromJSON(uint32(), "[0, 1, 2, 3, 4]"));
+  g.ExpectConsume({DictArrayFromJSON(dict_type, "[0, 1, 2, 2]", R"(["b", "a", "c"])"),
+                   DictArrayFromJSON(dictionary(int16(), int32()), "[1, 0, 0, null]",
+                                     "[10, 20]")},
+                  ArrayFromJSON(uint32(), "[3, 0, 5, 6]"));
+
+  // Keys with many distinct values are grouped by a regular grouper instead
+  auto large_type = dictionary(int16(), int32());
+  std::vector<int32_t> values(2048);
+  std::iota(values.begin(), values.end(), 0);
+  std::vector<int16_t> indices0(4096), indices1(4096);
+  for (int i = 0; i < 4096; ++i) {
+    indices0[i] = static_cast<int16_t>(i % 2048);
+    indices1[i] = static_cast<int16_t>((i * 7) % 2048);
+  }
+  std::shared_ptr<Array> dict, indices_arr0, indices_arr1;
+  ArrayFromVector<Int32Type>(values, &dict);
+  ArrayFromVector<Int16Type>(indices0, &indices_arr0);
+  ArrayFromVector<Int16Type>(indices1, &indices_arr1);
+  ASSERT_OK_AND_ASSIGN(auto keys0,
+                       DictionaryArray::FromArrays(large_type, indices_arr0, dict));
+  ASSERT_OK_AND_ASSIGN(auto keys1,
+                       DictionaryArray::FromArrays(large_type, indices_arr1, dict));
+  TestGrouper large({large_type, large_type});
+  // Groups found before the switch keep their ids
+  ASSERT_OK_AND_ASSIGN(
+      auto small_keys,
+      DictionaryArray::FromArrays(large_type, ArrayFromJSON(int16(), "[0, 1, 2, 3]"),
+                                  dict->Slice(0, 4)));
+  large.ExpectConsume({small_keys, small_keys}, ArrayFromJSON(uint32(), "[0, 1, 2, 3]"));
+  ASSERT_OK_AND_ASSIGN(auto batch, ExecBatch::Make({keys0, keys1}));
+  large.ConsumeAndValidate(batch);
+  large.ConsumeAndValidate(batch);
+  // (0, 0) is the only one of the first groups which also appears in the batch
+  ASSERT_EQ(large.grouper_->num_groups(), uint32_t{2048 + 3});
 }
 
 TEST(Grouper, StringInt64Key) {
@@ -1485,6 +1543,270 @@ TEST(GroupBy, ApproximateMedian) {
   }
 }
 
+TEST(GroupBy, Quantile) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", float64()), field("key", int64())}), R"([
+    [1,    1],
+    [null, 1],
+    [0,    2],
+    [null, 3],
+    [1,    4],
+    [4,    null],
+    [3,    1],
+    [0,    2],
+    [-1,   2],
+    [1,    null],
+    [NaN,  3],
+    [1,    4],
+    [1,    4],
+    [null, 4]
+  ])");
+
+  auto options = std::make_shared<QuantileOptions>(std::vector<double>{0.5, 0.9, 0.99});
+  auto lower = std::make_shared<QuantileOptions>(std::vector<double>{0.25, 0.75},
+                                                 QuantileOptions::LOWER);
+  auto keep_nulls = std::make_shared<QuantileOptions>(
+      /*q=*/0.5, QuantileOptions::LINEAR, /*skip_nulls=*/false, /*min_count=*/0);
+  auto min_count = std::make_shared<QuantileOptions>(
+      /*q=*/0.5, QuantileOptions::LINEAR, /*skip_nulls=*/true, /*min_count=*/3);
+  auto keep_nulls_min_count = std::make_shared<QuantileOptions>(
+      /*q=*/0.5, QuantileOptions::LINEAR, /*skip_nulls=*/false, /*min_count=*/3);
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                         GroupByTest(
+                             {
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                             },
+                             {
+                                 batch->GetColumnByName("key"),
+                             },
+                             {
+                                 {"hash_quantile", nullptr},
+                                 {"hash_quantile", options},
+                                 {"hash_quantile", lower},
+                                 {"hash_quantile", keep_nulls},
+                                 {"hash_quantile", min_count},
+                                 {"hash_quantile", keep_nulls_min_count},
+                             },
+                             use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+
+    AssertDatumsApproxEqual(
+        ArrayFromJSON(struct_({
+                          field("hash_quantile", fixed_size_list(float64(), 1)),
+                          field("hash_quantile", fixed_size_list(float64(), 3)),
+                          field("hash_quantile", fixed_size_list(float64(), 2)),
+                          field("hash_quantile", fixed_size_list(float64(), 1)),
+                          field("hash_quantile", fixed_size_list(float64(), 1)),
+                          field("hash_quantile", fixed_size_list(float64(), 1)),
+                          field("key_0", int64()),
+                      }),
+                      R"([
+    [[2.0],  [2.0, 2.8, 2.98],   [1.0, 1.0],   [null], [null], [null], 1],
+    [[0.0],  [0.0, 0.0, 0.0],    [-1.0, 0.0],  [0.0],  [0.0],  [0.0],  2],
+    [[null], [null, null, null], [null, null], [null], [null], [null], 3],
+    [[1.0],  [1.0, 1.0, 1.0],    [1.0, 1.0],   [null], [1.0],  [null], 4],
+    [[2.5],  [2.5, 3.7, 3.97],   [1.0, 1.0],   [2.5],  [null], [null], null]
+  ])"),
+        aggregated_and_grouped,
+        /*verbose=*/true);
+  }
+}
+
+TEST(GroupBy, QuantileDecimal) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument0", decimal128(3, 2)), field("argument1", decimal256(3, 2)),
+              field("key", int64())}),
+      R"([
+    ["1.01",  "1.01",  1],
+    [null,    null,    1],
+    ["0.00",  "0.00",  2],
+    ["4.42",  "4.42",  null],
+    ["3.86",  "3.86",  1],
+    ["0.00",  "0.00",  2],
+    ["-1.93", "-1.93", 2],
+    ["1.85",  "1.85",  null]
+  ])");
+
+  // Interpolated quantiles are computed as doubles, data points keep the input type
+  auto higher = std::make_shared<QuantileOptions>(0.5, QuantileOptions::HIGHER);
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       GroupByTest(
+                           {
+                               batch->GetColumnByName("argument0"),
+                               batch->GetColumnByName("argument1"),
+                               batch->GetColumnByName("argument0"),
+                               batch->GetColumnByName("argument1"),
+                           },
+                           {batch->GetColumnByName("key")},
+                           {
+                               {"hash_quantile", nullptr},
+                               {"hash_quantile", nullptr},
+                               {"hash_quantile", higher},
+                               {"hash_quantile", higher},
+                           },
+                           false));
+
+  AssertDatumsApproxEqual(
+      ArrayFromJSON(struct_({
+                        field("hash_quantile", fixed_size_list(float64(), 1)),
+                        field("hash_quantile", fixed_size_list(float64(), 1)),
+                        field("hash_quantile", fixed_size_list(decimal128(3, 2), 1)),
+                        field("hash_quantile", fixed_size_list(decimal256(3, 2), 1)),
+                        field("key_0", int64()),
+                    }),
+                    R"([
+    [[2.435], [2.435], ["3.86"], ["3.86"], 1],
+    [[0.0],   [0.0],   ["0.00"], ["0.00"], 2],
+    [[3.135], [3.135], ["4.42"], ["4.42"], null]
+  ])"),
+      aggregated_and_grouped,
+      /*verbose=*/true);
+}
+
+TEST(GroupBy, QuantileInvalidOptions) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+  auto keys = ArrayFromJSON(int32(), "[1, 1, 2]");
+  for (const auto& q : std::vector<std::vector<double>>{{}, {-0.1}, {0.5, 1.1}}) {
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("uantile"),
+        GroupByTest({values}, {keys},
+                    {{"hash_quantile", std::make_shared<QuantileOptions>(q)}}, false));
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("uantile"),
+        GroupByTest({values}, {keys},
+                    {{"hash_kll_quantile", std::make_shared<KllQuantileOptions>(q)}},
+                    false));
+  }
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("KLL parameter k must be at least 8, got 2"),
+      GroupByTest({values}, {keys},
+                  {{"hash_kll_quantile",
+                    std::make_shared<KllQuantileOptions>(/*q=*/0.5, /*k=*/2)}},
+                  false));
+}
+
+TEST(GroupBy, KllQuantile) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", float64()), field("key", int64())}), R"([
+    [1,    1],
+    [null, 1],
+    [0,    2],
+    [null, 3],
+    [1,    4],
+    [4,    null],
+    [3,    1],
+    [0,    2],
+    [-1,   2],
+    [1,    null],
+    [NaN,  3],
+    [1,    4],
+    [1,    4],
+    [null, 4],
+    [NaN,  5],
+    [2,    5],
+    [2,    5]
+  ])");
+
+  // Small groups are retained exactly, so the results are exact data points
+  auto options = std::make_shared<KllQuantileOptions>(std::vector<double>{0.5, 0.9, 0.99});
+  auto keep_nulls = std::make_shared<KllQuantileOptions>(
+      /*q=*/0.5, /*k=*/200, /*skip_nulls=*/false, /*min_count=*/0);
+  auto min_count = std::make_shared<KllQuantileOptions>(
+      /*q=*/0.5, /*k=*/200, /*skip_nulls=*/true, /*min_count=*/3);
+  auto keep_nulls_min_count = std::make_shared<KllQuantileOptions>(
+      /*q=*/0.5, /*k=*/200, /*skip_nulls=*/false, /*min_count=*/3);
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       GroupByTest(
+                           {
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                           },
+                           {
+                               batch->GetColumnByName("key"),
+                           },
+                           {
+                               {"hash_kll_quantile", nullptr},
+                               {"hash_kll_quantile", options},
+                               {"hash_kll_quantile", keep_nulls},
+                               {"hash_kll_quantile", min_count},
+                               {"hash_kll_quantile", keep_nulls_min_count},
+                           },
+                           false));
+
+  AssertDatumsApproxEqual(
+      ArrayFromJSON(struct_({
+                        field("hash_kll_quantile", fixed_size_list(float64(), 1)),
+                        field("hash_kll_quantile", fixed_size_list(float64(), 3)),
+                        field("hash_kll_quantile", fixed_size_list(float64(), 1)),
+                        field("hash_kll_quantile", fixed_size_list(float64(), 1)),
+                        field("hash_kll_quantile", fixed_size_list(float64(), 1)),
+                        field("key_0", int64()),
+                    }),
+                    R"([
+    [[1.0],  [1.0, 3.0, 3.0],    [null], [null], [null], 1],
+    [[0.0],  [0.0, 0.0, 0.0],    [0.0],  [0.0],  [0.0],  2],
+    [[null], [null, null, null], [null], [null], [null], 3],
+    [[1.0],  [1.0, 1.0, 1.0],    [null], [1.0],  [null], 4],
+    [[1.0],  [1.0, 4.0, 4.0],    [1.0],  [null], [null], null],
+    [[2.0],  [2.0, 2.0, 2.0],    [2.0],  [null], [null], 5]
+  ])"),
+      aggregated_and_grouped,
+      /*verbose=*/true);
+}
+
+TEST(GroupBy, KllQuantileLargeInput) {
+  // Group 0 holds the even values of [0, 2n), group 1 the odd ones, spread
+  // over several chunks so that partial sketches get merged
+  const int64_t num_rows = 200000;
+  const int64_t num_chunks = 4;
+  ArrayVector value_chunks, key_chunks;
+  for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+    Int64Builder values_builder, keys_builder;
+    for (int64_t i = chunk; i < num_rows; i += num_chunks) {
+      ASSERT_OK(values_builder.Append(i));
+      ASSERT_OK(keys_builder.Append(i % 2));
+    }
+    ASSERT_OK_AND_ASSIGN(auto values, values_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto keys, keys_builder.Finish());
+    value_chunks.push_back(values);
+    key_chunks.push_back(keys);
+  }
+  auto values = std::make_shared<ChunkedArray>(value_chunks);
+  auto keys = std::make_shared<ChunkedArray>(key_chunks);
+
+  const std::vector<double> q = {0.01, 0.5, 0.99};
+  auto options = std::make_shared<KllQuantileOptions>(q);
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        internal::GroupBy({values}, {keys},
+                          {{"hash_kll_quantile", options, "agg_0", "hash_kll_quantile"}},
+                          use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    const auto& lists = checked_cast<const FixedSizeListArray&>(
+        *aggregated_and_grouped.array_as<StructArray>()->field(0));
+    const auto& quantiles = checked_cast<const DoubleArray&>(*lists.values());
+    ASSERT_EQ(lists.length(), 2);
+    for (int64_t g = 0; g < 2; ++g) {
+      for (size_t j = 0; j < q.size(); ++j) {
+        // The normalized rank error is ~0.85% with the default k
+        ASSERT_NEAR(quantiles.Value(g * q.size() + j), q[j] * num_rows, 0.02 * num_rows);
+      }
+    }
+  }
+}
+
 TEST(GroupBy, StddevVarianceTDigestScalar) {
   BatchesWithSchema input;
   input.batches = {
@@ -2370,6 +2692,191 @@ TEST(GroupBy, CountDistinct) {
   }
 }
 
+TEST(GroupBy, ApproxCountDistinct) {
+  auto all = std::make_shared<ApproxCountDistinctOptions>(CountOptions::ALL);
+  auto only_valid =
+      std::make_shared<ApproxCountDistinctOptions>(CountOptions::ONLY_VALID);
+  auto only_null =
+      std::make_shared<ApproxCountDistinctOptions>(CountOptions::ONLY_NULL);
+
+  // Small cardinalities are estimated exactly
+  const std::vector<std::pair<std::shared_ptr<DataType>, std::vector<std::string>>>
+      cases = {
+          {float64(),
+           {R"([[1, 1], [1, 1], [0, 2], [null, 3], [null, 3]])",
+            R"([[null, 4], [null, 4], [4, null], [1, 3], [0, 2], [-0.0, 2], [-1, 2]])",
+            R"([[1, null], [NaN, 3], [2, null], [3, null]])"}},
+          {utf8(),
+           {R"([["foo", 1], ["foo", 1], ["bar", 2], [null, 3], [null, 3]])",
+            R"([[null, 4], [null, 4], ["baz", null], ["foo", 3], ["bar", 2]])",
+            R"([["spam", 2], ["eggs", null], ["ham", 3], ["a", null], ["b", null]])"}},
+          {decimal128(5, 2),
+           {R"([["1.00", 1], ["1.00", 1], ["2.00", 2], [null, 3], [null, 3]])",
+            R"([[null, 4], [null, 4], ["3.00", null], ["1.00", 3], ["2.00", 2]])",
+            R"([["4.00", 2], ["5.00", null], ["6.00", 3], ["7.00", null]])",
+            R"([["8.00", null]])"}},
+      };
+
+  for (const auto& type_and_json : cases) {
+    ARROW_SCOPED_TRACE("type = ", *type_and_json.first);
+    for (bool use_threads : {true, false}) {
+      SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+
+      auto table = TableFromJSON(
+          schema({field("argument", type_and_json.first), field("key", int64())}),
+          type_and_json.second);
+
+      ASSERT_OK_AND_ASSIGN(
+          Datum aggregated_and_grouped,
+          internal::GroupBy(
+              {
+                  table->GetColumnByName("argument"),
+                  table->GetColumnByName("argument"),
+                  table->GetColumnByName("argument"),
+              },
+              {
+                  table->GetColumnByName("key"),
+              },
+              {
+                  {"hash_approx_count_distinct", all, "agg_0",
+                   "hash_approx_count_distinct"},
+                  {"hash_approx_count_distinct", only_valid, "agg_1",
+                   "hash_approx_count_distinct"},
+                  {"hash_approx_count_distinct", only_null, "agg_2",
+                   "hash_approx_count_distinct"},
+              },
+              use_threads));
+      ValidateOutput(aggregated_and_grouped);
+      SortBy({"key_0"}, &aggregated_and_grouped);
+
+      AssertDatumsEqual(ArrayFromJSON(struct_({
+                                          field("hash_approx_count_distinct", int64()),
+                                          field("hash_approx_count_distinct", int64()),
+                                          field("hash_approx_count_distinct", int64()),
+                                          field("key_0", int64()),
+                                      }),
+                                      R"([
+    [1, 1, 0, 1],
+    [2, 2, 0, 2],
+    [3, 2, 1, 3],
+    [1, 0, 1, 4],
+    [4, 4, 0, null]
+  ])"),
+                        aggregated_and_grouped,
+                        /*verbose=*/true);
+    }
+  }
+}
+
+TEST(GroupBy, ApproxCountDistinctLargeCardinality) {
+  // Group 0 has many distinct values, group 1 has few
+  const int64_t num_rows = 100000;
+  Int64Builder values_builder, keys_builder;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    const bool small_group = i % 10 == 0;
+    ASSERT_OK(values_builder.Append(small_group ? i % 100 : i));
+    ASSERT_OK(keys_builder.Append(small_group ? 1 : 0));
+  }
+  ASSERT_OK_AND_ASSIGN(auto values, values_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto keys, keys_builder.Finish());
+
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        internal::GroupBy({values}, {keys},
+                          {{"hash_approx_count_distinct", nullptr, "agg_0",
+                            "hash_approx_count_distinct"}},
+                          use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    const auto& counts = checked_cast<const Int64Array&>(
+        *aggregated_and_grouped.array_as<StructArray>()->field(0));
+    ASSERT_EQ(counts.length(), 2);
+    // Default precision has a relative standard error of ~0.8%
+    ASSERT_NEAR(static_cast<double>(counts.Value(0)), 90000.0, 90000 * 0.04);
+    ASSERT_EQ(counts.Value(1), 10);
+  }
+}
+
+TEST(GroupBy, ApproxCountDistinctSketchAndMerge) {
+  auto sketch_schema = schema({field("argument", utf8()), field("key", int64())});
+  // Each part is sketched separately, then the sketches are merged per key
+  const std::vector<std::vector<std::string>> parts = {
+      {R"([["foo", 1], ["foo", 1], ["bar", 2], [null, 3], [null, 3]])",
+       R"([[null, 4], [null, 4], ["baz", null], ["foo", 3], ["bar", 2]])"},
+      {R"([["spam", 2], ["eggs", null], ["ham", 3], ["a", null], ["b", null]])",
+       R"([["foo", 3], ["bar", 2]])"},
+  };
+
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+
+    ArrayVector sketches;
+    for (const auto& part : parts) {
+      auto table = TableFromJSON(sketch_schema, part);
+      ASSERT_OK_AND_ASSIGN(
+          Datum sketched,
+          internal::GroupBy({table->GetColumnByName("argument")},
+                            {table->GetColumnByName("key")},
+                            {{"hash_approx_count_distinct_sketch", nullptr, "agg_0",
+                              "hash_approx_count_distinct_sketch"}},
+                            use_threads));
+      ValidateOutput(sketched);
+      ASSERT_EQ(*sketched.array_as<StructArray>()->field(0)->type(), *binary());
+      sketches.push_back(sketched.make_array());
+    }
+    ASSERT_OK_AND_ASSIGN(auto all_sketches, Concatenate(sketches));
+    const auto& sketch_struct = checked_cast<const StructArray&>(*all_sketches);
+
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        internal::GroupBy({sketch_struct.field(0)}, {sketch_struct.field(1)},
+                          {{"hash_approx_count_distinct_merge", nullptr, "agg_0",
+                            "hash_approx_count_distinct_merge"}},
+                          use_threads));
+    ValidateOutput(aggregated_and_grouped);
+    SortBy({"key_0"}, &aggregated_and_grouped);
+
+    // Nulls are not recorded in the sketches
+    auto expected_type = struct_({
+        field("hash_approx_count_distinct_merge", int64()),
+        field("key_0", int64()),
+    });
+    AssertDatumsEqual(ArrayFromJSON(expected_type, R"([
+    [1, 1],
+    [2, 2],
+    [2, 3],
+    [0, 4],
+    [4, null]
+  ])"),
+                      aggregated_and_grouped,
+                      /*verbose=*/true);
+  }
+
+  // Sketches of different precisions cannot be merged
+  auto values = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  auto keys = ArrayFromJSON(int64(), "[1, 1]");
+  ArrayVector sketches;
+  for (int32_t precision : {10, 14}) {
+    auto options =
+        std::make_shared<ApproxCountDistinctOptions>(CountOptions::ONLY_VALID, precision);
+    ASSERT_OK_AND_ASSIGN(
+        Datum sketched,
+        internal::GroupBy({values}, {keys},
+                          {{"hash_approx_count_distinct_sketch", options, "agg_0",
+                            "hash_approx_count_distinct_sketch"}},
+                          /*use_threads=*/false));
+    sketches.push_back(sketched.array_as<StructArray>()->field(0));
+  }
+  ASSERT_OK_AND_ASSIGN(auto all_sketches, Concatenate(sketches));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("different precisions"),
+      internal::GroupBy({all_sketches}, {keys},
+                        {{"hash_approx_count_distinct_merge", nullptr, "agg_0",
+                          "hash_approx_count_distinct_merge"}},
+                        /*use_threads=*/false));
+}
+
 TEST(GroupBy, Distinct) {
   auto all = std::make_shared<CountOptions>(CountOptions::ALL);
   auto only_valid = std::make_shared<CountOptions>(CountOptions::ONLY_VALID);
@@ -3244,6 +3751,91 @@ TEST(GroupBy, ListMiscTypes) {
   }
 }
 
+TEST(GroupBy, PivotWider) {
+  auto table = TableFromJSON(
+      schema({field("group_key", int64()), field("key", utf8()), field("value", int64())}),
+      {R"([
+    [1, "height", 10],
+    [1, "width",  11],
+    [2, "width",  12],
+    [2, "depth",  13],
+    [3, null,     14]
+  ])",
+       R"([
+    [3, "height", null],
+    [3, "height", 15],
+    [2, "height", 16],
+    [4, "width",  17]
+  ])"});
+  auto options =
+      std::make_shared<PivotWiderOptions>(std::vector<std::string>{"height", "width"});
+
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        internal::GroupBy(
+            {table->GetColumnByName("key"), table->GetColumnByName("value")},
+            {table->GetColumnByName("group_key")},
+            {{"hash_pivot_wider", options, std::vector<FieldRef>{"agg_0", "agg_1"},
+              "hash_pivot_wider"}},
+            use_threads));
+    ValidateOutput(aggregated_and_grouped);
+    SortBy({"key_0"}, &aggregated_and_grouped);
+
+    AssertDatumsEqual(
+        ArrayFromJSON(struct_({
+                          field("hash_pivot_wider", struct_({field("height", int64()),
+                                                             field("width", int64())})),
+                          field("key_0", int64()),
+                      }),
+                      R"([
+    [{"height": 10, "width": 11}, 1],
+    [{"height": 16, "width": 12}, 2],
+    [{"height": 15, "width": null}, 3],
+    [{"height": null, "width": 17}, 4]
+  ])"),
+        aggregated_and_grouped,
+        /*verbose=*/true);
+  }
+
+  // Unexpected pivot keys can be rejected
+  auto raise_options = std::make_shared<PivotWiderOptions>(
+      std::vector<std::string>{"height", "width"}, PivotWiderOptions::kRaise);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      KeyError, HasSubstr("Unexpected pivot key: depth"),
+      internal::GroupBy({table->GetColumnByName("key"), table->GetColumnByName("value")},
+                        {table->GetColumnByName("group_key")},
+                        {{"hash_pivot_wider", raise_options,
+                          std::vector<FieldRef>{"agg_0", "agg_1"}, "hash_pivot_wider"}}));
+
+  // More than one value for the same group and pivot key
+  auto duplicates = TableFromJSON(
+      schema({field("group_key", int64()), field("key", utf8()), field("value", int64())}),
+      {R"([[1, "height", 10], [2, "height", 11]])", R"([[1, "height", 12]])"});
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, HasSubstr("more than one non-null value"),
+        internal::GroupBy(
+            {duplicates->GetColumnByName("key"), duplicates->GetColumnByName("value")},
+            {duplicates->GetColumnByName("group_key")},
+            {{"hash_pivot_wider", options, std::vector<FieldRef>{"agg_0", "agg_1"},
+              "hash_pivot_wider"}},
+            use_threads));
+  }
+
+  // Key names must be unique
+  auto duplicate_names =
+      std::make_shared<PivotWiderOptions>(std::vector<std::string>{"height", "height"});
+  ASSERT_RAISES(
+      Invalid,
+      internal::GroupBy({table->GetColumnByName("key"), table->GetColumnByName("value")},
+                        {table->GetColumnByName("group_key")},
+                        {{"hash_pivot_wider", duplicate_names,
+                          std::vector<FieldRef>{"agg_0", "agg_1"}, "hash_pivot_wider"}}));
+}
+
 TEST(GroupBy, CountAndSum) {
   auto batch = RecordBatchFromJSON(
       schema({field("argument", float64()), field("key", int64())}), R"([
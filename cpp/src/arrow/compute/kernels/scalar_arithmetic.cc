@@ -30,7 +30,9 @@
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/config.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/macros.h"
 #include "arrow/visit_scalar_inline.h"
@@ -552,6 +554,157 @@ Result<TypeHolder> ResolveTemporalOutput(KernelContext*,
   return std::move(type);
 }
 
+// Decimal128 values whose precision is 18 or less fit in an int64. For those, additions
+// and subtractions are computed in int64 lanes and multiplications with a single
+// widening multiplication, instead of generic multi-word decimal arithmetic. The loops
+// are branch-free: whether all values actually fit (values may exceed their declared
+// precision) and whether an int64 result overflowed is checked once for the whole
+// batch, which then takes the generic path if needed.
+
+constexpr int32_t kMaxNarrowDecimalPrecision = 18;
+constexpr int kLowWord = ARROW_LITTLE_ENDIAN ? 0 : 1;
+constexpr int kHighWord = 1 - kLowWord;
+
+// Nonzero if the decimal doesn't fit in an int64
+inline uint64_t NarrowDecimalViolation(const uint64_t* words) {
+  const auto sign_extension =
+      static_cast<uint64_t>(static_cast<int64_t>(words[kLowWord]) >> 63);
+  return words[kHighWord] ^ sign_extension;
+}
+
+inline void StoreInt64AsDecimal(int64_t value, uint64_t* out) {
+  out[kLowWord] = static_cast<uint64_t>(value);
+  out[kHighWord] = static_cast<uint64_t>(value >> 63);
+}
+
+struct NarrowDecimalAdd {
+  static uint64_t Call(const uint64_t* left, const uint64_t* right, uint64_t* out) {
+    const uint64_t l = left[kLowWord], r = right[kLowWord];
+    const uint64_t result = l + r;
+    StoreInt64AsDecimal(static_cast<int64_t>(result), out);
+    // signed overflow iff both operands have a sign different from the result
+    return ((l ^ result) & (r ^ result)) >> 63;
+  }
+};
+
+struct NarrowDecimalSubtract {
+  static uint64_t Call(const uint64_t* left, const uint64_t* right, uint64_t* out) {
+    const uint64_t l = left[kLowWord], r = right[kLowWord];
+    const uint64_t result = l - r;
+    StoreInt64AsDecimal(static_cast<int64_t>(result), out);
+    return ((l ^ r) & (l ^ result)) >> 63;
+  }
+};
+
+#ifdef ARROW_USE_NATIVE_INT128
+struct NarrowDecimalMultiply {
+  static uint64_t Call(const uint64_t* left, const uint64_t* right, uint64_t* out) {
+    // The product of two int64 always fits in an int128
+    const auto result =
+        static_cast<__int128_t>(static_cast<int64_t>(left[kLowWord])) *
+        static_cast<int64_t>(right[kLowWord]);
+    out[kLowWord] = static_cast<uint64_t>(result);
+    out[kHighWord] = static_cast<uint64_t>(static_cast<__uint128_t>(result) >> 64);
+    return 0;
+  }
+};
+#endif
+
+template <typename Op>
+struct NarrowDecimalOp {
+  using type = void;
+};
+template <>
+struct NarrowDecimalOp<Add> {
+  using type = NarrowDecimalAdd;
+};
+template <>
+struct NarrowDecimalOp<AddChecked> {
+  using type = NarrowDecimalAdd;
+};
+template <>
+struct NarrowDecimalOp<Subtract> {
+  using type = NarrowDecimalSubtract;
+};
+template <>
+struct NarrowDecimalOp<SubtractChecked> {
+  using type = NarrowDecimalSubtract;
+};
+#ifdef ARROW_USE_NATIVE_INT128
+template <>
+struct NarrowDecimalOp<Multiply> {
+  using type = NarrowDecimalMultiply;
+};
+template <>
+struct NarrowDecimalOp<MultiplyChecked> {
+  using type = NarrowDecimalMultiply;
+};
+#endif
+
+// A stride of 0 broadcasts a scalar
+template <typename NarrowOp, int kLeftStride, int kRightStride>
+bool NarrowDecimal128Loop(const uint64_t* left, const uint64_t* right, int64_t length,
+                          uint64_t* out) {
+  uint64_t violations = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    const uint64_t* l = left + i * kLeftStride;
+    const uint64_t* r = right + i * kRightStride;
+    violations |= NarrowDecimalViolation(l) | NarrowDecimalViolation(r);
+    violations |= NarrowOp::Call(l, r, out + 2 * i);
+  }
+  return violations == 0;
+}
+
+template <typename Op, typename NarrowOp = typename NarrowDecimalOp<Op>::type>
+struct Decimal128BinaryExec {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    if (ExecNarrow(batch, out)) {
+      return Status::OK();
+    }
+    return ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Op>::Exec(
+        ctx, batch, out);
+  }
+
+  // Returns false if the batch must take the generic path
+  static bool ExecNarrow(const ExecSpan& batch, ExecResult* out) {
+    const auto& left_type = checked_cast<const Decimal128Type&>(*batch[0].type());
+    const auto& right_type = checked_cast<const Decimal128Type&>(*batch[1].type());
+    if (left_type.precision() > kMaxNarrowDecimalPrecision ||
+        right_type.precision() > kMaxNarrowDecimalPrecision ||
+        (batch[0].is_scalar() && batch[1].is_scalar())) {
+      return false;
+    }
+    const uint64_t* left;
+    const uint64_t* right;
+    for (int i = 0; i < 2; ++i) {
+      const uint64_t*& words = i == 0 ? left : right;
+      if (batch[i].is_scalar()) {
+        if (!batch[i].scalar->is_valid) {
+          return false;
+        }
+        words = checked_cast<const Decimal128Scalar&>(*batch[i].scalar)
+                    .value.native_endian_array()
+                    .data();
+      } else {
+        words = batch[i].array.GetValues<uint64_t>(1, batch[i].array.offset * 2);
+      }
+    }
+    ArraySpan* out_span = out->array_span_mutable();
+    uint64_t* out_words = out_span->GetValues<uint64_t>(1, out_span->offset * 2);
+    if (batch[0].is_scalar()) {
+      return NarrowDecimal128Loop<NarrowOp, 0, 2>(left, right, batch.length, out_words);
+    } else if (batch[1].is_scalar()) {
+      return NarrowDecimal128Loop<NarrowOp, 2, 0>(left, right, batch.length, out_words);
+    }
+    return NarrowDecimal128Loop<NarrowOp, 2, 2>(left, right, batch.length, out_words);
+  }
+};
+
+// Operations without a narrow implementation
+template <typename Op>
+struct Decimal128BinaryExec<Op, void>
+    : ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Op> {};
+
 template <typename Op>
 void AddDecimalUnaryKernels(ScalarFunction* func) {
   OutputType out_type(FirstType);
@@ -579,7 +732,7 @@ void AddDecimalBinaryKernels(const std::string& name, ScalarFunction* func) {
 
   auto in_type128 = InputType(Type::DECIMAL128);
   auto in_type256 = InputType(Type::DECIMAL256);
-  auto exec128 = ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Op>::Exec;
+  auto exec128 = Decimal128BinaryExec<Op>::Exec;
   auto exec256 = ScalarBinaryNotNullEqualTypes<Decimal256Type, Decimal256Type, Op>::Exec;
   DCHECK_OK(func->AddKernel({in_type128, in_type128}, out_type, exec128));
   DCHECK_OK(func->AddKernel({in_type256, in_type256}, out_type, exec256));
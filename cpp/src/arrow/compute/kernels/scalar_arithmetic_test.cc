@@ -2093,6 +2093,58 @@ TEST_F(TestBinaryArithmeticDecimal, Multiply) {
   }
 }
 
+TEST_F(TestBinaryArithmeticDecimal, NarrowPrecision) {
+  // Decimal128 with precision <= 18 are computed in native integer lanes
+  auto ty = decimal128(18, 2);
+  auto left = ArrayFromJSON(
+      ty, R"(["1.23", "-4.56", null, "9999999999999999.99", "-9999999999999999.99",
+             "0.00", "-0.01"])");
+  auto right = ArrayFromJSON(
+      ty, R"(["7.89", "0.12", "1.00", "9999999999999999.99", "-0.01", null,
+             "-9999999999999999.99"])");
+  for (std::string suffix : {"", "_checked"}) {
+    CheckScalarBinary("add" + suffix, left, right,
+                      ArrayFromJSON(decimal128(19, 2), R"(["9.12", "-4.44", null,
+                                    "19999999999999999.98", "-10000000000000000.00",
+                                    null, "-10000000000000000.00"])"));
+    CheckScalarBinary("subtract" + suffix, left, right,
+                      ArrayFromJSON(decimal128(19, 2), R"(["-6.66", "-4.68", null,
+                                    "0.00", "-9999999999999999.98", null,
+                                    "9999999999999999.98"])"));
+    CheckScalarBinary("multiply" + suffix, left, right,
+                      ArrayFromJSON(decimal128(37, 4), R"(["9.7047", "-0.5472", null,
+                                    "99999999999999999800000000000000.0001",
+                                    "99999999999999.9999", null,
+                                    "99999999999999.9999"])"));
+    CheckScalarBinary("multiply" + suffix, ScalarFromJSON(ty, R"("-2.00")"), left,
+                      ArrayFromJSON(decimal128(37, 4), R"(["-2.4600", "9.1200", null,
+                                    "-19999999999999999.9800",
+                                    "19999999999999999.9800", "0.0000", "0.0200"])"));
+  }
+
+  // Values exceeding the declared precision may overflow an int64, the results must be
+  // the same as without narrowing
+  auto ViewAs = [](const std::shared_ptr<DataType>& type, const std::string& json,
+                   const std::shared_ptr<DataType>& view_type) {
+    return ArrayFromJSON(type, json)->View(view_type).ValueOrDie();
+  };
+  auto narrow = ViewAs(decimal128(19, 0), R"(["9000000000000000000", "1"])",
+                       decimal128(18, 0));
+  CheckScalarBinary("add", narrow, narrow,
+                    ViewAs(decimal128(20, 0), R"(["18000000000000000000", "2"])",
+                           decimal128(19, 0)));
+  CheckScalarBinary(
+      "subtract", narrow,
+      std::make_shared<Decimal128Scalar>(Decimal128("-9000000000000000000"),
+                                         decimal128(18, 0)),
+      ViewAs(decimal128(20, 0), R"(["18000000000000000000", "9000000000000000001"])",
+             decimal128(19, 0)));
+  CheckScalarBinary(
+      "multiply", narrow, narrow,
+      ViewAs(decimal128(38, 0), R"(["81000000000000000000000000000000000000", "1"])",
+             decimal128(37, 0)));
+}
+
 TEST_F(TestBinaryArithmeticDecimal, Divide) {
   // array array, decimal128
   {
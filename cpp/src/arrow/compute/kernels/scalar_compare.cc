@@ -22,6 +22,7 @@
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/scalar_dictionary_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 
@@ -346,6 +347,7 @@ struct CompareFunction : ScalarFunction {
     using arrow::compute::detail::DispatchExactImpl;
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
+    const std::vector<TypeHolder> original_types = *types;
     EnsureDictionaryDecoded(types);
     ReplaceNullWithOtherType(types);
 
@@ -357,6 +359,15 @@ struct CompareFunction : ScalarFunction {
       ReplaceTypes(type, types);
     }
 
+    // Keep dictionary arguments encoded if only the other argument needs a cast
+    std::vector<TypeHolder> dict_types = *types;
+    if (RestoreDictionaryTypes(original_types, &dict_types)) {
+      if (auto kernel = DispatchExactImpl(this, dict_types)) {
+        *types = std::move(dict_types);
+        return kernel;
+      }
+    }
+
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
     return arrow::compute::detail::NoMatchingKernel(this, *types);
   }
@@ -444,6 +455,9 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDo
     DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
 
+  // Compare dictionary values once rather than decoding dictionary arguments
+  DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kMapIndices));
+
   return func;
 }
 
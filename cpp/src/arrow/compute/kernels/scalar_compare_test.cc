@@ -982,9 +982,14 @@ TEST(TestCompareKernel, DispatchBest) {
     CheckDispatchBest(name, {float32(), int64()}, {float32(), float32()});
     CheckDispatchBest(name, {float64(), int32()}, {float64(), float64()});
 
+    // dictionaries are kept encoded if their value type is the common type
     CheckDispatchBest(name, {dictionary(int8(), float64()), float64()},
-                      {float64(), float64()});
+                      {dictionary(int8(), float64()), float64()});
     CheckDispatchBest(name, {dictionary(int8(), float64()), int16()},
+                      {dictionary(int8(), float64()), float64()});
+    CheckDispatchBest(name, {int16(), dictionary(int8(), float64())},
+                      {float64(), dictionary(int8(), float64())});
+    CheckDispatchBest(name, {dictionary(int8(), int16()), float64()},
                       {float64(), float64()});
 
     CheckDispatchBest(name, {timestamp(TimeUnit::MICRO), date64()},
@@ -1048,6 +1053,33 @@ TEST(TestCompareKernel, GreaterWithImplicitCasts) {
                     ArrayFromJSON(boolean(), "[false, false, false, null]"));
 }
 
+TEST(TestCompareKernel, DictionaryInputs) {
+  // the dictionary values are compared once, the result is mapped through the indices
+  auto dict_ty = dictionary(int32(), utf8());
+  auto dict =
+      DictArrayFromJSON(dict_ty, "[0, 1, null, 2, 1, 0]", R"(["foo", "bar", null])");
+  auto plain = ArrayFromJSON(utf8(), R"(["foo", "bar", null, null, "bar", "foo"])");
+  auto other = ArrayFromJSON(utf8(), R"(["foo", "baz", "foo", "foo", "bar", null])");
+  for (std::string name : {"equal", "not_equal", "less", "less_equal", "greater",
+                           "greater_equal"}) {
+    ARROW_SCOPED_TRACE(name);
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(name, {plain, other}));
+    CheckScalarBinary(name, dict, other, expected.make_array());
+
+    ASSERT_OK_AND_ASSIGN(expected, CallFunction(name, {plain, MakeScalar("bar")}));
+    CheckScalarBinary(name, dict, MakeScalar("bar"), expected.make_array());
+    ASSERT_OK_AND_ASSIGN(expected, CallFunction(name, {MakeScalar("bar"), plain}));
+    CheckScalarBinary(name, MakeScalar("bar"), dict, expected.make_array());
+
+    ASSERT_OK_AND_ASSIGN(expected, CallFunction(name, {plain, plain}));
+    CheckScalarBinary(name, dict, dict, expected.make_array());
+  }
+
+  // a dictionary with nulls in the indices and an all-null dictionary
+  CheckScalarBinary("equal", DictArrayFromJSON(dict_ty, "[null, 0, 0]", "[null]"),
+                    MakeScalar("foo"), ArrayFromJSON(boolean(), "[null, null, null]"));
+}
+
 TEST(TestCompareKernel, GreaterWithImplicitCastsUint64EdgeCase) {
   // int64 is as wide as we can promote
   CheckDispatchBest("greater", {int8(), uint64()}, {int64(), int64()});
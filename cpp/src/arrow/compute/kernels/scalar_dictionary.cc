@@ -0,0 +1,349 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/scalar_dictionary_internal.h"
+
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_dict.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+// Match dictionary types whose value type matches the given input type
+class DictionaryValueTypeMatcher : public TypeMatcher {
+ public:
+  explicit DictionaryValueTypeMatcher(InputType value_type)
+      : value_type_(std::move(value_type)) {}
+
+  bool Matches(const DataType& type) const override {
+    return type.id() == Type::DICTIONARY &&
+           value_type_.Matches(*checked_cast<const DictionaryType&>(type).value_type());
+  }
+
+  std::string ToString() const override {
+    return "dictionary<values=" + value_type_.ToString() + ">";
+  }
+
+  bool Equals(const TypeMatcher& other) const override {
+    if (this == &other) {
+      return true;
+    }
+    auto casted = dynamic_cast<const DictionaryValueTypeMatcher*>(&other);
+    return casted != nullptr && value_type_.Equals(casted->value_type_);
+  }
+
+ private:
+  InputType value_type_;
+};
+
+struct DictionaryKernelState : public KernelState {
+  struct Results {
+    // The function results for the dictionary values. With kMapIndices, if the
+    // function result for a null input is not null, it is appended as an extra
+    // value which null indices are mapped to.
+    Datum values;
+    bool map_null_indices = false;
+  };
+
+  DictionaryKernelState(const ScalarFunction* function, DictionaryKernelMode mode,
+                        const FunctionOptions* options)
+      : function(function), mode(mode), options(options ? options->Copy() : nullptr) {}
+
+  // Whether the cached results were computed for this dictionary and these
+  // scalar arguments
+  bool IsCached(const ArraySpan& dictionary,
+                const std::vector<std::shared_ptr<Scalar>>& scalars) const {
+    if (!cached_dictionary || !dictionary.child_data.empty() ||
+        dictionary.offset != cached_dictionary->offset ||
+        dictionary.length != cached_dictionary->length ||
+        dictionary.num_buffers() != static_cast<int>(cached_dictionary->buffers.size()) ||
+        scalars.size() != cached_scalars.size()) {
+      return false;
+    }
+    for (int i = 0; i < dictionary.num_buffers(); ++i) {
+      const auto& buffer = cached_dictionary->buffers[i];
+      if (dictionary.buffers[i].data != (buffer ? buffer->data() : nullptr)) {
+        return false;
+      }
+    }
+    for (size_t i = 0; i < scalars.size(); ++i) {
+      if (!scalars[i] != !cached_scalars[i] ||
+          (scalars[i] && !scalars[i]->Equals(*cached_scalars[i]))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Evaluate the function on the dictionary values of argument `dict_index`,
+  // the other arguments are given by `scalars`
+  Result<Results> GetResults(const ArraySpan& dictionary, int dict_index,
+                             std::vector<std::shared_ptr<Scalar>> scalars,
+                             ExecContext* ctx) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (IsCached(dictionary, scalars)) {
+      return cached_results;
+    }
+
+    std::shared_ptr<ArrayData> dictionary_data = dictionary.ToArrayData();
+    std::vector<Datum> args;
+    for (const auto& scalar : scalars) {
+      args.emplace_back(scalar);
+    }
+    Results results;
+    args[dict_index] = dictionary_data;
+    ARROW_ASSIGN_OR_RAISE(results.values, function->Execute(args, options.get(), ctx));
+    if (mode == DictionaryKernelMode::kMapIndices) {
+      args[dict_index] = MakeNullScalar(dictionary_data->type);
+      ARROW_ASSIGN_OR_RAISE(Datum null_result,
+                            function->Execute(args, options.get(), ctx));
+      std::shared_ptr<Array> null_value;
+      if (null_result.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(null_value, MakeArrayFromScalar(*null_result.scalar(), 1,
+                                                              ctx->memory_pool()));
+      } else {
+        null_value = null_result.make_array();
+      }
+      if (null_value->null_count() == 0) {
+        ARROW_ASSIGN_OR_RAISE(results.values,
+                              Concatenate({results.values.make_array(), null_value},
+                                          ctx->memory_pool()));
+        results.map_null_indices = true;
+      }
+    }
+
+    // Only cache results if the dictionary buffers identify its contents
+    if (dictionary.child_data.empty()) {
+      cached_dictionary = std::move(dictionary_data);
+      cached_scalars = std::move(scalars);
+      cached_results = results;
+    }
+    return results;
+  }
+
+  const ScalarFunction* function;
+  const DictionaryKernelMode mode;
+  const std::unique_ptr<FunctionOptions> options;
+  TypeHolder out_type;
+
+  std::mutex mutex;
+  // Keeps the buffers of the cached dictionary alive, so that they are not reused
+  // for another dictionary
+  std::shared_ptr<ArrayData> cached_dictionary;
+  std::vector<std::shared_ptr<Scalar>> cached_scalars;
+  Results cached_results;
+};
+
+Result<std::shared_ptr<Scalar>> DecodeScalar(const std::shared_ptr<Scalar>& scalar) {
+  if (scalar->type->id() != Type::DICTIONARY) {
+    return scalar;
+  }
+  return checked_cast<const DictionaryScalar&>(*scalar).GetEncodedValue();
+}
+
+// Fallback when the arguments are not one dictionary array and scalars:
+// decode all dictionaries and call the function on the decoded values
+Status ExecDecoded(KernelContext* ctx, DictionaryKernelState* state,
+                   const ExecSpan& batch, ExecResult* out) {
+  DCHECK_EQ(state->mode, DictionaryKernelMode::kMapIndices);
+  std::vector<Datum> args;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (batch[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto scalar, DecodeScalar(batch[i].scalar->GetSharedPtr()));
+      args.emplace_back(std::move(scalar));
+    } else if (batch[i].type()->id() == Type::DICTIONARY) {
+      auto dict_array = checked_pointer_cast<DictionaryArray>(batch[i].array.ToArray());
+      ARROW_ASSIGN_OR_RAISE(
+          Datum decoded, Take(dict_array->dictionary(), dict_array->indices(),
+                              TakeOptions::Defaults(), ctx->exec_context()));
+      args.push_back(std::move(decoded));
+    } else {
+      args.emplace_back(batch[i].array.ToArrayData());
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      Datum result,
+      state->function->Execute(args, state->options.get(), ctx->exec_context()));
+  out->value = result.array();
+  return Status::OK();
+}
+
+Status ExecDictionary(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  auto* state = checked_cast<DictionaryKernelState*>(ctx->state());
+
+  // Look for a single dictionary array argument, the others being scalars
+  int dict_index = -1;
+  std::vector<std::shared_ptr<Scalar>> scalars(batch.num_values());
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (batch[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(scalars[i], DecodeScalar(batch[i].scalar->GetSharedPtr()));
+    } else if (dict_index < 0 && batch[i].type()->id() == Type::DICTIONARY) {
+      dict_index = i;
+    } else {
+      return ExecDecoded(ctx, state, batch, out);
+    }
+  }
+  if (dict_index < 0) {
+    return ExecDecoded(ctx, state, batch, out);
+  }
+
+  const ArraySpan& indices_span = batch[dict_index].array;
+  ARROW_ASSIGN_OR_RAISE(
+      auto results, state->GetResults(indices_span.dictionary(), dict_index,
+                                       std::move(scalars), ctx->exec_context()));
+
+  std::shared_ptr<ArrayData> indices = indices_span.ToArrayData();
+  indices->dictionary = nullptr;
+  if (state->mode == DictionaryKernelMode::kTransformDictionary) {
+    indices->type = state->out_type.GetSharedPtr();
+    indices->dictionary = results.values.array();
+    out->value = std::move(indices);
+    return Status::OK();
+  }
+
+  indices->type = checked_cast<const DictionaryType&>(*indices_span.type).index_type();
+  Datum take_indices = indices;
+  if (results.map_null_indices && indices->GetNullCount() > 0) {
+    // Map null indices to the result for a null input, stored after the results
+    // for the dictionary values. That slot may not fit in the index type (e.g.
+    // int8 indices into 128 values), in which case the indices are widened.
+    const int64_t null_index = indices_span.dictionary().length;
+    const int bit_width = indices->type->bit_width();
+    const int64_t max_index = is_signed_integer(indices->type->id())
+                                  ? (int64_t{1} << (bit_width - 1)) - 1
+                                  : (bit_width < 63 ? (int64_t{1} << bit_width) - 1
+                                                    : std::numeric_limits<int64_t>::max());
+    if (null_index > max_index) {
+      ARROW_ASSIGN_OR_RAISE(take_indices, Cast(take_indices, int64(), CastOptions::Safe(),
+                                               ctx->exec_context()));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto null_index_scalar,
+                          MakeScalar(null_index)->CastTo(take_indices.type()));
+    ARROW_ASSIGN_OR_RAISE(take_indices,
+                          CallFunction("coalesce", {take_indices, null_index_scalar},
+                                       ctx->exec_context()));
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum mapped, Take(results.values, take_indices,
+                                           TakeOptions::Defaults(), ctx->exec_context()));
+  out->value = mapped.array();
+  return Status::OK();
+}
+
+Result<TypeHolder> ResolveDictionaryOutputType(KernelContext* ctx,
+                                               const std::vector<TypeHolder>&) {
+  return checked_cast<const DictionaryKernelState*>(ctx->state())->out_type;
+}
+
+KernelInit MakeDictionaryInit(const ScalarFunction* func, DictionaryKernelMode mode) {
+  return [func, mode](KernelContext* ctx, const KernelInitArgs& args)
+             -> Result<std::unique_ptr<KernelState>> {
+    auto state = std::make_unique<DictionaryKernelState>(func, mode, args.options);
+
+    // Resolve the output type of the function for the dictionary value types
+    std::vector<TypeHolder> value_types = args.inputs;
+    EnsureDictionaryDecoded(&value_types);
+    ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, func->DispatchBest(&value_types));
+    KernelContext kernel_ctx(ctx->exec_context(), kernel);
+    ARROW_ASSIGN_OR_RAISE(state->out_type,
+                          kernel->signature->out_type().Resolve(&kernel_ctx, value_types));
+    if (mode == DictionaryKernelMode::kTransformDictionary) {
+      const auto& dict_type = checked_cast<const DictionaryType&>(*args.inputs[0]);
+      state->out_type = dictionary(dict_type.index_type(),
+                                   state->out_type.GetSharedPtr(), dict_type.ordered());
+    }
+    return std::move(state);
+  };
+}
+
+}  // namespace
+
+Status AddDictionaryKernels(ScalarFunction* func, DictionaryKernelMode mode) {
+  const int num_args = func->arity().num_args;
+  if (func->arity().is_varargs || num_args < 1 || num_args > 2 ||
+      (mode == DictionaryKernelMode::kTransformDictionary && num_args != 1)) {
+    return Status::NotImplemented("Dictionary kernels for function '", func->name(),
+                                  "'");
+  }
+
+  ScalarKernel kernel;
+  kernel.exec = ExecDictionary;
+  kernel.init = MakeDictionaryInit(func, mode);
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  kernel.can_write_into_slices = false;
+  const OutputType out_type(ResolveDictionaryOutputType);
+
+  // For each existing kernel, accept a dictionary whose value type matches
+  // in place of each argument
+  std::vector<std::shared_ptr<KernelSignature>> signatures;
+  for (const ScalarKernel* existing : func->kernels()) {
+    const auto& in_types = existing->signature->in_types();
+    for (int i = 0; i < num_args; ++i) {
+      std::vector<InputType> dict_in_types = in_types;
+      dict_in_types[i] =
+          InputType(std::make_shared<DictionaryValueTypeMatcher>(in_types[i]));
+      signatures.push_back(KernelSignature::Make(std::move(dict_in_types), out_type));
+    }
+  }
+  for (auto& signature : signatures) {
+    kernel.signature = std::move(signature);
+    RETURN_NOT_OK(func->AddKernel(kernel));
+  }
+  return Status::OK();
+}
+
+bool RestoreDictionaryTypes(const std::vector<TypeHolder>& original_types,
+                            std::vector<TypeHolder>* types) {
+  bool restored = false;
+  for (size_t i = 0; i < types->size(); ++i) {
+    const DataType* original = original_types[i].type;
+    if (original != nullptr && original->id() == Type::DICTIONARY &&
+        checked_cast<const DictionaryType*>(original)->value_type()->Equals(
+            *(*types)[i])) {
+      (*types)[i] = original_types[i];
+      restored = true;
+    }
+  }
+  return restored;
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
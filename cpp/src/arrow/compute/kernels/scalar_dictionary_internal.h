@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "arrow/compute/function.h"
+#include "arrow/compute/type_fwd.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+enum class DictionaryKernelMode {
+  /// The results for the dictionary values are taken by the indices, so that the
+  /// output has the output type of the function (e.g. boolean for predicates)
+  kMapIndices,
+  /// The results for the dictionary values become the dictionary of the output,
+  /// which keeps the indices of the input (for unary value transforms)
+  kTransformDictionary,
+};
+
+/// \brief Add kernels evaluating a scalar function natively on dictionary input
+///
+/// Rather than decoding the dictionary-encoded argument, the function is evaluated
+/// once on the dictionary values (along with the other, scalar, arguments) and the
+/// results are mapped back through the indices. The results for the last seen
+/// dictionary are cached, so batches sharing a dictionary (e.g. batches read from
+/// the same Parquet column chunk) evaluate it only once. If the other arguments are
+/// not all scalars, the dictionaries are decoded and the function called as usual.
+///
+/// For each existing kernel and argument, a kernel is added accepting a dictionary
+/// whose value type matches that argument, so this must be called after adding
+/// the other kernels. The output type of the function must not depend on its
+/// kernel state.
+Status AddDictionaryKernels(ScalarFunction* func, DictionaryKernelMode mode);
+
+/// \brief Restore the dictionary types replaced by their value type in `types`
+///
+/// For use in DispatchBest after decoding dictionaries to find a common type: if
+/// that common type is the value type of a dictionary argument, the argument can
+/// stay dictionary-encoded. Return whether any type was restored.
+bool RestoreDictionaryTypes(const std::vector<TypeHolder>& original_types,
+                            std::vector<TypeHolder>* types);
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,247 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Row-wise hashing of one or several columns, backed by the same hash
+// functions as the hash join and the group by nodes
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/light_array.h"
+#include "arrow/compute/registry.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+// Mix the hash of a list element into the running hash of its list
+inline uint32_t CombineHashes(uint32_t seed, uint32_t hash) {
+  return seed ^ (hash + 0x9e3779b9U + (seed << 6) + (seed >> 2));
+}
+
+inline uint64_t CombineHashes(uint64_t seed, uint64_t hash) {
+  return seed ^ (hash + 0x9e3779b97f4a7c15ULL + (seed << 12) + (seed >> 4));
+}
+
+template <typename Hasher, typename HashType>
+struct FastHashImpl {
+  using HashArrowType = typename CTypeTraits<HashType>::ArrowType;
+
+  explicit FastHashImpl(ExecContext* ctx) : ctx(ctx) {}
+
+  // Hash the rows of `arrays`, which all have `length` elements
+  Status HashColumns(const std::vector<std::shared_ptr<ArrayData>>& arrays,
+                     int64_t length, HashType* out) {
+    std::vector<Datum> key_columns;
+    for (const auto& array : arrays) {
+      RETURN_NOT_OK(AppendKeyColumns(array, &key_columns));
+    }
+    if (key_columns.empty()) {
+      // e.g. a struct without fields, all its rows are equal
+      ARROW_ASSIGN_OR_RAISE(auto nulls,
+                            MakeArrayOfNull(uint8(), length, ctx->memory_pool()));
+      key_columns.emplace_back(std::move(nulls));
+    }
+    ExecBatch key_batch(std::move(key_columns), length);
+
+    util::TempVectorStack stack;
+    RETURN_NOT_OK(stack.Init(ctx->memory_pool(), 8 * util::MiniBatch::kMiniBatchLength *
+                                                     sizeof(uint64_t)));
+    const int64_t hardware_flags = ctx->cpu_info()->hardware_flags();
+    std::vector<KeyColumnArray> column_arrays;
+    for (int64_t start = 0; start < length; start += util::MiniBatch::kMiniBatchLength) {
+      const int64_t num_rows =
+          std::min<int64_t>(length - start, util::MiniBatch::kMiniBatchLength);
+      RETURN_NOT_OK(Hasher::HashBatch(key_batch, out + start, column_arrays,
+                                      hardware_flags, &stack, start, num_rows));
+    }
+    return Status::OK();
+  }
+
+  // Turn an input column into columns the row hasher understands
+  // (fixed-width, boolean, binary-like), recursing into nested types
+  Status AppendKeyColumns(const std::shared_ptr<ArrayData>& array,
+                          std::vector<Datum>* out) {
+    switch (array->type->id()) {
+      case Type::NA: {
+        // The row hasher doesn't expect the null type to have a value buffer
+        ARROW_ASSIGN_OR_RAISE(auto nulls, MakeArrayOfNull(uint8(), array->length,
+                                                          ctx->memory_pool()));
+        out->emplace_back(std::move(nulls));
+        return Status::OK();
+      }
+      case Type::EXTENSION: {
+        auto storage = array->Copy();
+        storage->type = checked_cast<const ExtensionType&>(*array->type).storage_type();
+        return AppendKeyColumns(storage, out);
+      }
+      case Type::DICTIONARY: {
+        // Hash the values, so that the hashes don't depend on the dictionary
+        auto indices = array->Copy();
+        indices->type = checked_cast<const DictionaryType&>(*array->type).index_type();
+        indices->dictionary = nullptr;
+        ARROW_ASSIGN_OR_RAISE(Datum decoded, Take(array->dictionary, indices,
+                                                  TakeOptions::Defaults(), ctx));
+        return AppendKeyColumns(decoded.array(), out);
+      }
+      case Type::STRUCT: {
+        const StructArray struct_array(array);
+        for (int i = 0; i < struct_array.num_fields(); ++i) {
+          ARROW_ASSIGN_OR_RAISE(auto field,
+                                struct_array.GetFlattenedField(i, ctx->memory_pool()));
+          RETURN_NOT_OK(AppendKeyColumns(field->data(), out));
+        }
+        return Status::OK();
+      }
+      case Type::LIST:
+        return AppendListHashes<ListArray>(array, out);
+      case Type::MAP:
+        return AppendListHashes<MapArray>(array, out);
+      case Type::LARGE_LIST:
+        return AppendListHashes<LargeListArray>(array, out);
+      case Type::FIXED_SIZE_LIST:
+        return AppendListHashes<FixedSizeListArray>(array, out);
+      default:
+        break;
+    }
+    RETURN_NOT_OK(ColumnMetadataFromDataType(array->type).status());
+    out->emplace_back(array);
+    return Status::OK();
+  }
+
+  // Hash the list values, then combine them per list into a fixed-width
+  // column which has the validity of the lists
+  template <typename ListArrayType>
+  Status AppendListHashes(const std::shared_ptr<ArrayData>& array,
+                          std::vector<Datum>* out) {
+    const ListArrayType list_array(array);
+    const int64_t length = list_array.length();
+    const auto& values = list_array.values()->data();
+
+    ARROW_ASSIGN_OR_RAISE(auto value_hashes,
+                          AllocateBuffer(values->length * sizeof(HashType),
+                                         ctx->memory_pool()));
+    auto value_hashes_data = reinterpret_cast<HashType*>(value_hashes->mutable_data());
+    RETURN_NOT_OK(HashColumns({values}, values->length, value_hashes_data));
+
+    ARROW_ASSIGN_OR_RAISE(auto list_hashes, AllocateBuffer(length * sizeof(HashType),
+                                                           ctx->memory_pool()));
+    auto list_hashes_data = reinterpret_cast<HashType*>(list_hashes->mutable_data());
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t begin = list_array.value_offset(i);
+      const int64_t end = begin + list_array.value_length(i);
+      // Seed with the list length, so that empty and null lists differ
+      HashType hash = CombineHashes(HashType{0}, static_cast<HashType>(end - begin));
+      for (int64_t j = begin; j < end; ++j) {
+        hash = CombineHashes(hash, value_hashes_data[j]);
+      }
+      list_hashes_data[i] = hash;
+    }
+
+    std::shared_ptr<Buffer> validity;
+    if (array->MayHaveNulls()) {
+      ARROW_ASSIGN_OR_RAISE(validity,
+                            arrow::internal::CopyBitmap(ctx->memory_pool(),
+                                                        array->buffers[0]->data(),
+                                                        array->offset, length));
+    }
+    out->emplace_back(ArrayData::Make(
+        TypeTraits<HashArrowType>::type_singleton(), length,
+        {std::move(validity), std::move(list_hashes)}, array->GetNullCount()));
+    return Status::OK();
+  }
+
+  ExecContext* ctx;
+};
+
+template <typename Hasher, typename HashType>
+Status FastHashExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  std::vector<std::shared_ptr<ArrayData>> arrays;
+  arrays.reserve(batch.num_values());
+  for (const ExecValue& value : batch.values) {
+    if (value.is_array()) {
+      arrays.push_back(value.array.ToArrayData());
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(*value.scalar, batch.length,
+                                                            ctx->memory_pool()));
+      arrays.push_back(array->data());
+    }
+  }
+  HashType* hashes = out->array_span_mutable()->GetValues<HashType>(1);
+  return FastHashImpl<Hasher, HashType>(ctx->exec_context())
+      .HashColumns(arrays, batch.length, hashes);
+}
+
+const FunctionDoc hash32_doc{
+    "Compute a 32-bit hash of each row",
+    ("The arguments are hashed row-wise: a row of the output is the hash of the\n"
+     "corresponding values of all arguments.  Nested types are hashed according\n"
+     "to their contents and dictionary arrays according to their decoded values.\n"
+     "Nulls are hashed as well, so the output never contains nulls.\n"
+     "The hash values are not stable across Arrow versions or platforms."),
+    {"*args"}};
+
+const FunctionDoc hash64_doc{
+    "Compute a 64-bit hash of each row",
+    ("The arguments are hashed row-wise: a row of the output is the hash of the\n"
+     "corresponding values of all arguments.  Nested types are hashed according\n"
+     "to their contents and dictionary arrays according to their decoded values.\n"
+     "Nulls are hashed as well, so the output never contains nulls.\n"
+     "The hash values are not stable across Arrow versions or platforms."),
+    {"*args"}};
+
+template <typename Hasher, typename HashType>
+std::shared_ptr<ScalarFunction> MakeFastHashFunction(std::string name,
+                                                     const FunctionDoc* doc) {
+  auto func = std::make_shared<ScalarFunction>(std::move(name), Arity::VarArgs(1), *doc);
+  using HashArrowType = typename CTypeTraits<HashType>::ArrowType;
+  ScalarKernel kernel(KernelSignature::Make({InputType::Any()},
+                                            TypeTraits<HashArrowType>::type_singleton(),
+                                            /*is_varargs=*/true),
+                      FastHashExec<Hasher, HashType>);
+  kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+  kernel.mem_allocation = MemAllocation::PREALLOCATE;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+  return func;
+}
+
+}  // namespace
+
+void RegisterScalarHash(FunctionRegistry* registry) {
+  DCHECK_OK(registry->AddFunction(
+      MakeFastHashFunction<Hashing32, uint32_t>("hash32", &hash32_doc)));
+  DCHECK_OK(registry->AddFunction(
+      MakeFastHashFunction<Hashing64, uint64_t>("hash64", &hash64_doc)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+constexpr int64_t kLength = 1 << 16;
+
+static void HashBench(benchmark::State& state, const std::string& func_name,
+                      const std::vector<Datum>& args) {
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(func_name, args).status());
+  }
+  state.SetItemsProcessed(state.iterations() * kLength);
+}
+
+static void HashInt64(benchmark::State& state, const std::string& func_name) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  HashBench(state, func_name,
+            {rand.Int64(kLength, 0, 1 << 20, /*null_probability=*/0.1)});
+}
+
+static void HashString(benchmark::State& state, const std::string& func_name) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  HashBench(state, func_name,
+            {rand.String(kLength, 0, 32, /*null_probability=*/0.1)});
+}
+
+static void HashMultiColumn(benchmark::State& state, const std::string& func_name) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  HashBench(state, func_name,
+            {rand.Int32(kLength, 0, 1 << 20, /*null_probability=*/0.1),
+             rand.Float64(kLength, 0, 1, /*null_probability=*/0.1),
+             rand.String(kLength, 0, 32, /*null_probability=*/0.1)});
+}
+
+static void HashList(benchmark::State& state, const std::string& func_name) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(kLength * 4, 0, 1 << 20, /*null_probability=*/0.1);
+  HashBench(state, func_name,
+            {rand.List(*values, kLength, /*null_probability=*/0.1)});
+}
+
+BENCHMARK_CAPTURE(HashInt64, hash32, "hash32");
+BENCHMARK_CAPTURE(HashInt64, hash64, "hash64");
+BENCHMARK_CAPTURE(HashString, hash32, "hash32");
+BENCHMARK_CAPTURE(HashString, hash64, "hash64");
+BENCHMARK_CAPTURE(HashMultiColumn, hash32, "hash32");
+BENCHMARK_CAPTURE(HashMultiColumn, hash64, "hash64");
+BENCHMARK_CAPTURE(HashList, hash32, "hash32");
+BENCHMARK_CAPTURE(HashList, hash64, "hash64");
+
+}  // namespace compute
+}  // namespace arrow
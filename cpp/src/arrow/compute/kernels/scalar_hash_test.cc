@@ -0,0 +1,250 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+template <typename HashType>
+std::vector<HashType> HashValues(const std::string& func_name,
+                                 const std::vector<Datum>& args) {
+  EXPECT_OK_AND_ASSIGN(Datum result, CallFunction(func_name, args));
+  const auto result_array = result.make_array();
+  ValidateOutput(*result_array);
+  EXPECT_EQ(result_array->null_count(), 0);
+  const auto* values = result_array->data()->GetValues<HashType>(1);
+  return std::vector<HashType>(values, values + result_array->length());
+}
+
+template <typename HashType>
+class TestScalarHash : public ::testing::Test {
+ protected:
+  const std::string func_name = sizeof(HashType) == 4 ? "hash32" : "hash64";
+
+  std::vector<HashType> Hash(const std::vector<Datum>& args) {
+    return HashValues<HashType>(func_name, args);
+  }
+
+  void AssertSameHashes(const std::vector<Datum>& left,
+                        const std::vector<Datum>& right) {
+    ASSERT_EQ(Hash(left), Hash(right));
+  }
+};
+
+using HashTypes = ::testing::Types<uint32_t, uint64_t>;
+TYPED_TEST_SUITE(TestScalarHash, HashTypes);
+
+}  // namespace
+
+TYPED_TEST(TestScalarHash, OutputType) {
+  auto arr = ArrayFromJSON(int32(), "[1, 2, null]");
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(this->func_name, {arr}));
+  AssertTypeEqual(result.type(), sizeof(TypeParam) == 4 ? uint32() : uint64());
+  ASSERT_EQ(result.length(), 3);
+}
+
+TYPED_TEST(TestScalarHash, Primitive) {
+  const std::vector<std::pair<std::shared_ptr<DataType>, std::string>> inputs = {
+      {int8(), "[1, 2, null, 1, 2]"},
+      {int32(), "[1, 2, null, 1, 2]"},
+      {uint64(), "[1, 2, null, 1, 2]"},
+      {float64(), "[1.5, 2.5, null, 1.5, 2.5]"},
+      {date32(), "[1, 2, null, 1, 2]"},
+      {boolean(), "[true, false, null, true, false]"},
+      {utf8(), R"(["1", "2", null, "1", "2"])"},
+      {large_binary(), R"(["1", "2", null, "1", "2"])"},
+      {fixed_size_binary(3), R"(["abc", "def", null, "abc", "def"])"},
+      {decimal128(10, 2), R"(["1.00", "2.00", null, "1.00", "2.00"])"},
+  };
+  for (const auto& input : inputs) {
+    ARROW_SCOPED_TRACE("type = ", input.first->ToString());
+    auto arr = ArrayFromJSON(input.first, input.second);
+    auto hashes = this->Hash({arr});
+    ASSERT_EQ(hashes[0], hashes[3]);
+    ASSERT_EQ(hashes[1], hashes[4]);
+    ASSERT_NE(hashes[0], hashes[1]);
+    ASSERT_NE(hashes[0], hashes[2]);
+
+    // hashes don't depend on the position of a row in the input
+    auto sliced = this->Hash({arr->Slice(3)});
+    ASSERT_EQ(sliced[0], hashes[3]);
+    ASSERT_EQ(sliced[1], hashes[4]);
+  }
+}
+
+TYPED_TEST(TestScalarHash, MatchesRowHasher) {
+  auto ints = ArrayFromJSON(int64(), "[1, 2, null, 4]");
+  auto strs = ArrayFromJSON(utf8(), R"(["a", null, "c", "d"])");
+  ExecBatch batch({ints, strs}, ints->length());
+
+  std::vector<TypeParam> expected(batch.length);
+  std::vector<KeyColumnArray> column_arrays;
+  util::TempVectorStack stack;
+  ASSERT_OK(stack.Init(default_memory_pool(),
+                       8 * util::MiniBatch::kMiniBatchLength * sizeof(uint64_t)));
+  const int64_t hardware_flags =
+      arrow::internal::CpuInfo::GetInstance()->hardware_flags();
+  if (sizeof(TypeParam) == 4) {
+    ASSERT_OK(Hashing32::HashBatch(batch, reinterpret_cast<uint32_t*>(expected.data()),
+                                   column_arrays, hardware_flags, &stack, 0,
+                                   batch.length));
+  } else {
+    ASSERT_OK(Hashing64::HashBatch(batch, reinterpret_cast<uint64_t*>(expected.data()),
+                                   column_arrays, hardware_flags, &stack, 0,
+                                   batch.length));
+  }
+  ASSERT_EQ(this->Hash({ints, strs}), expected);
+}
+
+TYPED_TEST(TestScalarHash, MultipleColumns) {
+  auto ints = ArrayFromJSON(int32(), "[1, 1, 2, 1, null]");
+  auto strs = ArrayFromJSON(utf8(), R"(["a", "b", "a", "a", "a"])");
+  auto hashes = this->Hash({ints, strs});
+  ASSERT_EQ(hashes[0], hashes[3]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[2]);
+  ASSERT_NE(hashes[0], hashes[4]);
+
+  // the order of the arguments matters
+  ASSERT_NE(this->Hash({strs, ints}), hashes);
+}
+
+TYPED_TEST(TestScalarHash, Scalars) {
+  auto ints = ArrayFromJSON(int32(), "[1, 2, 3]");
+  this->AssertSameHashes({ints, ScalarFromJSON(utf8(), R"("foo")")},
+                         {ints, ArrayFromJSON(utf8(), R"(["foo", "foo", "foo"])")});
+  this->AssertSameHashes({ints, ScalarFromJSON(utf8(), "null")},
+                         {ints, ArrayFromJSON(utf8(), "[null, null, null]")});
+}
+
+TYPED_TEST(TestScalarHash, Dictionary) {
+  // dictionary arrays hash like their decoded values, whatever the dictionary
+  auto dict_type = dictionary(int8(), utf8());
+  auto left = DictArrayFromJSON(dict_type, "[0, 1, null, 1]", R"(["a", "b"])");
+  auto right = DictArrayFromJSON(dict_type, "[2, 0, 1, 0]", R"(["b", null, "a"])");
+  auto decoded = ArrayFromJSON(utf8(), R"(["a", "b", null, "b"])");
+  this->AssertSameHashes({left}, {decoded});
+  this->AssertSameHashes({right}, {decoded});
+}
+
+TYPED_TEST(TestScalarHash, Struct) {
+  // a struct hashes like its flattened fields
+  auto type = struct_({field("a", int32()), field("b", utf8())});
+  auto arr = ArrayFromJSON(type, R"([{"a": 1, "b": "x"}, {"a": 2, "b": null},
+                                     {"a": 1, "b": "x"}, {"a": null, "b": "x"}])");
+  this->AssertSameHashes(
+      {arr}, {ArrayFromJSON(int32(), "[1, 2, 1, null]"),
+              ArrayFromJSON(utf8(), R"(["x", null, "x", "x"])")});
+
+  auto empty_type = struct_({});
+  auto empty = ArrayFromJSON(empty_type, "[{}, {}, {}]");
+  auto hashes = this->Hash({empty});
+  ASSERT_EQ(hashes[0], hashes[1]);
+  ASSERT_EQ(hashes[0], hashes[2]);
+}
+
+TYPED_TEST(TestScalarHash, List) {
+  for (const auto& type :
+       {list(int32()), large_list(int32()), map(int32(), int32())}) {
+    ARROW_SCOPED_TRACE("type = ", type->ToString());
+    const char* json = type->id() == Type::MAP
+                           ? "[[[1, 2]], [[2, 1]], [[1, 2]], [], null, [[1, 2], [3, 4]]]"
+                           : "[[1, 2], [2, 1], [1, 2], [], null, [1, 2, 3]]";
+    auto arr = ArrayFromJSON(type, json);
+    auto hashes = this->Hash({arr});
+    ASSERT_EQ(hashes[0], hashes[2]);
+    ASSERT_NE(hashes[0], hashes[1]);
+    ASSERT_NE(hashes[0], hashes[5]);
+    ASSERT_NE(hashes[3], hashes[4]);
+
+    auto sliced = this->Hash({arr->Slice(2, 2)});
+    ASSERT_EQ(sliced[0], hashes[2]);
+    ASSERT_EQ(sliced[1], hashes[3]);
+  }
+
+  auto fixed = ArrayFromJSON(fixed_size_list(utf8(), 2),
+                             R"([["a", "b"], ["b", "a"], null, ["a", "b"]])");
+  auto hashes = this->Hash({fixed});
+  ASSERT_EQ(hashes[0], hashes[3]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[2]);
+}
+
+TYPED_TEST(TestScalarHash, NestedList) {
+  auto type = struct_({field("a", list(struct_({field("b", utf8())})))});
+  auto arr = ArrayFromJSON(type, R"([{"a": [{"b": "x"}, {"b": null}]},
+                                     {"a": [{"b": "x"}]},
+                                     {"a": [{"b": "x"}, {"b": null}]},
+                                     {"a": null}])");
+  auto hashes = this->Hash({arr});
+  ASSERT_EQ(hashes[0], hashes[2]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[3]);
+}
+
+TYPED_TEST(TestScalarHash, ChunkedArray) {
+  auto chunked = ChunkedArrayFromJSON(utf8(), {R"(["a", "b"])", R"(["c", null, "a"])"});
+  auto hashes = this->Hash({ArrayFromJSON(utf8(), R"(["a", "b", "c", null, "a"])")});
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(this->func_name, {chunked}));
+  ASSERT_EQ(result.kind(), Datum::CHUNKED_ARRAY);
+  ASSERT_OK_AND_ASSIGN(auto concatenated,
+                       Concatenate(result.chunked_array()->chunks()));
+  const auto* values = concatenated->data()->template GetValues<TypeParam>(1);
+  ASSERT_EQ(std::vector<TypeParam>(values, values + concatenated->length()), hashes);
+}
+
+TYPED_TEST(TestScalarHash, Random) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  const int64_t length = 3 * util::MiniBatch::kMiniBatchLength + 17;
+  auto ints = rand.Int64(length, 0, 100, /*null_probability=*/0.1);
+  auto strs = rand.String(length, 0, 10, /*null_probability=*/0.1);
+  auto hashes = this->Hash({ints, strs});
+  // the same rows hash the same, wherever they are located
+  auto sliced = this->Hash({ints->Slice(1000), strs->Slice(1000)});
+  for (size_t i = 0; i < sliced.size(); ++i) {
+    ASSERT_EQ(sliced[i], hashes[i + 1000]);
+  }
+}
+
+TYPED_TEST(TestScalarHash, UnsupportedType) {
+  auto arr = ArrayFromJSON(dense_union({field("a", int32())}, {0}), "[[0, 1]]");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(TypeError,
+                                  ::testing::HasSubstr("Unsupported column data type"),
+                                  CallFunction(this->func_name, {arr}));
+}
+
+}  // namespace compute
+}  // namespace arrow
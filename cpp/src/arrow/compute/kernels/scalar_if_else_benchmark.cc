@@ -21,6 +21,7 @@
 #include "arrow/array/concatenate.h"
 #include "arrow/array/util.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/exec/expression.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/key_value_metadata.h"
@@ -403,6 +404,91 @@ static void ChooseBench64(benchmark::State& state) {
   return ChooseBench<Int64Type>(state);
 }
 
+#ifdef ARROW_WITH_RE2
+
+// Conditional expressions with a branch which is expensive to evaluate (a regex
+// replacement), picked for `state.range(1)` percent of the rows. Expressions only
+// evaluate the branch over those rows, unless `state.range(2)` is 0 where the
+// arguments are evaluated over the whole batch before calling the function.
+static void CostlyBranchBench(benchmark::State& state, const Expression& expr,
+                              const Schema& schema, const ExecBatch& batch) {
+  const bool short_circuit = state.range(2) != 0;
+  ASSERT_OK_AND_ASSIGN(auto bound, expr.Bind(schema));
+  for (auto _ : state) {
+    if (short_circuit) {
+      ABORT_NOT_OK(ExecuteScalarExpression(bound, batch));
+    } else {
+      const Expression::Call* call = bound.call();
+      std::vector<Datum> arguments;
+      for (const Expression& arg : call->arguments) {
+        ASSERT_OK_AND_ASSIGN(auto argument, ExecuteScalarExpression(arg, batch));
+        arguments.push_back(std::move(argument));
+      }
+      ABORT_NOT_OK(CallFunction(call->function_name, arguments, call->options.get()));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * batch.length);
+}
+
+static Expression CostlyBranch() {
+  ReplaceSubstringOptions options("[aeiou]+([^aeiou]*)", "\\1");
+  return call("binary_length",
+              {call("replace_substring_regex", {field_ref("str")}, std::move(options))});
+}
+
+static void IfElseCostlyBranchBench(benchmark::State& state) {
+  const int64_t len = state.range(0);
+  const double picked = state.range(1) / 100.0;
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  auto schema = arrow::schema({field("cond", boolean()), field("str", utf8())});
+  ExecBatch batch({rand.Boolean(len, picked, /*null_probability=*/0.01),
+                   rand.String(len, /*min_length=*/8, /*max_length=*/32,
+                               /*null_probability=*/0.01)},
+                  len);
+  CostlyBranchBench(
+      state, call("if_else", {field_ref("cond"), CostlyBranch(), literal(int32_t(-1))}),
+      *schema, batch);
+}
+
+static void CaseWhenCostlyBranchBench(benchmark::State& state) {
+  const int64_t len = state.range(0);
+  const double picked = state.range(1) / 100.0;
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  auto schema = arrow::schema({field("cond", boolean()), field("str", utf8())});
+  ExecBatch batch({rand.Boolean(len, picked, /*null_probability=*/0.01),
+                   rand.String(len, /*min_length=*/8, /*max_length=*/32,
+                               /*null_probability=*/0.01)},
+                  len);
+  auto conds = call("make_struct", {field_ref("cond")}, MakeStructOptions({"cond"}));
+  CostlyBranchBench(state,
+                    call("case_when", {conds, CostlyBranch(), literal(int32_t(-1))}),
+                    *schema, batch);
+}
+
+static void CoalesceCostlyBranchBench(benchmark::State& state) {
+  const int64_t len = state.range(0);
+  const double picked = state.range(1) / 100.0;
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  auto schema = arrow::schema({field("value", int32()), field("str", utf8())});
+  ExecBatch batch({rand.Int32(len, /*min=*/0, /*max=*/100, /*null_probability=*/picked),
+                   rand.String(len, /*min_length=*/8, /*max_length=*/32,
+                               /*null_probability=*/0.01)},
+                  len);
+  CostlyBranchBench(state, call("coalesce", {field_ref("value"), CostlyBranch()}),
+                    *schema, batch);
+}
+
+void CostlyBranchSetArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"length", "picked_percent", "short_circuit"});
+  for (int64_t picked : {1, 10, 50, 100}) {
+    for (int64_t short_circuit : {0, 1}) {
+      bench->Args({kFewItems, picked, short_circuit});
+    }
+  }
+}
+
+#endif  // ARROW_WITH_RE2
+
 BENCHMARK(IfElseBench32)->Args({kNumItems, 0});
 BENCHMARK(IfElseBench64)->Args({kNumItems, 0});
 
@@ -455,5 +541,11 @@ BENCHMARK(CoalesceScalarStringBench)->Apply(CoalesceSetBinaryArgs);
 BENCHMARK(ChooseBench64)->Args({kNumItems, 0});
 BENCHMARK(ChooseBench64)->Args({kNumItems, 99});
 
+#ifdef ARROW_WITH_RE2
+BENCHMARK(IfElseCostlyBranchBench)->Apply(CostlyBranchSetArgs);
+BENCHMARK(CaseWhenCostlyBranchBench)->Apply(CostlyBranchSetArgs);
+BENCHMARK(CoalesceCostlyBranchBench)->Apply(CostlyBranchSetArgs);
+#endif  // ARROW_WITH_RE2
+
 }  // namespace compute
 }  // namespace arrow
@@ -19,6 +19,7 @@
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/scalar_dictionary_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_writer.h"
@@ -512,6 +513,8 @@ struct SetLookupFunction : ScalarFunction {
   using ScalarFunction::ScalarFunction;
 
   Result<const Kernel*> DispatchBest(std::vector<TypeHolder>* values) const override {
+    using arrow::compute::detail::DispatchExactImpl;
+    if (auto kernel = DispatchExactImpl(this, *values)) return kernel;
     EnsureDictionaryDecoded(values);
     return DispatchExact(*values);
   }
@@ -532,6 +535,7 @@ void RegisterScalarSetLookup(FunctionRegistry* registry) {
 
     isin_base.signature = KernelSignature::Make({null()}, boolean());
     DCHECK_OK(is_in->AddKernel(isin_base));
+    DCHECK_OK(AddDictionaryKernels(is_in.get(), DictionaryKernelMode::kMapIndices));
     DCHECK_OK(registry->AddFunction(is_in));
 
     DCHECK_OK(registry->AddFunction(std::make_shared<IsInMetaBinary>()));
@@ -550,6 +554,7 @@ void RegisterScalarSetLookup(FunctionRegistry* registry) {
 
     index_in_base.signature = KernelSignature::Make({null()}, int32());
     DCHECK_OK(index_in->AddKernel(index_in_base));
+    DCHECK_OK(AddDictionaryKernels(index_in.get(), DictionaryKernelMode::kMapIndices));
     DCHECK_OK(registry->AddFunction(index_in));
 
     DCHECK_OK(registry->AddFunction(std::make_shared<IndexInMetaBinary>()));
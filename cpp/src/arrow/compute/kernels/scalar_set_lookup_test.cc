@@ -437,6 +437,56 @@ TEST_F(TestIsInKernel, DictionaryArray) {
   }
 }
 
+TEST_F(TestIsInKernel, DictionaryChunks) {
+  // chunks sharing a dictionary reuse the lookup results, others are looked up again
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["A", "B", null])");
+  auto other_dict = ArrayFromJSON(utf8(), R"(["C", "A"])");
+  ASSERT_OK_AND_ASSIGN(
+      auto chunk0,
+      DictionaryArray::FromArrays(dict_type, ArrayFromJSON(int8(), "[0, 1, 2, null]"),
+                                  dict));
+  ASSERT_OK_AND_ASSIGN(
+      auto chunk1,
+      DictionaryArray::FromArrays(dict_type, ArrayFromJSON(int8(), "[1, 1, 0]"), dict));
+  ASSERT_OK_AND_ASSIGN(
+      auto chunk2, DictionaryArray::FromArrays(
+                       dict_type, ArrayFromJSON(int8(), "[0, 1, null]"), other_dict));
+  auto input = std::make_shared<ChunkedArray>(ArrayVector{chunk0, chunk1, chunk2});
+  auto value_set = ChunkedArrayFromJSON(utf8(), {R"(["A", null])"});
+
+  auto expected = ChunkedArrayFromJSON(
+      boolean(), {"[true, false, true, true, false, false, true, false, true, true]"});
+  ASSERT_OK_AND_ASSIGN(Datum actual, IsIn(input, SetLookupOptions(value_set)));
+  ValidateOutput(actual);
+  AssertChunkedEquivalent(*expected, *actual.chunked_array());
+
+  expected = ChunkedArrayFromJSON(
+      boolean(), {"[true, false, false, false, false, false, true, false, true, false]"});
+  ASSERT_OK_AND_ASSIGN(actual,
+                       IsIn(input, SetLookupOptions(value_set, /*skip_nulls=*/true)));
+  ValidateOutput(actual);
+  AssertChunkedEquivalent(*expected, *actual.chunked_array());
+}
+
+TEST_F(TestIsInKernel, DictionaryNullIndexOutOfIndexRange) {
+  // null indices are mapped to the slot after the last dictionary value, which
+  // doesn't fit in int8 indices here
+  StringBuilder builder;
+  for (int i = 0; i < 128; ++i) {
+    ASSERT_OK(builder.Append("v" + std::to_string(i)));
+  }
+  ASSERT_OK_AND_ASSIGN(auto dict, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto input, DictionaryArray::FromArrays(
+                                       dictionary(int8(), utf8()),
+                                       ArrayFromJSON(int8(), "[0, 127, null]"), dict));
+  auto value_set = ArrayFromJSON(utf8(), R"(["v0", null])");
+  ASSERT_OK_AND_ASSIGN(Datum actual, IsIn(input, SetLookupOptions(value_set)));
+  ValidateOutput(actual);
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false, true]"),
+                    *actual.make_array(), /*verbose=*/true);
+}
+
 TEST_F(TestIsInKernel, ChunkedArrayInvoke) {
   auto input = ChunkedArrayFromJSON(
       utf8(), {R"(["abc", "def", "", "abc", "jkl"])", R"(["def", null, "abc", "zzz"])"});
@@ -1064,7 +1114,7 @@ TEST_F(TestIndexInKernel, ChunkedArrayInvoke) {
 TEST(TestSetLookup, DispatchBest) {
   for (std::string name : {"is_in", "index_in"}) {
     CheckDispatchBest(name, {int32()}, {int32()});
-    CheckDispatchBest(name, {dictionary(int32(), utf8())}, {utf8()});
+    CheckDispatchBest(name, {dictionary(int32(), utf8())}, {dictionary(int32(), utf8())});
   }
 }
 
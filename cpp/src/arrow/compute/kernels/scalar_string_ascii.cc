@@ -20,14 +20,17 @@
 #include <iterator>
 #include <memory>
 #include <string>
+#include <vector>
 
 #ifdef ARROW_WITH_RE2
 #include <re2/re2.h>
+#include <re2/set.h>
 #endif
 
 #include "arrow/array/builder_nested.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/cache_internal.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string.h"
 #include "arrow/util/value_parsing.h"
@@ -76,6 +79,75 @@ template <typename T>
 RE2::Options MakeRE2Options(bool ignore_case = false, bool literal = false) {
   return MakeRE2Options(T::is_utf8, ignore_case, literal);
 }
+
+// Compiling a regex is often more expensive than matching it against a whole
+// batch, and kernels are executed once per batch: compiled regexes are cached
+// process-wide, and shared between kernel invocations and threads (matching
+// against a RE2 or a RE2::Set is thread-safe).
+constexpr int32_t kRegexCacheCapacity = 256;
+
+// The options are encoded as a prefix of the cache key
+std::string RegexCacheKeyPrefix(bool is_utf8, bool ignore_case, bool literal) {
+  return {is_utf8 ? 'u' : 'b', ignore_case ? 'i' : 'c', literal ? 'l' : 'r'};
+}
+
+RE2::Options RegexCacheKeyOptions(const std::string& key) {
+  return MakeRE2Options(key[0] == 'u', key[1] == 'i', key[2] == 'l');
+}
+
+constexpr size_t kRegexCacheKeyPrefixLength = 3;
+
+std::shared_ptr<const RE2> GetRegex(const std::string& pattern, bool is_utf8,
+                                    bool ignore_case = false, bool literal = false) {
+  static auto cached_compile = ::arrow::internal::MemoizeLru(
+      [](const std::string& key) -> std::shared_ptr<const RE2> {
+        return std::make_shared<RE2>(key.substr(kRegexCacheKeyPrefixLength),
+                                     RegexCacheKeyOptions(key));
+      },
+      kRegexCacheCapacity);
+  return cached_compile(RegexCacheKeyPrefix(is_utf8, ignore_case, literal) + pattern);
+}
+
+template <typename T>
+std::shared_ptr<const RE2> GetRegex(const std::string& pattern) {
+  return GetRegex(pattern, T::is_utf8);
+}
+
+// Like GetRegex, for a set of regexes matched together in a single pass
+Result<std::shared_ptr<const RE2::Set>> GetRegexSet(
+    const std::vector<std::string>& patterns, bool is_utf8, bool ignore_case = false) {
+  static auto cached_compile = ::arrow::internal::MemoizeLru(
+      [](const std::string& key) -> Result<std::shared_ptr<const RE2::Set>> {
+        auto set =
+            std::make_shared<RE2::Set>(RegexCacheKeyOptions(key), RE2::UNANCHORED);
+        // The patterns are separated by their length
+        std::string_view remaining(key);
+        remaining.remove_prefix(kRegexCacheKeyPrefixLength);
+        while (!remaining.empty()) {
+          const auto separator = remaining.find(':');
+          const auto length = std::stoull(std::string(remaining.substr(0, separator)));
+          const auto pattern = remaining.substr(separator + 1, length);
+          remaining.remove_prefix(separator + 1 + length);
+          std::string error;
+          if (set->Add(ToStringPiece(pattern), &error) < 0) {
+            return Status::Invalid("Invalid regular expression '", pattern,
+                                   "': ", error);
+          }
+        }
+        if (!set->Compile()) {
+          return Status::Invalid("Regular expression set is too large to compile");
+        }
+        return set;
+      },
+      kRegexCacheCapacity);
+  std::string key = RegexCacheKeyPrefix(is_utf8, ignore_case, /*literal=*/false);
+  for (const auto& pattern : patterns) {
+    key += std::to_string(pattern.size());
+    key += ':';
+    key += pattern;
+  }
+  return cached_compile(key);
+}
 #endif
 
 // ----------------------------------------------------------------------
@@ -1307,24 +1379,23 @@ struct PlainEndsWithMatcher {
 #ifdef ARROW_WITH_RE2
 struct RegexSubstringMatcher {
   const MatchSubstringOptions& options_;
-  const RE2 regex_match_;
+  const std::shared_ptr<const RE2> regex_match_;
 
   static Result<std::unique_ptr<RegexSubstringMatcher>> Make(
       const MatchSubstringOptions& options, bool is_utf8 = true, bool literal = false) {
     auto matcher = std::make_unique<RegexSubstringMatcher>(options, is_utf8, literal);
-    RETURN_NOT_OK(RegexStatus(matcher->regex_match_));
+    RETURN_NOT_OK(RegexStatus(*matcher->regex_match_));
     return std::move(matcher);
   }
 
   explicit RegexSubstringMatcher(const MatchSubstringOptions& options,
                                  bool is_utf8 = true, bool literal = false)
       : options_(options),
-        regex_match_(options_.pattern,
-                     MakeRE2Options(is_utf8, options.ignore_case, literal)) {}
+        regex_match_(GetRegex(options_.pattern, is_utf8, options.ignore_case, literal)) {}
 
   bool Match(std::string_view current) const {
     auto piece = re2::StringPiece(current.data(), current.length());
-    return RE2::PartialMatch(piece, regex_match_);
+    return RE2::PartialMatch(piece, *regex_match_);
   }
 };
 #endif
@@ -1377,6 +1448,44 @@ struct MatchSubstring<Type, RegexSubstringMatcher> {
                                                                  matcher.get());
   }
 };
+
+// Match against several regexes in a single pass
+struct RegexSetMatcher {
+  // null if there are no regexes to match
+  const std::shared_ptr<const RE2::Set> regex_set_;
+
+  static Result<std::unique_ptr<RegexSetMatcher>> Make(
+      const MatchAnyRegexOptions& options, bool is_utf8 = true) {
+    if (options.patterns.empty()) {
+      return std::make_unique<RegexSetMatcher>(nullptr);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto regex_set,
+                          GetRegexSet(options.patterns, is_utf8, options.ignore_case));
+    return std::make_unique<RegexSetMatcher>(std::move(regex_set));
+  }
+
+  explicit RegexSetMatcher(std::shared_ptr<const RE2::Set> regex_set)
+      : regex_set_(std::move(regex_set)) {}
+
+  bool Match(std::string_view current) const {
+    // Without a vector of matching regexes, the search stops at the first match
+    return regex_set_ != nullptr &&
+           regex_set_->Match(ToStringPiece(current), /*v=*/nullptr);
+  }
+};
+
+using MatchAnyRegexState = OptionsWrapper<MatchAnyRegexOptions>;
+
+template <typename Type>
+struct MatchAnyRegex {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    ARROW_ASSIGN_OR_RAISE(auto matcher,
+                          RegexSetMatcher::Make(MatchAnyRegexState::Get(ctx),
+                                                /*is_utf8=*/Type::is_utf8));
+    return MatchSubstringImpl<Type, RegexSetMatcher>::Exec(ctx, batch, out,
+                                                           matcher.get());
+  }
+};
 #endif
 
 template <typename Type>
@@ -1595,6 +1704,16 @@ const FunctionDoc match_substring_regex_doc(
      "Null inputs emit null."),
     {"strings"}, "MatchSubstringOptions", /*options_required=*/true);
 
+const FunctionDoc match_any_regex_doc(
+    "Match strings against several regex patterns",
+    ("For each string in `strings`, emit true iff it matches any of the given\n"
+     "patterns at any position. All patterns are evaluated in a single pass.\n"
+     "The patterns must be given in MatchAnyRegexOptions.\n"
+     "If ignore_case is set, only simple case folding is performed.\n"
+     "\n"
+     "Null inputs emit null."),
+    {"strings"}, "MatchAnyRegexOptions", /*options_required=*/true);
+
 const FunctionDoc match_like_doc(
     "Match strings against SQL-style LIKE pattern",
     ("For each string in `strings`, emit true iff it matches a given pattern\n"
@@ -1614,6 +1733,7 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kMapIndices));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1625,6 +1745,7 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kMapIndices));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1635,6 +1756,7 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kMapIndices));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #ifdef ARROW_WITH_RE2
@@ -1646,6 +1768,18 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kMapIndices));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<ScalarFunction>("match_any_regex", Arity::Unary(),
+                                                 match_any_regex_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchAnyRegex>(ty);
+      DCHECK_OK(
+          func->AddKernel({ty}, boolean(), std::move(exec), MatchAnyRegexState::Init));
+    }
+    DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kMapIndices));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1656,6 +1790,7 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kMapIndices));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #endif
@@ -1677,7 +1812,7 @@ struct FindSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct FindSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
+  std::shared_ptr<const RE2> regex_match_;
 
   static Result<FindSubstringRegex> Make(const MatchSubstringOptions& options,
                                          bool is_utf8 = true, bool literal = false) {
@@ -1692,8 +1827,7 @@ struct FindSubstringRegex {
     regex.reserve(options.pattern.length() + 2);
     regex += literal ? RE2::QuoteMeta(options.pattern) : options.pattern;
     regex += ")";
-    regex_match_ = std::make_unique<RE2>(
-        regex, MakeRE2Options(is_utf8, options.ignore_case, /*literal=*/false));
+    regex_match_ = GetRegex(regex, is_utf8, options.ignore_case, /*literal=*/false);
   }
 
   template <typename OutValue, typename... Ignored>
@@ -1819,12 +1953,11 @@ struct CountSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct CountSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
+  std::shared_ptr<const RE2> regex_match_;
 
   explicit CountSubstringRegex(const MatchSubstringOptions& options, bool is_utf8 = true,
                                bool literal = false)
-      : regex_match_(new RE2(options.pattern,
-                             MakeRE2Options(is_utf8, options.ignore_case, literal))) {}
+      : regex_match_(GetRegex(options.pattern, is_utf8, options.ignore_case, literal)) {}
 
   static Result<CountSubstringRegex> Make(const MatchSubstringOptions& options,
                                           bool is_utf8 = true, bool literal = false) {
@@ -2036,19 +2169,19 @@ struct PlainSubstringReplacer {
 template <typename Type>
 struct RegexSubstringReplacer {
   const ReplaceSubstringOptions& options_;
-  const RE2 regex_find_;
-  const RE2 regex_replacement_;
+  const std::shared_ptr<const RE2> regex_find_;
+  const std::shared_ptr<const RE2> regex_replacement_;
 
   static Result<std::unique_ptr<RegexSubstringReplacer>> Make(
       const ReplaceSubstringOptions& options) {
     auto replacer = std::make_unique<RegexSubstringReplacer>(options);
 
-    RETURN_NOT_OK(RegexStatus(replacer->regex_find_));
-    RETURN_NOT_OK(RegexStatus(replacer->regex_replacement_));
+    RETURN_NOT_OK(RegexStatus(*replacer->regex_find_));
+    RETURN_NOT_OK(RegexStatus(*replacer->regex_replacement_));
 
     std::string replacement_error;
-    if (!replacer->regex_replacement_.CheckRewriteString(replacer->options_.replacement,
-                                                         &replacement_error)) {
+    if (!replacer->regex_replacement_->CheckRewriteString(
+            replacer->options_.replacement, &replacement_error)) {
       return Status::Invalid("Invalid replacement string: ",
                              std::move(replacement_error));
     }
@@ -2060,8 +2193,8 @@ struct RegexSubstringReplacer {
   // we have 2 regexes, one with () around it, one without.
   explicit RegexSubstringReplacer(const ReplaceSubstringOptions& options)
       : options_(options),
-        regex_find_("(" + options_.pattern + ")", MakeRE2Options<Type>()),
-        regex_replacement_(options_.pattern, MakeRE2Options<Type>()) {}
+        regex_find_(GetRegex<Type>("(" + options_.pattern + ")")),
+        regex_replacement_(GetRegex<Type>(options_.pattern)) {}
 
   Status ReplaceString(std::string_view s, TypedBufferBuilder<uint8_t>* builder) const {
     re2::StringPiece replacement(options_.replacement);
@@ -2069,7 +2202,7 @@ struct RegexSubstringReplacer {
     // If s is empty, then it's essentially global
     if (options_.max_replacements == -1 || s.empty()) {
       std::string s_copy(s);
-      RE2::GlobalReplace(&s_copy, regex_replacement_, replacement);
+      RE2::GlobalReplace(&s_copy, *regex_replacement_, replacement);
       return builder->Append(reinterpret_cast<const uint8_t*>(s_copy.data()),
                              s_copy.length());
     }
@@ -2084,7 +2217,7 @@ struct RegexSubstringReplacer {
     int64_t max_replacements = options_.max_replacements;
     while ((i < end) && (max_replacements != 0)) {
       std::string found;
-      if (!RE2::FindAndConsume(&piece, regex_find_, &found)) {
+      if (!RE2::FindAndConsume(&piece, *regex_find_, &found)) {
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(i),
                                       static_cast<int64_t>(end - i)));
         i = end;
@@ -2095,7 +2228,7 @@ struct RegexSubstringReplacer {
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(i),
                                       static_cast<int64_t>(pos - i)));
         // replace the pattern in what we found
-        if (!RE2::Replace(&found, regex_replacement_, replacement)) {
+        if (!RE2::Replace(&found, *regex_replacement_, replacement)) {
           return Status::Invalid("Regex found, but replacement failed");
         }
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(found.data()),
@@ -2172,10 +2305,9 @@ void AddAsciiStringReplaceSubstring(FunctionRegistry* registry) {
 
 using ExtractRegexState = OptionsWrapper<ExtractRegexOptions>;
 
-// TODO cache this once per ExtractRegexOptions
 struct ExtractRegexData {
-  // Use unique_ptr<> because RE2 is non-movable (for ARROW_ASSIGN_OR_RAISE)
-  std::unique_ptr<RE2> regex;
+  // The compiled regex is shared through the regex cache (RE2 is non-movable anyway)
+  std::shared_ptr<const RE2> regex;
   std::vector<std::string> group_names;
 
   static Result<ExtractRegexData> Make(const ExtractRegexOptions& options,
@@ -2217,7 +2349,7 @@ struct ExtractRegexData {
 
  private:
   explicit ExtractRegexData(const std::string& pattern, bool is_utf8 = true)
-      : regex(new RE2(pattern, MakeRE2Options(is_utf8))) {}
+      : regex(GetRegex(pattern, is_utf8)) {}
 };
 
 Result<TypeHolder> ResolveExtractRegexOutput(KernelContext* ctx,
@@ -2750,7 +2882,7 @@ template <typename Type>
 struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
   using Options = SplitPatternOptions;
 
-  std::unique_ptr<RE2> regex_split;
+  std::shared_ptr<const RE2> regex_split;
 
   Status PreExec(const SplitPatternOptions& options) override {
     if (options.reverse) {
@@ -2762,7 +2894,7 @@ struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
     pattern.reserve(options.pattern.size() + 2);
     pattern += options.pattern;
     pattern += ')';
-    regex_split = std::make_unique<RE2>(pattern, MakeRE2Options<Type>());
+    regex_split = GetRegex<Type>(pattern);
     return RegexStatus(*regex_split);
   }
 
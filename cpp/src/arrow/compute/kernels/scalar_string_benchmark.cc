@@ -109,6 +109,40 @@ static void MatchLikeSuffix(benchmark::State& state) {
   MatchSubstringOptions options("%abac");
   UnaryStringBenchmark(state, "match_like", &options);
 }
+
+static std::vector<std::string> MatchAnyRegexPatterns() {
+  std::vector<std::string> patterns;
+  for (const char* prefix : {"ab", "ba", "cd", "dc", "ef", "fe", "gh", "hg"}) {
+    patterns.push_back(std::string(prefix) + "[0-9]+");
+    patterns.push_back(std::string("^") + prefix + ".?a");
+  }
+  return patterns;
+}
+
+// One match_substring_regex call per pattern, OR-ed together
+static void MatchSubstringRegexOr(benchmark::State& state) {
+  const auto patterns = MatchAnyRegexPatterns();
+  auto values = random::RandomArrayGenerator(kSeed).String(1 << 20, 0, 32, 0.01);
+  for (auto _ : state) {
+    Datum result;
+    for (const auto& pattern : patterns) {
+      MatchSubstringOptions options(pattern);
+      ASSIGN_OR_ABORT(auto matched,
+                      CallFunction("match_substring_regex", {values}, &options));
+      if (result.is_value()) {
+        ASSIGN_OR_ABORT(result, CallFunction("or", {result, matched}));
+      } else {
+        result = std::move(matched);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values->length());
+}
+
+static void MatchAnyRegex(benchmark::State& state) {
+  MatchAnyRegexOptions options(MatchAnyRegexPatterns());
+  UnaryStringBenchmark(state, "match_any_regex", &options);
+}
 #endif
 
 #ifdef ARROW_WITH_UTF8PROC
@@ -245,6 +279,8 @@ BENCHMARK(MatchLike);
 BENCHMARK(MatchLikeSubstring);
 BENCHMARK(MatchLikePrefix);
 BENCHMARK(MatchLikeSuffix);
+BENCHMARK(MatchSubstringRegexOr);
+BENCHMARK(MatchAnyRegex);
 #endif
 #ifdef ARROW_WITH_UTF8PROC
 BENCHMARK(Utf8Lower);
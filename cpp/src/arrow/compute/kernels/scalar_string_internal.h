@@ -21,6 +21,7 @@
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/scalar_dictionary_internal.h"
 
 namespace arrow {
 namespace compute {
@@ -156,6 +157,7 @@ void MakeUnaryStringBatchKernel(
     kernel.mem_allocation = mem_allocation;
     DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
+  DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kTransformDictionary));
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -176,6 +178,7 @@ void MakeUnaryStringBatchKernelWithState(
     kernel.mem_allocation = mem_allocation;
     DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
+  DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kTransformDictionary));
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
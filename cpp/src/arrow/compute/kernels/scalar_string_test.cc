@@ -897,6 +897,32 @@ TYPED_TEST(TestStringKernels, AsciiLower) {
                    "[\"aaazzæÆ&\", null, \"\", \"bbb\"]");
 }
 
+TYPED_TEST(TestStringKernels, DictionaryInputs) {
+  // transforms apply to the dictionary and keep the indices
+  auto dict_type = dictionary(int16(), this->type());
+  auto input = DictArrayFromJSON(dict_type, "[0, 1, null, 2, 1, 0]",
+                                 R"(["aAa", " bB ", null])");
+  this->CheckUnary("ascii_upper", input,
+                   DictArrayFromJSON(dict_type, "[0, 1, null, 2, 1, 0]",
+                                     R"(["AAA", " BB ", null])"));
+  TrimOptions trim_options{" "};
+  this->CheckUnary("utf8_trim", input,
+                   DictArrayFromJSON(dict_type, "[0, 1, null, 2, 1, 0]",
+                                     R"(["aAa", "bB", null])"),
+                   &trim_options);
+
+  // predicates are evaluated on the dictionary and mapped through the indices
+  MatchSubstringOptions options{"B"};
+  this->CheckUnary("match_substring", input, boolean(),
+                   "[false, true, null, null, true, false]", &options);
+  options.pattern = " b";
+  this->CheckUnary("starts_with", input, boolean(),
+                   "[false, true, null, null, true, false]", &options);
+  options.pattern = "B ";
+  this->CheckUnary("ends_with", input, boolean(),
+                   "[false, true, null, null, true, false]", &options);
+}
+
 TYPED_TEST(TestStringKernels, AsciiSwapCase) {
   this->CheckUnary("ascii_swapcase", "[]", this->type(), "[]");
   this->CheckUnary("ascii_swapcase", "[\"aAazZæÆ&\", null, \"\", \"BbB\"]", this->type(),
@@ -1508,6 +1534,39 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstringRegexInvalid) {
       CallFunction("match_substring_regex", {input}, &options));
 }
 
+TYPED_TEST(TestStringKernels, MatchAnyRegex) {
+  MatchAnyRegexOptions options{{"ab", "^c", "\\d$"}};
+  this->CheckUnary("match_any_regex", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_regex", R"(["abc", "acb", "cba", null, "b2", "2b", ""])",
+                   boolean(), "[true, false, true, null, true, false, false]", &options);
+  MatchAnyRegexOptions options_insensitive{{"ab", "é"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_regex", R"(["AB", "acb", "É", null, "bac"])", boolean(),
+                   "[true, false, true, null, false]", &options_insensitive);
+  MatchAnyRegexOptions options_single{{"a+b"}};
+  this->CheckUnary("match_any_regex", R"(["aacb", "aab", "dab", "b", ""])", boolean(),
+                   "[false, true, true, false, false]", &options_single);
+  MatchAnyRegexOptions options_empty{std::vector<std::string>{}};
+  this->CheckUnary("match_any_regex", R"(["abc", "", null])", boolean(),
+                   "[false, false, null]", &options_empty);
+  // Same patterns in another order, and patterns that look like the cache key encoding
+  MatchAnyRegexOptions options_reordered{{"\\d$", "^c", "ab"}};
+  this->CheckUnary("match_any_regex", R"(["abc", "acb", "cba", null, "b2", "2b", ""])",
+                   boolean(), "[true, false, true, null, true, false, false]",
+                   &options_reordered);
+  MatchAnyRegexOptions options_separators{{"1:", "3:abc"}};
+  this->CheckUnary("match_any_regex", R"(["x1:y", "3:abc", "abc", "1"])", boolean(),
+                   "[true, true, false, false]", &options_separators);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchAnyRegexInvalid) {
+  Datum input = ArrayFromJSON(this->type(), "[null]");
+  ASSERT_RAISES(Invalid, CallFunction("match_any_regex", {input}));
+  MatchAnyRegexOptions options{{"valid", "invalid["}};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid regular expression 'invalid['"),
+      CallFunction("match_any_regex", {input}, &options));
+}
+
 TYPED_TEST(TestStringKernels, MatchLike) {
   auto inputs = R"(["foo", "bar", "foobar", "barfoo", "o", "\nfoo", "foo\n", null])";
 
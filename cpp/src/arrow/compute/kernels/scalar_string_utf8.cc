@@ -45,6 +45,7 @@ void MakeUnaryStringUTF8TransformKernel(std::string name, FunctionRegistry* regi
     auto exec = GenerateVarBinaryToVarBinary<Transformer>(ty);
     DCHECK_OK(func->AddKernel({ty}, ty, std::move(exec)));
   }
+  DCHECK_OK(AddDictionaryKernels(func.get(), DictionaryKernelMode::kTransformDictionary));
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
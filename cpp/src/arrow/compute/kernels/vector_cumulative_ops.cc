@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cmath>
+
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api_scalar.h"
@@ -33,11 +36,32 @@ namespace internal {
 
 namespace {
 
-template <typename OptionsType>
-struct CumulativeOptionsWrapper : public OptionsWrapper<OptionsType> {
-  using State = CumulativeOptionsWrapper<OptionsType>;
+// The starting value of a cumulative function, or null if it starts with the first
+// non-null input value
+Result<std::shared_ptr<Scalar>> GetStart(const CumulativeSumOptions& options) {
+  if (!options.start || !options.start->is_valid) {
+    return Status::Invalid("Cumulative `start` option must be non-null and valid");
+  }
+  return options.start;
+}
+
+Result<std::shared_ptr<Scalar>> GetStart(const CumulativeOptions& options) {
+  if (!options.start.has_value()) {
+    return nullptr;
+  }
+  if (!*options.start || !(*options.start)->is_valid) {
+    return Status::Invalid("Cumulative `start` option must be non-null and valid");
+  }
+  return *options.start;
+}
 
-  explicit CumulativeOptionsWrapper(OptionsType options)
+// The kernel state holds the running value along with the options.  Since the
+// running value is carried from one call of the kernel to the next, a stream of
+// batches can be processed by calling the kernel on each of them, in order, with
+// the same state.
+template <typename OptionsType>
+struct CumulativeState : public OptionsWrapper<OptionsType> {
+  explicit CumulativeState(OptionsType options)
       : OptionsWrapper<OptionsType>(std::move(options)) {}
 
   static Result<std::unique_ptr<KernelState>> Init(KernelContext* ctx,
@@ -47,24 +71,74 @@ struct CumulativeOptionsWrapper : public OptionsWrapper<OptionsType> {
       return Status::Invalid(
           "Attempted to initialize KernelState from null FunctionOptions");
     }
+    auto state = std::make_unique<CumulativeState>(*options);
+    ARROW_ASSIGN_OR_RAISE(state->current, GetStart(*options));
 
-    const auto& start = options->start;
-    if (!start || !start->is_valid) {
-      return Status::Invalid("Cumulative `start` option must be non-null and valid");
+    // Ensure `start` option matches input type
+    if (state->current && !state->current->type->Equals(*args.inputs[0])) {
+      ARROW_ASSIGN_OR_RAISE(auto casted_start,
+                            Cast(Datum(state->current), args.inputs[0],
+                                 CastOptions::Safe(), ctx->exec_context()));
+      state->current = casted_start.scalar();
     }
+    return std::move(state);
+  }
 
-    // Ensure `start` option matches input type
-    if (!start->type->Equals(*args.inputs[0])) {
-      ARROW_ASSIGN_OR_RAISE(
-          auto casted_start,
-          Cast(Datum(start), args.inputs[0], CastOptions::Safe(), ctx->exec_context()));
-      auto new_options = OptionsType(casted_start.scalar(), options->skip_nulls);
-      return std::make_unique<State>(new_options);
+  // The running value, null if no value has been accumulated yet and there is
+  // no `start`
+  std::shared_ptr<Scalar> current;
+  bool encountered_null = false;
+};
+
+struct CumulativeMeanState : public KernelState {
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext*,
+                                                   const KernelInitArgs& args) {
+    auto options = checked_cast<const CumulativeOptions*>(args.options);
+    if (!options) {
+      return Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions");
     }
-    return std::make_unique<State>(*options);
+    auto state = std::make_unique<CumulativeMeanState>();
+    state->skip_nulls = options->skip_nulls;
+    return std::move(state);
   }
+
+  bool skip_nulls = false;
+  bool encountered_null = false;
+  double sum = 0;
+  int64_t count = 0;
 };
 
+// Append the running values of `input` to `builder`, `step` being called on each
+// value to be accumulated.  Without `skip_nulls`, the first null encountered is
+// propagated through the remaining output, including that of later calls.
+template <typename ArgType, typename Builder, typename Step>
+Status AccumulateSpan(const ArraySpan& input, bool skip_nulls, bool* encountered_null,
+                      Builder* builder, Step&& step) {
+  using ArgValue = typename GetViewType<ArgType>::T;
+  RETURN_NOT_OK(builder->Reserve(input.length));
+
+  if (skip_nulls || (input.GetNullCount() == 0 && !*encountered_null)) {
+    VisitArrayValuesInline<ArgType>(
+        input, [&](ArgValue v) { builder->UnsafeAppend(step(v)); },
+        [&]() { builder->UnsafeAppendNull(); });
+  } else {
+    int64_t nulls_start_idx = 0;
+    VisitArrayValuesInline<ArgType>(
+        input,
+        [&](ArgValue v) {
+          if (!*encountered_null) {
+            builder->UnsafeAppend(step(v));
+            ++nulls_start_idx;
+          }
+        },
+        [&]() { *encountered_null = true; });
+
+    RETURN_NOT_OK(builder->AppendNulls(input.length - nulls_start_idx));
+  }
+  return Status::OK();
+}
+
 // The driver kernel for all cumulative compute functions. Op is a compute kernel
 // representing any binary associative operation (add, product, min, max, etc.) and
 // OptionsType the options type corresponding to Op. ArgType and OutType are the input
@@ -74,61 +148,56 @@ template <typename OutType, typename ArgType, typename Op, typename OptionsType>
 struct Accumulator {
   using OutValue = typename GetOutputType<OutType>::T;
   using ArgValue = typename GetViewType<ArgType>::T;
+  using State = CumulativeState<OptionsType>;
 
   KernelContext* ctx;
-  ArgValue current_value;
-  bool skip_nulls;
-  bool encountered_null = false;
+  State* state;
+  ArgValue current_value{};
+  bool has_value;
   NumericBuilder<OutType> builder;
 
-  explicit Accumulator(KernelContext* ctx) : ctx(ctx), builder(ctx->memory_pool()) {}
+  explicit Accumulator(KernelContext* ctx)
+      : ctx(ctx),
+        state(checked_cast<State*>(ctx->state())),
+        has_value(state->current != nullptr),
+        builder(ctx->memory_pool()) {
+    if (has_value) {
+      current_value = UnboxScalar<OutType>::Unbox(*state->current);
+    }
+  }
 
   Status Accumulate(const ArraySpan& input) {
     Status st = Status::OK();
+    RETURN_NOT_OK(AccumulateSpan<ArgType>(
+        input, state->options.skip_nulls, &state->encountered_null, &builder,
+        [&](ArgValue v) {
+          current_value = has_value ? Op::template Call<OutValue, ArgValue, ArgValue>(
+                                          ctx, v, current_value, &st)
+                                    : v;
+          has_value = true;
+          return current_value;
+        }));
+    return st;
+  }
 
-    if (skip_nulls || (input.GetNullCount() == 0 && !encountered_null)) {
-      VisitArrayValuesInline<ArgType>(
-          input,
-          [&](ArgValue v) {
-            current_value = Op::template Call<OutValue, ArgValue, ArgValue>(
-                ctx, v, current_value, &st);
-            builder.UnsafeAppend(current_value);
-          },
-          [&]() { builder.UnsafeAppendNull(); });
-    } else {
-      int64_t nulls_start_idx = 0;
-      VisitArrayValuesInline<ArgType>(
-          input,
-          [&](ArgValue v) {
-            if (!encountered_null) {
-              current_value = Op::template Call<OutValue, ArgValue, ArgValue>(
-                  ctx, v, current_value, &st);
-              builder.UnsafeAppend(current_value);
-              ++nulls_start_idx;
-            }
-          },
-          [&]() { encountered_null = true; });
-
-      RETURN_NOT_OK(builder.AppendNulls(input.length - nulls_start_idx));
+  // Save the running value for the next call of the kernel
+  Status Finish(std::shared_ptr<ArrayData>* out) {
+    if (has_value) {
+      state->current =
+          std::make_shared<typename TypeTraits<OutType>::ScalarType>(current_value);
     }
-
-    return st;
+    return builder.FinishInternal(out);
   }
 };
 
 template <typename OutType, typename ArgType, typename Op, typename OptionsType>
 struct CumulativeKernel {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    const auto& options = CumulativeOptionsWrapper<OptionsType>::Get(ctx);
     Accumulator<OutType, ArgType, Op, OptionsType> accumulator(ctx);
-    accumulator.current_value = UnboxScalar<OutType>::Unbox(*(options.start));
-    accumulator.skip_nulls = options.skip_nulls;
-
-    RETURN_NOT_OK(accumulator.builder.Reserve(batch.length));
     RETURN_NOT_OK(accumulator.Accumulate(batch[0].array));
 
     std::shared_ptr<ArrayData> result;
-    RETURN_NOT_OK(accumulator.builder.FinishInternal(&result));
+    RETURN_NOT_OK(accumulator.Finish(&result));
     out->value = std::move(result);
     return Status::OK();
   }
@@ -137,19 +206,83 @@ struct CumulativeKernel {
 template <typename OutType, typename ArgType, typename Op, typename OptionsType>
 struct CumulativeKernelChunked {
   static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-    const auto& options = CumulativeOptionsWrapper<OptionsType>::Get(ctx);
     Accumulator<OutType, ArgType, Op, OptionsType> accumulator(ctx);
-    accumulator.current_value = UnboxScalar<OutType>::Unbox(*(options.start));
-    accumulator.skip_nulls = options.skip_nulls;
 
     const ChunkedArray& chunked_input = *batch[0].chunked_array();
     RETURN_NOT_OK(accumulator.builder.Reserve(chunked_input.length()));
-    std::vector<std::shared_ptr<Array>> out_chunks;
     for (const auto& chunk : chunked_input.chunks()) {
       RETURN_NOT_OK(accumulator.Accumulate(*chunk->data()));
     }
     std::shared_ptr<ArrayData> result;
-    RETURN_NOT_OK(accumulator.builder.FinishInternal(&result));
+    RETURN_NOT_OK(accumulator.Finish(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+};
+
+struct CumulativeMin {
+  template <typename T, typename Arg0, typename Arg1>
+  static enable_if_t<std::is_integral<T>::value, T> Call(KernelContext*, Arg0 left,
+                                                         Arg1 right, Status*) {
+    return std::min(left, right);
+  }
+
+  // NaNs are ignored unless all values seen so far are NaN
+  template <typename T, typename Arg0, typename Arg1>
+  static enable_if_floating_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
+                                          Status*) {
+    return std::fmin(left, right);
+  }
+};
+
+struct CumulativeMax {
+  template <typename T, typename Arg0, typename Arg1>
+  static enable_if_t<std::is_integral<T>::value, T> Call(KernelContext*, Arg0 left,
+                                                         Arg1 right, Status*) {
+    return std::max(left, right);
+  }
+
+  template <typename T, typename Arg0, typename Arg1>
+  static enable_if_floating_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
+                                          Status*) {
+    return std::fmax(left, right);
+  }
+};
+
+template <typename ArgType>
+Status AccumulateMean(KernelContext* ctx, const ArraySpan& input,
+                      DoubleBuilder* builder) {
+  using ArgValue = typename GetViewType<ArgType>::T;
+  auto state = checked_cast<CumulativeMeanState*>(ctx->state());
+  return AccumulateSpan<ArgType>(input, state->skip_nulls, &state->encountered_null,
+                                 builder, [&](ArgValue v) {
+                                   state->sum += static_cast<double>(v);
+                                   ++state->count;
+                                   return state->sum / state->count;
+                                 });
+}
+
+template <typename OutType, typename ArgType>
+struct CumulativeMeanKernel {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    DoubleBuilder builder(ctx->memory_pool());
+    RETURN_NOT_OK(AccumulateMean<ArgType>(ctx, batch[0].array, &builder));
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+};
+
+template <typename OutType, typename ArgType>
+struct CumulativeMeanKernelChunked {
+  static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    DoubleBuilder builder(ctx->memory_pool());
+    for (const auto& chunk : batch[0].chunked_array()->chunks()) {
+      RETURN_NOT_OK(AccumulateMean<ArgType>(ctx, *chunk->data(), &builder));
+    }
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder.FinishInternal(&result));
     out->value = std::move(result);
     return Status::OK();
   }
@@ -172,6 +305,48 @@ const FunctionDoc cumulative_sum_checked_doc{
      "function \"cumulative_sum\"."),
     {"values"},
     "CumulativeSumOptions"};
+
+const FunctionDoc cumulative_prod_doc{
+    "Compute the cumulative product over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative product computed over `values`. Results will wrap around on\n"
+     "integer overflow. Use function \"cumulative_prod_checked\" if you want\n"
+     "overflow to return an error."),
+    {"values"},
+    "CumulativeOptions"};
+
+const FunctionDoc cumulative_prod_checked_doc{
+    "Compute the cumulative product over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative product computed over `values`. This function returns an error\n"
+     "on overflow. For a variant that doesn't fail on overflow, use\n"
+     "function \"cumulative_prod\"."),
+    {"values"},
+    "CumulativeOptions"};
+
+const FunctionDoc cumulative_min_doc{
+    "Compute the cumulative min over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative min computed over `values`. NaNs are ignored, unless all\n"
+     "values so far are NaN."),
+    {"values"},
+    "CumulativeOptions"};
+
+const FunctionDoc cumulative_max_doc{
+    "Compute the cumulative max over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative max computed over `values`. NaNs are ignored, unless all\n"
+     "values so far are NaN."),
+    {"values"},
+    "CumulativeOptions"};
+
+const FunctionDoc cumulative_mean_doc{
+    "Compute the cumulative mean over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array of doubles which\n"
+     "is the cumulative mean computed over `values`. The `start` option is\n"
+     "ignored."),
+    {"values"},
+    "CumulativeOptions"};
 }  // namespace
 
 template <typename Op, typename OptionsType>
@@ -195,18 +370,48 @@ void MakeVectorCumulativeFunction(FunctionRegistry* registry, const std::string
     kernel.exec_chunked =
         ArithmeticExecFromOp<CumulativeKernelChunked, Op, VectorKernel::ChunkedExec,
                              OptionsType>(ty);
-    kernel.init = CumulativeOptionsWrapper<OptionsType>::Init;
+    kernel.init = CumulativeState<OptionsType>::Init;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+void MakeVectorCumulativeMeanFunction(FunctionRegistry* registry) {
+  static const auto kDefaultOptions = CumulativeOptions::Defaults();
+  auto func = std::make_shared<VectorFunction>("cumulative_mean", Arity::Unary(),
+                                               cumulative_mean_doc, &kDefaultOptions);
+
+  for (const auto& ty : NumericTypes()) {
+    VectorKernel kernel;
+    kernel.can_execute_chunkwise = false;
+    kernel.null_handling = NullHandling::type::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::type::NO_PREALLOCATE;
+    kernel.signature = KernelSignature::Make({ty}, OutputType(float64()));
+    kernel.exec = GenerateNumeric<CumulativeMeanKernel, DoubleType>(*ty);
+    kernel.exec_chunked = GenerateNumeric<CumulativeMeanKernelChunked, DoubleType,
+                                          VectorKernel::ChunkedExec>(*ty);
+    kernel.init = CumulativeMeanState::Init;
     DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
 
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
-void RegisterVectorCumulativeSum(FunctionRegistry* registry) {
+void RegisterVectorCumulativeFunctions(FunctionRegistry* registry) {
   MakeVectorCumulativeFunction<Add, CumulativeSumOptions>(registry, "cumulative_sum",
                                                           cumulative_sum_doc);
   MakeVectorCumulativeFunction<AddChecked, CumulativeSumOptions>(
       registry, "cumulative_sum_checked", cumulative_sum_checked_doc);
+  MakeVectorCumulativeFunction<Multiply, CumulativeOptions>(registry, "cumulative_prod",
+                                                            cumulative_prod_doc);
+  MakeVectorCumulativeFunction<MultiplyChecked, CumulativeOptions>(
+      registry, "cumulative_prod_checked", cumulative_prod_checked_doc);
+  MakeVectorCumulativeFunction<CumulativeMin, CumulativeOptions>(
+      registry, "cumulative_min", cumulative_min_doc);
+  MakeVectorCumulativeFunction<CumulativeMax, CumulativeOptions>(
+      registry, "cumulative_max", cumulative_max_doc);
+  MakeVectorCumulativeMeanFunction(registry);
 }
 
 }  // namespace internal
@@ -344,5 +344,82 @@ TEST(TestCumulativeSum, HasStartDoSkip) {
   }
 }
 
+TEST(TestCumulativeProd, Basic) {
+  CumulativeOptions no_skip;
+  CumulativeOptions do_skip(std::nullopt, true);
+  CumulativeOptions has_start(ScalarFromJSON(int64(), "2"));
+  for (auto ty : NumericTypes()) {
+    for (auto func : {"cumulative_prod", "cumulative_prod_checked"}) {
+      CheckVectorUnary(func, ArrayFromJSON(ty, "[1, 2, 3, 4]"),
+                       ArrayFromJSON(ty, "[1, 2, 6, 24]"), &no_skip);
+      CheckVectorUnary(func, ArrayFromJSON(ty, "[1, 2, null, 4]"),
+                       ArrayFromJSON(ty, "[1, 2, null, null]"), &no_skip);
+      CheckVectorUnary(func, ArrayFromJSON(ty, "[1, 2, null, 4]"),
+                       ArrayFromJSON(ty, "[1, 2, null, 8]"), &do_skip);
+      CheckVectorUnary(func, ArrayFromJSON(ty, "[1, 2, 3, 4]"),
+                       ArrayFromJSON(ty, "[2, 4, 12, 48]"), &has_start);
+      CheckVectorUnary(func, ChunkedArrayFromJSON(ty, {"[1, 2]", "[null, 3]"}),
+                       ChunkedArrayFromJSON(ty, {"[1, 2, null, 6]"}), &do_skip);
+    }
+  }
+
+  auto large = ArrayFromJSON(int64(), "[4294967296, 4294967296]");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, HasSubstr("overflow"),
+                                  CallFunction("cumulative_prod_checked", {large}));
+  ASSERT_OK(CallFunction("cumulative_prod", {large}));
+}
+
+TEST(TestCumulativeMinMax, Basic) {
+  CumulativeOptions no_skip;
+  CumulativeOptions do_skip(std::nullopt, true);
+  CumulativeOptions has_start(ScalarFromJSON(int64(), "4"));
+  for (auto ty : NumericTypes()) {
+    CheckVectorUnary("cumulative_min", ArrayFromJSON(ty, "[5, 3, 6, 1, 2]"),
+                     ArrayFromJSON(ty, "[5, 3, 3, 1, 1]"), &no_skip);
+    CheckVectorUnary("cumulative_max", ArrayFromJSON(ty, "[5, 3, 6, 1, 2]"),
+                     ArrayFromJSON(ty, "[5, 5, 6, 6, 6]"), &no_skip);
+    CheckVectorUnary("cumulative_min", ArrayFromJSON(ty, "[5, null, 3, 6]"),
+                     ArrayFromJSON(ty, "[5, null, null, null]"), &no_skip);
+    CheckVectorUnary("cumulative_min", ArrayFromJSON(ty, "[5, null, 3, 6]"),
+                     ArrayFromJSON(ty, "[5, null, 3, 3]"), &do_skip);
+    CheckVectorUnary("cumulative_max", ArrayFromJSON(ty, "[null, 5, 3, 6]"),
+                     ArrayFromJSON(ty, "[null, 5, 5, 6]"), &do_skip);
+    CheckVectorUnary("cumulative_min", ArrayFromJSON(ty, "[5, 3, 6]"),
+                     ArrayFromJSON(ty, "[4, 3, 3]"), &has_start);
+    CheckVectorUnary("cumulative_max", ArrayFromJSON(ty, "[5, 3, 6]"),
+                     ArrayFromJSON(ty, "[5, 5, 6]"), &has_start);
+    CheckVectorUnary("cumulative_max", ChunkedArrayFromJSON(ty, {"[1, 3]", "[2, 4]"}),
+                     ChunkedArrayFromJSON(ty, {"[1, 3, 3, 4]"}), &no_skip);
+  }
+
+  // NaNs are ignored, unless all values so far are NaN
+  CheckVectorUnary("cumulative_min", ArrayFromJSON(float64(), "[NaN, 2, NaN, 1]"),
+                   ArrayFromJSON(float64(), "[NaN, 2, 2, 1]"), &no_skip);
+  CheckVectorUnary("cumulative_max", ArrayFromJSON(float32(), "[NaN, 2, NaN, 1]"),
+                   ArrayFromJSON(float32(), "[NaN, 2, 2, 2]"), &no_skip);
+}
+
+TEST(TestCumulativeMean, Basic) {
+  CumulativeOptions no_skip;
+  CumulativeOptions do_skip(std::nullopt, true);
+  for (auto ty : NumericTypes()) {
+    CheckVectorUnary("cumulative_mean", ArrayFromJSON(ty, "[1, 3, 2, 6]"),
+                     ArrayFromJSON(float64(), "[1, 2, 2, 3]"), &no_skip);
+    CheckVectorUnary("cumulative_mean", ArrayFromJSON(ty, "[1, 3, null, 8]"),
+                     ArrayFromJSON(float64(), "[1, 2, null, null]"), &no_skip);
+    CheckVectorUnary("cumulative_mean", ArrayFromJSON(ty, "[1, 3, null, 8]"),
+                     ArrayFromJSON(float64(), "[1, 2, null, 4]"), &do_skip);
+    CheckVectorUnary("cumulative_mean", ChunkedArrayFromJSON(ty, {"[1, 3]", "[2, 6]"}),
+                     ChunkedArrayFromJSON(float64(), {"[1, 2, 2, 3]"}), &no_skip);
+  }
+}
+
+TEST(TestCumulative, InvalidStart) {
+  CumulativeOptions null_start(ScalarFromJSON(int64(), "null"));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, HasSubstr("must be non-null and valid"),
+      CallFunction("cumulative_max", {ArrayFromJSON(int64(), "[1]")}, &null_start));
+}
+
 }  // namespace compute
 }  // namespace arrow
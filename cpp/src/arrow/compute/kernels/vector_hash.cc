@@ -15,9 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_dict.h"
@@ -29,7 +32,11 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/hashing.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -51,6 +58,16 @@ class ActionBase {
   MemoryPool* pool_;
 };
 
+// The results of hashing a whole input at once, see ParallelHasher
+struct ParallelHashResult {
+  // The distinct values, in order of first occurrence
+  std::shared_ptr<ArrayData> dictionary;
+  // The number of occurrences of each distinct value, if requested
+  std::vector<int64_t> counts;
+  // The dictionary indices of the values of each input chunk, if requested
+  std::vector<std::shared_ptr<ArrayData>> indices;
+};
+
 // ----------------------------------------------------------------------
 // Unique
 
@@ -59,6 +76,8 @@ class UniqueAction final : public ActionBase {
   using ActionBase::ActionBase;
 
   static constexpr bool with_error_status = false;
+  static constexpr bool with_counts = false;
+  static constexpr bool with_indices = false;
 
   UniqueAction(const std::shared_ptr<DataType>& type, const FunctionOptions* options,
                MemoryPool* pool)
@@ -82,6 +101,8 @@ class UniqueAction final : public ActionBase {
 
   bool ShouldEncodeNulls() { return true; }
 
+  Status ObserveParallel(const ParallelHashResult& result) { return Status::OK(); }
+
   Status Flush(ExecResult* out) { return Status::OK(); }
 
   Status FlushFinal(ExecResult* out) { return Status::OK(); }
@@ -95,6 +116,8 @@ class ValueCountsAction final : ActionBase {
   using ActionBase::ActionBase;
 
   static constexpr bool with_error_status = true;
+  static constexpr bool with_counts = true;
+  static constexpr bool with_indices = false;
 
   ValueCountsAction(const std::shared_ptr<DataType>& type, const FunctionOptions* options,
                     MemoryPool* pool)
@@ -155,6 +178,10 @@ class ValueCountsAction final : ActionBase {
 
   bool ShouldEncodeNulls() const { return true; }
 
+  Status ObserveParallel(const ParallelHashResult& result) {
+    return count_builder_.AppendValues(result.counts);
+  }
+
  private:
   Int64Builder count_builder_;
 };
@@ -167,6 +194,8 @@ class DictEncodeAction final : public ActionBase {
   using ActionBase::ActionBase;
 
   static constexpr bool with_error_status = false;
+  static constexpr bool with_counts = false;
+  static constexpr bool with_indices = true;
 
   DictEncodeAction(const std::shared_ptr<DataType>& type, const FunctionOptions* options,
                    MemoryPool* pool)
@@ -211,6 +240,9 @@ class DictEncodeAction final : public ActionBase {
     return encode_options_.null_encoding_behavior == DictionaryEncodeOptions::ENCODE;
   }
 
+  // The indices are returned by the kernel itself
+  Status ObserveParallel(const ParallelHashResult& result) { return Status::OK(); }
+
   Status Flush(ExecResult* out) {
     std::shared_ptr<ArrayData> result;
     RETURN_NOT_OK(indices_builder_.FinishInternal(&result));
@@ -252,11 +284,453 @@ class HashKernel : public KernelState {
   // data structures) and visit the given input with Action.
   virtual Status Append(const ArraySpan& arr) = 0;
 
+  // Append the chunks of an input and flush the results of the action for
+  // each of them into `out`, if it has some.  Large inputs may be hashed in
+  // parallel.
+  virtual Status AppendChunks(KernelContext* ctx, const std::vector<ArraySpan>& chunks,
+                              std::vector<std::shared_ptr<ArrayData>>* out) {
+    for (const auto& chunk : chunks) {
+      RETURN_NOT_OK(Append(ctx, chunk));
+      ExecResult chunk_out;
+      chunk_out.value = std::shared_ptr<ArrayData>();
+      RETURN_NOT_OK(Flush(&chunk_out));
+      if (chunk_out.array_data()) {
+        out->push_back(chunk_out.array_data());
+      }
+    }
+    return Status::OK();
+  }
+
  protected:
   const FunctionOptions* options_;
   std::mutex lock_;
 };
 
+// ----------------------------------------------------------------------
+// Parallel hashing of large inputs
+//
+// The input is split into contiguous ranges, which are hashed concurrently into
+// range-local memo tables.  The distinct values of each range are then
+// hash-partitioned, and every partition is deduplicated concurrently in its own
+// memo table, visiting the ranges in order.  Numbering the values in the order
+// of the range-local memo tables, skipping those already seen by their partition,
+// yields the dictionary of the serial implementation: the distinct values in
+// order of their first occurrence in the input.
+
+// Inputs shorter than this are hashed serially
+constexpr int64_t kParallelHashMinLength = 1 << 16;
+// The number of ranges per thread, to balance the load between threads
+constexpr int64_t kParallelHashRangesPerThread = 4;
+// The partitions of a value are stored as bytes
+constexpr int kParallelHashMaxPartitions = 256;
+
+// Return the executor to hash `chunks` with, or null if they should be hashed
+// serially
+::arrow::internal::Executor* GetParallelHashExecutor(
+    KernelContext* ctx, const std::vector<ArraySpan>& chunks) {
+  ExecContext* exec_ctx = ctx->exec_context();
+  if (!exec_ctx->use_threads()) {
+    return nullptr;
+  }
+  int64_t length = 0;
+  for (const auto& chunk : chunks) {
+    length += chunk.length;
+  }
+  if (length < kParallelHashMinLength) {
+    return nullptr;
+  }
+  ::arrow::internal::Executor* executor = exec_ctx->executor()
+                                              ? exec_ctx->executor()
+                                              : ::arrow::internal::GetCpuThreadPool();
+  // Don't block a thread of the executor waiting for other tasks of the same
+  // executor, which may deadlock
+  if (executor->GetCapacity() < 2 || executor->OwnsThisThread()) {
+    return nullptr;
+  }
+  return executor;
+}
+
+// Random access to the values of an array, as they are hashed by the memo tables
+template <typename Type, typename Enable = void>
+struct MemoValueReader {
+  using c_type = typename Type::c_type;
+
+  explicit MemoValueReader(const ArrayData& data)
+      : values_(data.GetValues<c_type>(1)) {}
+
+  c_type operator[](int64_t i) const { return values_[i]; }
+
+  const c_type* values_;
+};
+
+template <>
+struct MemoValueReader<BooleanType> {
+  explicit MemoValueReader(const ArrayData& data)
+      : bitmap_(data.buffers[1]->data()), offset_(data.offset) {}
+
+  bool operator[](int64_t i) const { return bit_util::GetBit(bitmap_, offset_ + i); }
+
+  const uint8_t* bitmap_;
+  int64_t offset_;
+};
+
+template <typename Type>
+struct MemoValueReader<Type, enable_if_base_binary<Type>> {
+  using offset_type = typename Type::offset_type;
+
+  explicit MemoValueReader(const ArrayData& data)
+      : offsets_(data.GetValues<offset_type>(1)),
+        data_(data.buffers[2] ? data.buffers[2]->data() : nullptr) {}
+
+  std::string_view operator[](int64_t i) const {
+    return std::string_view(reinterpret_cast<const char*>(data_ + offsets_[i]),
+                            static_cast<size_t>(offsets_[i + 1] - offsets_[i]));
+  }
+
+  const offset_type* offsets_;
+  const uint8_t* data_;
+};
+
+template <>
+struct MemoValueReader<FixedSizeBinaryType> {
+  explicit MemoValueReader(const ArrayData& data)
+      : byte_width_(checked_cast<const FixedSizeBinaryType&>(*data.type).byte_width()),
+        data_(data.GetValues<uint8_t>(1, data.offset * byte_width_)) {}
+
+  std::string_view operator[](int64_t i) const {
+    return std::string_view(reinterpret_cast<const char*>(data_ + i * byte_width_),
+                            static_cast<size_t>(byte_width_));
+  }
+
+  int32_t byte_width_;
+  const uint8_t* data_;
+};
+
+// Hash a whole input on the threads of an executor, computing the results
+// requested by an Action
+template <typename Type, typename Scalar>
+class ParallelHasher {
+ public:
+  ParallelHasher(std::shared_ptr<DataType> type, MemoryPool* pool,
+                 ::arrow::internal::Executor* executor, bool encode_nulls,
+                 bool with_counts, bool with_indices)
+      : type_(std::move(type)),
+        pool_(pool),
+        executor_(executor),
+        encode_nulls_(encode_nulls),
+        with_counts_(with_counts),
+        with_indices_(with_indices) {}
+
+  Result<ParallelHashResult> Hash(const std::vector<ArraySpan>& chunks) {
+    chunks_ = chunks;
+    RETURN_NOT_OK(MakeRanges());
+    const int num_ranges = static_cast<int>(ranges_.size());
+    num_partitions_ = std::min(executor_->GetCapacity(), kParallelHashMaxPartitions);
+    partitions_.resize(num_partitions_);
+
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_ranges, [this](int i) { return HashRange(&ranges_[i]); }, executor_));
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_partitions_, [this](int i) { return DeduplicatePartition(i); }, executor_));
+
+    // Lay out the distinct values of all ranges
+    int64_t num_values = 0;
+    int64_t dictionary_offset = 0;
+    for (auto& range : ranges_) {
+      range.first_global_index = num_values;
+      range.dictionary_offset = dictionary_offset;
+      num_values += std::count(range.is_first.begin(), range.is_first.end(), 1);
+      dictionary_offset += range.dictionary->length;
+    }
+    if (num_values > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Too many distinct values to hash: ", num_values);
+    }
+    origins_.resize(num_values);
+    if (with_counts_) {
+      result_.counts.resize(num_values);
+    }
+
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_ranges, [this](int i) { return NumberRange(&ranges_[i]); }, executor_));
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_ranges, [this](int i) { return RemapRange(&ranges_[i]); }, executor_));
+
+    // Gather the distinct values from the range dictionaries
+    ArrayVector dictionaries;
+    for (auto& range : ranges_) {
+      dictionaries.push_back(MakeArray(std::move(range.dictionary)));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto all_values, Concatenate(dictionaries, pool_));
+    auto values = all_values->data()->Copy();
+    if (values->type->id() == ::arrow::Type::INTERVAL_MONTH_DAY_NANO) {
+      // Take doesn't support 16-byte primitive values, take their bytes instead
+      values->type = fixed_size_binary(sizeof(MonthDayNanoIntervalType::c_type));
+    }
+    ExecContext exec_ctx(pool_);
+    ARROW_ASSIGN_OR_RAISE(
+        Datum dictionary,
+        Take(values,
+             ArrayData::Make(int64(), num_values, {nullptr, Buffer::Wrap(origins_)}, 0),
+             TakeOptions::NoBoundsCheck(), &exec_ctx));
+    result_.dictionary = dictionary.array();
+    result_.dictionary->type = type_;
+    return std::move(result_);
+  }
+
+ private:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  // A part of an input chunk
+  struct Slice {
+    int chunk;
+    int64_t offset;
+    int64_t length;
+  };
+
+  struct Range {
+    std::vector<Slice> slices;
+    // The distinct values of the range, in order of first occurrence
+    std::shared_ptr<ArrayData> dictionary;
+    int32_t null_index;
+    // The number of occurrences of each distinct value
+    std::vector<int64_t> counts;
+    // The partition of each distinct value
+    std::vector<uint8_t> partitions;
+    // The distinct values, grouped by partition
+    std::vector<int32_t> partitioned;
+    std::vector<int32_t> partition_offsets;
+    // The index of each distinct value in its partition, and whether the range
+    // has its first occurrence in the input
+    std::vector<int32_t> partition_indices;
+    std::vector<uint8_t> is_first;
+    // The index of each distinct value in the output dictionary
+    std::vector<int32_t> global_indices;
+    int64_t first_global_index;
+    int64_t dictionary_offset;
+  };
+
+  struct Partition {
+    std::vector<int64_t> counts;
+    std::vector<int32_t> global_indices;
+  };
+
+  Status MakeRanges() {
+    int64_t length = 0;
+    for (const auto& chunk : chunks_) {
+      length += chunk.length;
+    }
+    const int64_t num_ranges = executor_->GetCapacity() * kParallelHashRangesPerThread;
+    const int64_t range_length = bit_util::CeilDiv(length, num_ranges);
+
+    Range range;
+    int64_t range_remaining = range_length;
+    for (int i = 0; i < static_cast<int>(chunks_.size()); ++i) {
+      int64_t offset = 0;
+      while (offset < chunks_[i].length) {
+        const int64_t slice_length =
+            std::min(chunks_[i].length - offset, range_remaining);
+        range.slices.push_back({i, offset, slice_length});
+        offset += slice_length;
+        range_remaining -= slice_length;
+        if (range_remaining == 0) {
+          ranges_.push_back(std::move(range));
+          range = Range();
+          range_remaining = range_length;
+        }
+      }
+    }
+    if (!range.slices.empty()) {
+      ranges_.push_back(std::move(range));
+    }
+
+    if (with_indices_) {
+      for (const auto& chunk : chunks_) {
+        std::shared_ptr<Buffer> validity;
+        int64_t null_count = 0;
+        if (!encode_nulls_ && chunk.MayHaveNulls()) {
+          ARROW_ASSIGN_OR_RAISE(validity, ::arrow::internal::CopyBitmap(
+                                              pool_, chunk.buffers[0].data,
+                                              chunk.offset, chunk.length));
+          null_count = chunk.GetNullCount();
+        }
+        ARROW_ASSIGN_OR_RAISE(auto indices,
+                              AllocateBuffer(chunk.length * sizeof(int32_t), pool_));
+        result_.indices.push_back(
+            ArrayData::Make(int32(), chunk.length,
+                            {std::move(validity), std::move(indices)}, null_count));
+      }
+    }
+    return Status::OK();
+  }
+
+  int PartitionOf(const Scalar& value) const {
+    // Use another hash function than the memo tables, so that the values of a
+    // partition are well spread in its memo table
+    const auto h = ::arrow::internal::ScalarHelper<Scalar, 1>::ComputeHash(value);
+    return static_cast<int>(((h >> 32) * static_cast<uint64_t>(num_partitions_)) >> 32);
+  }
+
+  // Hash the values of a range into its own memo table, writing the range-local
+  // indices of the values
+  Status HashRange(Range* range) {
+    MemoTable memo_table(pool_, 0);
+    auto on_found = [&](int32_t index) {
+      if (with_counts_) ++range->counts[index];
+    };
+    auto on_not_found = [&](int32_t index) {
+      if (with_counts_) range->counts.push_back(1);
+    };
+    for (const auto& slice : range->slices) {
+      ArraySpan values = chunks_[slice.chunk];
+      values.SetSlice(values.offset + slice.offset, slice.length);
+      int32_t* out_indices =
+          with_indices_
+              ? result_.indices[slice.chunk]->template GetMutableValues<int32_t>(1) +
+                    slice.offset
+              : nullptr;
+      RETURN_NOT_OK(VisitArraySpanInline<Type>(
+          values,
+          [&](Scalar v) {
+            int32_t index;
+            RETURN_NOT_OK(memo_table.GetOrInsert(v, on_found, on_not_found, &index));
+            if (out_indices) *out_indices++ = index;
+            return Status::OK();
+          },
+          [&]() {
+            int32_t index = 0;
+            if (encode_nulls_) {
+              index = memo_table.GetOrInsertNull(on_found, on_not_found);
+            }
+            if (out_indices) *out_indices++ = index;
+            return Status::OK();
+          }));
+    }
+    RETURN_NOT_OK(DictionaryTraits<Type>::GetDictionaryArrayData(
+        pool_, type_, memo_table, /*start_offset=*/0, &range->dictionary));
+    range->null_index = memo_table.GetNull();
+
+    // Group the distinct values by partition
+    const int32_t num_values = memo_table.size();
+    const MemoValueReader<Type> reader(*range->dictionary);
+    range->partitions.resize(num_values);
+    range->partition_offsets.assign(num_partitions_ + 1, 0);
+    for (int32_t i = 0; i < num_values; ++i) {
+      // Nulls always go to the first partition
+      const int partition = i == range->null_index ? 0 : PartitionOf(reader[i]);
+      range->partitions[i] = static_cast<uint8_t>(partition);
+      ++range->partition_offsets[partition + 1];
+    }
+    for (int p = 0; p < num_partitions_; ++p) {
+      range->partition_offsets[p + 1] += range->partition_offsets[p];
+    }
+    range->partitioned.resize(num_values);
+    std::vector<int32_t> positions(range->partition_offsets.begin(),
+                                   range->partition_offsets.end() - 1);
+    for (int32_t i = 0; i < num_values; ++i) {
+      range->partitioned[positions[range->partitions[i]]++] = i;
+    }
+    range->partition_indices.resize(num_values);
+    range->is_first.assign(num_values, 0);
+    return Status::OK();
+  }
+
+  // Deduplicate the values of a partition across all ranges
+  Status DeduplicatePartition(int p) {
+    MemoTable memo_table(pool_, 0);
+    Partition* partition = &partitions_[p];
+    for (auto& range : ranges_) {
+      const MemoValueReader<Type> reader(*range.dictionary);
+      for (int32_t k = range.partition_offsets[p]; k < range.partition_offsets[p + 1];
+           ++k) {
+        const int32_t i = range.partitioned[k];
+        const int64_t count = with_counts_ ? range.counts[i] : 0;
+        auto on_found = [&](int32_t index) {
+          if (with_counts_) partition->counts[index] += count;
+        };
+        auto on_not_found = [&](int32_t index) {
+          range.is_first[i] = 1;
+          if (with_counts_) partition->counts.push_back(count);
+        };
+        int32_t index;
+        if (i == range.null_index) {
+          index = memo_table.GetOrInsertNull(on_found, on_not_found);
+        } else {
+          RETURN_NOT_OK(
+              memo_table.GetOrInsert(reader[i], on_found, on_not_found, &index));
+        }
+        range.partition_indices[i] = index;
+      }
+    }
+    partition->global_indices.resize(memo_table.size());
+    return Status::OK();
+  }
+
+  // Number the values first occurring in a range
+  Status NumberRange(Range* range) {
+    int64_t global_index = range->first_global_index;
+    for (int32_t i = 0; i < static_cast<int32_t>(range->is_first.size()); ++i) {
+      if (!range->is_first[i]) continue;
+      Partition* partition = &partitions_[range->partitions[i]];
+      const int32_t partition_index = range->partition_indices[i];
+      partition->global_indices[partition_index] = static_cast<int32_t>(global_index);
+      origins_[global_index] = range->dictionary_offset + i;
+      if (with_counts_) {
+        result_.counts[global_index] = partition->counts[partition_index];
+      }
+      ++global_index;
+    }
+    return Status::OK();
+  }
+
+  // Turn the range-local indices into indices in the output dictionary
+  Status RemapRange(Range* range) {
+    if (!with_indices_) return Status::OK();
+    const int32_t num_values = static_cast<int32_t>(range->partitions.size());
+    range->global_indices.resize(num_values);
+    for (int32_t i = 0; i < num_values; ++i) {
+      range->global_indices[i] = partitions_[range->partitions[i]]
+                                     .global_indices[range->partition_indices[i]];
+    }
+    const int32_t* global_indices = range->global_indices.data();
+    for (const auto& slice : range->slices) {
+      const ArraySpan& values = chunks_[slice.chunk];
+      int32_t* indices =
+          result_.indices[slice.chunk]->template GetMutableValues<int32_t>(1) +
+          slice.offset;
+      if (!encode_nulls_ && values.MayHaveNulls()) {
+        // The indices of nulls are left as zeros
+        ::arrow::internal::VisitSetBitRunsVoid(
+            values.buffers[0].data, values.offset + slice.offset, slice.length,
+            [&](int64_t position, int64_t length) {
+              for (int64_t j = position; j < position + length; ++j) {
+                indices[j] = global_indices[indices[j]];
+              }
+            });
+      } else {
+        for (int64_t j = 0; j < slice.length; ++j) {
+          indices[j] = global_indices[indices[j]];
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  ::arrow::internal::Executor* executor_;
+  const bool encode_nulls_;
+  const bool with_counts_;
+  const bool with_indices_;
+
+  std::vector<ArraySpan> chunks_;
+  std::vector<Range> ranges_;
+  int num_partitions_ = 1;
+  std::vector<Partition> partitions_;
+  // The position of each distinct value in the concatenated range dictionaries
+  std::vector<int64_t> origins_;
+  ParallelHashResult result_;
+};
+
 // ----------------------------------------------------------------------
 // Base class for all "regular" hash kernel implementations
 // (NullType has a separate implementation)
@@ -271,25 +745,71 @@ class RegularHashKernel : public HashKernel {
 
   Status Reset() override {
     memo_table_.reset(new MemoTable(pool_, 0));
+    parallel_dictionary_.reset();
     return action_.Reset();
   }
 
   Status Append(const ArraySpan& arr) override {
+    RETURN_NOT_OK(MergeParallelDictionary());
     RETURN_NOT_OK(action_.Reserve(arr.length));
     return DoAppend(arr);
   }
 
+  Status AppendChunks(KernelContext* ctx, const std::vector<ArraySpan>& chunks,
+                      std::vector<std::shared_ptr<ArrayData>>* out) override {
+    ::arrow::internal::Executor* executor = GetParallelHashExecutor(ctx, chunks);
+    // The parallel results can't be merged with those of previous calls, so
+    // hash serially on top of them instead
+    if (executor == nullptr || memo_table_->size() > 0 || parallel_dictionary_) {
+      return HashKernel::AppendChunks(ctx, chunks, out);
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    ParallelHasher<Type, Scalar> hasher(type_, pool_, executor,
+                                        action_.ShouldEncodeNulls(), Action::with_counts,
+                                        Action::with_indices);
+    ARROW_ASSIGN_OR_RAISE(auto result, hasher.Hash(chunks));
+    RETURN_NOT_OK(action_.ObserveParallel(result));
+    parallel_dictionary_ = std::move(result.dictionary);
+    *out = std::move(result.indices);
+    return Status::OK();
+  }
+
   Status Flush(ExecResult* out) override { return action_.Flush(out); }
 
   Status FlushFinal(ExecResult* out) override { return action_.FlushFinal(out); }
 
   Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
+    if (parallel_dictionary_) {
+      *out = parallel_dictionary_;
+      return Status::OK();
+    }
     return DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_, *memo_table_,
                                                           0 /* start_offset */, out);
   }
 
   std::shared_ptr<DataType> value_type() const override { return type_; }
 
+  // Seed the memo table with the dictionary of a previous parallel run, so that
+  // values appended afterwards are numbered after it.  The action already
+  // observed those values in ObserveParallel().
+  Status MergeParallelDictionary() {
+    if (!parallel_dictionary_) {
+      return Status::OK();
+    }
+    const std::shared_ptr<ArrayData> dictionary = std::move(parallel_dictionary_);
+    parallel_dictionary_.reset();
+    return VisitArraySpanInline<Type>(
+        ArraySpan(*dictionary),
+        [this](Scalar v) {
+          int32_t unused_memo_index;
+          return memo_table_->GetOrInsert(v, &unused_memo_index);
+        },
+        [this]() {
+          memo_table_->GetOrInsertNull();
+          return Status::OK();
+        });
+  }
+
   template <bool HasError = with_error_status>
   enable_if_t<!HasError, Status> DoAppend(const ArraySpan& arr) {
     return VisitArraySpanInline<Type>(
@@ -363,6 +883,8 @@ class RegularHashKernel : public HashKernel {
   std::shared_ptr<DataType> type_;
   Action action_;
   std::unique_ptr<MemoTable> memo_table_;
+  // The dictionary, when the input was hashed in parallel
+  std::shared_ptr<ArrayData> parallel_dictionary_;
 };
 
 // ----------------------------------------------------------------------
@@ -620,8 +1142,42 @@ Result<std::unique_ptr<KernelState>> DictionaryHashInit(KernelContext* ctx,
 
 Status HashExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
-  RETURN_NOT_OK(hash_impl->Append(ctx, batch[0].array));
-  RETURN_NOT_OK(hash_impl->Flush(out));
+  std::vector<std::shared_ptr<ArrayData>> outputs;
+  RETURN_NOT_OK(hash_impl->AppendChunks(ctx, {batch[0].array}, &outputs));
+  if (!outputs.empty()) {
+    out->value = std::move(outputs[0]);
+  }
+  return Status::OK();
+}
+
+// Hash all chunks at once, so that large inputs can be hashed in parallel
+Status HashChunks(KernelContext* ctx, const ExecBatch& batch,
+                  std::vector<std::shared_ptr<ArrayData>>* out) {
+  auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  std::vector<ArraySpan> chunks;
+  for (const auto& chunk : batch[0].chunked_array()->chunks()) {
+    // Like chunkwise execution, skip empty chunks
+    if (chunk->length() > 0) {
+      chunks.emplace_back(*chunk->data());
+    }
+  }
+  return hash_impl->AppendChunks(ctx, chunks, out);
+}
+
+// For unique and value_counts, the output is only produced on finalization
+Status HashExecChunked(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  std::vector<std::shared_ptr<ArrayData>> outputs;
+  return HashChunks(ctx, batch, &outputs);
+}
+
+Status DictEncodeExecChunked(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  std::vector<std::shared_ptr<ArrayData>> outputs;
+  RETURN_NOT_OK(HashChunks(ctx, batch, &outputs));
+  ArrayVector indices;
+  for (auto& output : outputs) {
+    indices.push_back(MakeArray(std::move(output)));
+  }
+  *out = std::make_shared<ChunkedArray>(std::move(indices), int32());
   return Status::OK();
 }
 
@@ -640,8 +1196,16 @@ Status DictEncodeFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto dict_type = dictionary(int32(), uniques->type);
   auto dict = MakeArray(uniques);
   for (size_t i = 0; i < out->size(); ++i) {
-    (*out)[i] =
-        std::make_shared<DictionaryArray>(dict_type, (*out)[i].make_array(), dict);
+    if ((*out)[i].is_chunked_array()) {
+      ArrayVector chunks;
+      for (const auto& indices : (*out)[i].chunked_array()->chunks()) {
+        chunks.push_back(std::make_shared<DictionaryArray>(dict_type, indices, dict));
+      }
+      (*out)[i] = std::make_shared<ChunkedArray>(std::move(chunks), dict_type);
+    } else {
+      (*out)[i] =
+          std::make_shared<DictionaryArray>(dict_type, (*out)[i].make_array(), dict);
+    }
   }
   return Status::OK();
 }
@@ -767,6 +1331,9 @@ const FunctionDoc dictionary_encode_doc(
 void RegisterVectorHash(FunctionRegistry* registry) {
   VectorKernel base;
   base.exec = HashExec;
+  base.exec_chunked = HashExecChunked;
+  // Chunked inputs are hashed all at once by exec_chunked
+  base.can_execute_chunkwise = false;
 
   // ----------------------------------------------------------------------
   // unique
@@ -803,6 +1370,7 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   // ----------------------------------------------------------------------
   // dictionary_encode
 
+  base.exec_chunked = DictEncodeExecChunked;
   base.finalize = DictEncodeFinalize;
   // Unique and ValueCounts output unchunked arrays
   base.output_chunked = true;
@@ -25,6 +25,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/api.h"
 
@@ -247,5 +248,72 @@ void UInt8SetArgs(benchmark::internal::Benchmark* bench) {
 
 BENCHMARK(UniqueUInt8)->Apply(UInt8SetArgs);
 
+// ----------------------------------------------------------------------
+// Scaling of the hash kernels with the number of threads
+
+constexpr int64_t kScalingChunkLength = 1 << 20;
+constexpr int kScalingDistinctChunks = 16;
+
+// A chunked array of int64 values drawn from [0, num_unique), made of chunks of
+// 1M values.  Chunks are reused above 16M values, to bound the memory usage.
+std::shared_ptr<ChunkedArray> ScalingInput(int64_t length, int64_t num_unique) {
+  random::RandomArrayGenerator rand(/*seed=*/0x5487655);
+  ArrayVector distinct_chunks;
+  for (int i = 0; i < kScalingDistinctChunks; ++i) {
+    distinct_chunks.push_back(rand.Int64(std::min(length, kScalingChunkLength), 0,
+                                         num_unique - 1, /*null_probability=*/0.01));
+  }
+  ArrayVector chunks;
+  for (int64_t offset = 0; offset < length; offset += kScalingChunkLength) {
+    chunks.push_back(distinct_chunks[chunks.size() % kScalingDistinctChunks]);
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks));
+}
+
+static void HashScaling(benchmark::State& state, const std::string& func_name) {
+  const int64_t length = state.range(0);
+  const int64_t num_unique = state.range(1);
+  const int num_threads = static_cast<int>(state.range(2));
+  auto values = ScalingInput(length, num_unique);
+
+  ASSIGN_OR_ABORT(auto thread_pool, ::arrow::internal::ThreadPool::Make(num_threads));
+  ExecContext ctx(default_memory_pool(), thread_pool.get());
+  ctx.set_use_threads(num_threads > 1);
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(func_name, {values}, &ctx).status());
+  }
+  state.counters["num_unique"] = static_cast<double>(num_unique);
+  state.counters["threads"] = num_threads;
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+static void UniqueScaling(benchmark::State& state) { HashScaling(state, "unique"); }
+
+static void ValueCountsScaling(benchmark::State& state) {
+  HashScaling(state, "value_counts");
+}
+
+static void DictionaryEncodeScaling(benchmark::State& state) {
+  HashScaling(state, "dictionary_encode");
+}
+
+void ScalingSetArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"length", "num_unique", "threads"});
+  // From 1M to 1G values
+  for (int64_t length = 1 << 20; length <= (1 << 30); length <<= 5) {
+    for (int64_t num_unique : {1000, 1000000}) {
+      for (int64_t num_threads : {1, 2, 4, 8, 16}) {
+        bench->Args({length, num_unique, num_threads});
+      }
+    }
+  }
+  bench->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK(UniqueScaling)->Apply(ScalingSetArgs);
+BENCHMARK(ValueCountsScaling)->Apply(ScalingSetArgs);
+BENCHMARK(DictionaryEncodeScaling)->Apply(ScalingSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
@@ -33,12 +33,14 @@
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
 #include "arrow/status.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
@@ -869,5 +871,87 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+TEST_F(TestHashKernel, ParallelMatchesSerial) {
+  // Large inputs are hashed in parallel, which must give the same results as
+  // hashing serially
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  const int64_t length = 1 << 18;
+  std::vector<std::shared_ptr<Array>> inputs;
+  for (int64_t max : {10, 100000}) {
+    auto ints = rand.Int64(length, 0, max, /*null_probability=*/0.05);
+    inputs.push_back(ints);
+    for (const auto& type : {float64(), boolean(), utf8(), large_utf8(),
+                             decimal128(10, 2)}) {
+      ASSERT_OK_AND_ASSIGN(auto values, Cast(*ints, type));
+      inputs.push_back(values);
+    }
+  }
+  inputs.push_back(rand.ArrayOf(fixed_size_binary(3), length, 0.05));
+  inputs.push_back(rand.ArrayOf(month_day_nano_interval(), length, 0.05));
+
+  for (const auto& values : inputs) {
+    ARROW_SCOPED_TRACE("type = ", values->type()->ToString());
+    ArrayVector chunks = {values->Slice(0, 1000), values->Slice(1000, 0),
+                          values->Slice(1000, length / 2),
+                          values->Slice(1000 + length / 2)};
+    auto chunked = std::make_shared<ChunkedArray>(std::move(chunks));
+
+    for (const Datum& input : {Datum(values), Datum(chunked)}) {
+      for (const std::string func_name : {"unique", "value_counts"}) {
+        ASSERT_OK_AND_ASSIGN(Datum expected,
+                             CallFunction(func_name, {input}, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(Datum actual,
+                             CallFunction(func_name, {input}, &parallel_ctx));
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+      for (auto null_encoding :
+           {DictionaryEncodeOptions::MASK, DictionaryEncodeOptions::ENCODE}) {
+        DictionaryEncodeOptions options(null_encoding);
+        ASSERT_OK_AND_ASSIGN(Datum expected,
+                             DictionaryEncode(input, options, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(Datum actual,
+                             DictionaryEncode(input, options, &parallel_ctx));
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+        if (input.is_chunked_array()) {
+          // Empty chunks are skipped
+          ASSERT_EQ(actual.chunked_array()->num_chunks(), 3);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestHashKernel, SerialAfterParallel) {
+  // With a small exec chunk size, the first span is hashed in parallel and the
+  // second one serially on top of its results
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  const int64_t length = 1 << 18;
+  parallel_ctx.set_exec_chunksize(length / 2 + 1000);
+
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  for (int64_t max : {10, 100000}) {
+    auto ints = rand.Int64(length, 0, max, /*null_probability=*/0.05);
+    ASSERT_OK_AND_ASSIGN(auto strings, Cast(*ints, utf8()));
+    for (const Datum& input : {Datum(ints), Datum(strings)}) {
+      ARROW_SCOPED_TRACE("type = ", input.type()->ToString(), ", max = ", max);
+      for (const std::string func_name : {"unique", "value_counts"}) {
+        ASSERT_OK_AND_ASSIGN(Datum expected,
+                             CallFunction(func_name, {input}, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(Datum actual,
+                             CallFunction(func_name, {input}, &parallel_ctx));
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
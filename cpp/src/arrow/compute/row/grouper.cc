@@ -17,9 +17,14 @@
 
 #include "arrow/compute/row/grouper.h"
 
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/exec/key_hash.h"
 #include "arrow/compute/exec/key_map.h"
 #include "arrow/compute/exec/options.h"
@@ -525,10 +530,354 @@ struct GrouperFastImpl : Grouper {
   SwissTable::AppendImpl map_append_impl_;
 };
 
+// Maps the indices of dictionaries which may change from batch to batch to
+// indices into a single unified dictionary.
+class DictionaryKeyUnifier {
+ public:
+  static Result<DictionaryKeyUnifier> Make(const DataType& key_type, ExecContext* ctx) {
+    const auto& dict_type = checked_cast<const DictionaryType&>(key_type);
+    DictionaryKeyUnifier unifier;
+    unifier.value_type_ = dict_type.value_type();
+    ARROW_ASSIGN_OR_RAISE(unifier.values_grouper_,
+                          Grouper::Make({unifier.value_type_}, ctx));
+    return std::move(unifier);
+  }
+
+  // Return, for each value of the given dictionary, its index in the unified
+  // dictionary. The dictionary values are only looked up if the dictionary
+  // differs from the one of the last call.
+  Result<const uint32_t*> Transpose(const ArraySpan& dictionary) {
+    if (!IsLastDictionary(dictionary)) {
+      last_dictionary_ = dictionary.ToArrayData();
+      ARROW_ASSIGN_OR_RAISE(Datum transpose,
+                            values_grouper_->Consume(ExecSpan(ExecBatch(
+                                {last_dictionary_}, last_dictionary_->length))));
+      last_transpose_ = transpose.array();
+    }
+    return last_transpose_->GetValues<uint32_t>(1);
+  }
+
+  uint32_t size() const { return values_grouper_->num_groups(); }
+
+  Result<std::shared_ptr<ArrayData>> GetDictionary() const {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, values_grouper_->GetUniques());
+    return uniques[0].array();
+  }
+
+ private:
+  bool IsLastDictionary(const ArraySpan& dictionary) const {
+    // The last dictionary is kept alive, so its buffers cannot have been reused
+    // for different contents
+    if (!last_dictionary_ || !dictionary.child_data.empty() ||
+        dictionary.offset != last_dictionary_->offset ||
+        dictionary.length != last_dictionary_->length ||
+        dictionary.num_buffers() != static_cast<int>(last_dictionary_->buffers.size())) {
+      return false;
+    }
+    for (int i = 0; i < dictionary.num_buffers(); ++i) {
+      const auto& buffer = last_dictionary_->buffers[i];
+      if (dictionary.buffers[i].data != (buffer ? buffer->data() : NULLPTR)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::shared_ptr<DataType> value_type_;
+  std::unique_ptr<Grouper> values_grouper_;
+  std::shared_ptr<ArrayData> last_dictionary_;
+  std::shared_ptr<ArrayData> last_transpose_;
+};
+
+// Grouper for keys which are all dictionary encoded. The key of each row is the
+// tuple of its indices into the unified dictionaries, so group ids can be looked
+// up without hashing the dictionary values. As long as the space of index tuples
+// is small enough, which is the case for low-cardinality keys, the group ids are
+// directly indexed by the tuples. Otherwise the tuples are grouped by a regular
+// grouper over uint32 columns.
+struct GrouperDictionaryImpl : Grouper {
+  static constexpr uint32_t kNoGroup = std::numeric_limits<uint32_t>::max();
+  // Maximum number of bits of the index tuples for the direct lookup table
+  static constexpr int kMaxDirectBits = 20;
+
+  static bool CanUse(const std::vector<TypeHolder>& key_types) {
+    if (key_types.empty()) {
+      return false;
+    }
+    for (const auto& key_type : key_types) {
+      if (key_type.id() != Type::DICTIONARY) {
+        return false;
+      }
+      const auto& value_type =
+          *checked_cast<const DictionaryType&>(*key_type).value_type();
+      if (!is_fixed_width(value_type.id()) && !is_base_binary_like(value_type.id()) &&
+          value_type.id() != Type::NA) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static Result<std::unique_ptr<GrouperDictionaryImpl>> Make(
+      const std::vector<TypeHolder>& key_types, ExecContext* ctx) {
+    auto impl = std::make_unique<GrouperDictionaryImpl>();
+    impl->ctx_ = ctx;
+    impl->key_types_ = key_types;
+    for (const auto& key_type : key_types) {
+      ARROW_ASSIGN_OR_RAISE(auto unifier, DictionaryKeyUnifier::Make(*key_type, ctx));
+      impl->unifiers_.push_back(std::move(unifier));
+    }
+    impl->bit_widths_.assign(key_types.size(), 0);
+    return std::move(impl);
+  }
+
+  Result<Datum> Consume(const ExecSpan& batch) override {
+    // ARROW-14027: broadcast scalar arguments for now
+    for (int i = 0; i < batch.num_values(); i++) {
+      if (batch[i].is_scalar()) {
+        ExecBatch expanded = batch.ToExecBatch();
+        for (int j = i; j < expanded.num_values(); j++) {
+          if (expanded.values[j].is_scalar()) {
+            ARROW_ASSIGN_OR_RAISE(
+                expanded.values[j],
+                MakeArrayFromScalar(*expanded.values[j].scalar(), expanded.length,
+                                    ctx_->memory_pool()));
+          }
+        }
+        return ConsumeImpl(ExecSpan(expanded));
+      }
+    }
+    return ConsumeImpl(batch);
+  }
+
+  Result<Datum> ConsumeImpl(const ExecSpan& batch) {
+    const int64_t num_rows = batch.length;
+    const int num_columns = batch.num_values();
+
+    // Compute the code of each row for each column: 0 for a null index, else
+    // 1 + the index into the unified dictionary. Codes are stored column-major.
+    codes_.resize(num_rows * num_columns);
+    for (int icol = 0; icol < num_columns; ++icol) {
+      const ArraySpan& indices = batch[icol].array;
+      ARROW_ASSIGN_OR_RAISE(const uint32_t* transpose,
+                            unifiers_[icol].Transpose(indices.dictionary()));
+      RETURN_NOT_OK(ComputeCodes(indices, transpose, codes_.data() + icol * num_rows));
+      RETURN_NOT_OK(EnsureBitWidth(icol, unifiers_[icol].size()));
+    }
+
+    if (codes_grouper_) {
+      ARROW_ASSIGN_OR_RAISE(Datum group_ids, codes_grouper_->Consume(CodesBatch(
+                                                 codes_.data(), num_rows)));
+      // Group ids are assigned in order of first occurrence
+      const uint32_t* ids = group_ids.array()->GetValues<uint32_t>(1);
+      for (int64_t i = 0; i < num_rows; ++i) {
+        if (ids[i] == num_groups_) {
+          AddGroup(codes_.data() + i, num_rows);
+        }
+      }
+      return group_ids;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> group_ids,
+        AllocateBuffer(sizeof(uint32_t) * num_rows, ctx_->memory_pool()));
+    auto* out = reinterpret_cast<uint32_t*>(group_ids->mutable_data());
+    for (int64_t i = 0; i < num_rows; ++i) {
+      uint32_t& group_id = direct_table_[DirectKey(codes_.data() + i, num_rows)];
+      if (group_id == kNoGroup) {
+        group_id = AddGroup(codes_.data() + i, num_rows);
+      }
+      out[i] = group_id;
+    }
+    return Datum(UInt32Array(num_rows, std::move(group_ids)));
+  }
+
+  uint32_t num_groups() const override { return num_groups_; }
+
+  Result<ExecBatch> GetUniques() override {
+    const auto num_columns = static_cast<int64_t>(key_types_.size());
+    ExecBatch out({}, num_groups_);
+    out.values.resize(num_columns);
+    for (int64_t icol = 0; icol < num_columns; ++icol) {
+      UInt32Builder builder(ctx_->memory_pool());
+      RETURN_NOT_OK(builder.Reserve(num_groups_));
+      for (uint32_t g = 0; g < num_groups_; ++g) {
+        const uint32_t code = group_codes_[g * num_columns + icol];
+        if (code == 0) {
+          builder.UnsafeAppendNull();
+        } else {
+          builder.UnsafeAppend(code - 1);
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(auto unified_indices, builder.Finish());
+
+      // The unified dictionary may have outgrown the index type of the key
+      const auto& dict_type = checked_cast<const DictionaryType&>(*key_types_[icol]);
+      auto maybe_indices = Cast(*unified_indices, dict_type.index_type(),
+                                CastOptions::Safe(), ctx_);
+      if (!maybe_indices.ok()) {
+        return Status::CapacityError("Too many distinct dictionary values (",
+                                     unifiers_[icol].size(), ") for keys of type ",
+                                     dict_type);
+      }
+      auto data = (*maybe_indices)->data()->Copy();
+      data->type = key_types_[icol].GetSharedPtr();
+      ARROW_ASSIGN_OR_RAISE(data->dictionary, unifiers_[icol].GetDictionary());
+      out.values[icol] = std::move(data);
+    }
+    return out;
+  }
+
+ private:
+  template <typename IndexCType>
+  static void TransposeIndices(const ArraySpan& indices, const uint32_t* transpose,
+                               uint32_t* codes) {
+    const auto* raw_indices = indices.GetValues<IndexCType>(1);
+    const uint8_t* validity = indices.buffers[0].data;
+    for (int64_t i = 0; i < indices.length; ++i) {
+      codes[i] =
+          (validity == NULLPTR || bit_util::GetBit(validity, indices.offset + i))
+              ? transpose[raw_indices[i]] + 1
+              : 0;
+    }
+  }
+
+  Status ComputeCodes(const ArraySpan& indices, const uint32_t* transpose,
+                      uint32_t* codes) {
+    const auto& dict_type = checked_cast<const DictionaryType&>(*indices.type);
+    switch (dict_type.index_type()->id()) {
+      case Type::INT8:
+        TransposeIndices<int8_t>(indices, transpose, codes);
+        break;
+      case Type::UINT8:
+        TransposeIndices<uint8_t>(indices, transpose, codes);
+        break;
+      case Type::INT16:
+        TransposeIndices<int16_t>(indices, transpose, codes);
+        break;
+      case Type::UINT16:
+        TransposeIndices<uint16_t>(indices, transpose, codes);
+        break;
+      case Type::INT32:
+        TransposeIndices<int32_t>(indices, transpose, codes);
+        break;
+      case Type::UINT32:
+        TransposeIndices<uint32_t>(indices, transpose, codes);
+        break;
+      case Type::INT64:
+        TransposeIndices<int64_t>(indices, transpose, codes);
+        break;
+      case Type::UINT64:
+        TransposeIndices<uint64_t>(indices, transpose, codes);
+        break;
+      default:
+        return Status::TypeError("Invalid dictionary index type: ",
+                                 *dict_type.index_type());
+    }
+    return Status::OK();
+  }
+
+  // Make sure the codes of column `icol` (up to dictionary_size) fit in its bit
+  // width, growing the direct table or switching to the codes grouper if needed
+  Status EnsureBitWidth(int icol, uint32_t dictionary_size) {
+    int bit_width = bit_widths_[icol];
+    while ((uint64_t{1} << bit_width) <= dictionary_size) {
+      ++bit_width;
+    }
+    if (bit_width == bit_widths_[icol]) {
+      return Status::OK();
+    }
+    bit_widths_[icol] = bit_width;
+    if (codes_grouper_) {
+      return Status::OK();
+    }
+
+    int total_bits = 0;
+    for (int width : bit_widths_) {
+      total_bits += width;
+    }
+    const auto num_columns = static_cast<int64_t>(key_types_.size());
+    if (total_bits > kMaxDirectBits) {
+      // Too many distinct tuples for a direct table: feed the existing groups to
+      // the codes grouper first, so that they keep their ids
+      direct_table_ = {};
+      ARROW_ASSIGN_OR_RAISE(
+          codes_grouper_,
+          Grouper::Make(std::vector<TypeHolder>(num_columns, uint32()), ctx_));
+      std::vector<uint32_t> group_codes(num_groups_ * num_columns);
+      for (uint32_t g = 0; g < num_groups_; ++g) {
+        for (int64_t icol = 0; icol < num_columns; ++icol) {
+          group_codes[icol * num_groups_ + g] = group_codes_[g * num_columns + icol];
+        }
+      }
+      if (num_groups_ > 0) {
+        RETURN_NOT_OK(
+            codes_grouper_->Consume(CodesBatch(group_codes.data(), num_groups_)));
+      }
+      return Status::OK();
+    }
+
+    direct_table_.assign(size_t{1} << total_bits, kNoGroup);
+    for (uint32_t g = 0; g < num_groups_; ++g) {
+      direct_table_[DirectKey(group_codes_.data() + g * num_columns, /*stride=*/1)] = g;
+    }
+    return Status::OK();
+  }
+
+  // The key of a row whose code for column `icol` is at row_codes[icol * stride]
+  uint64_t DirectKey(const uint32_t* row_codes, int64_t stride) const {
+    uint64_t key = 0;
+    for (size_t icol = 0; icol < bit_widths_.size(); ++icol) {
+      key = (key << bit_widths_[icol]) | row_codes[icol * stride];
+    }
+    return key;
+  }
+
+  // A batch of uint32 columns viewing column-major codes
+  ExecSpan CodesBatch(const uint32_t* codes, int64_t num_rows) {
+    const auto num_columns = static_cast<int64_t>(key_types_.size());
+    codes_batch_ = ExecBatch({}, num_rows);
+    for (int64_t icol = 0; icol < num_columns; ++icol) {
+      auto buffer = std::make_shared<Buffer>(
+          reinterpret_cast<const uint8_t*>(codes + icol * num_rows),
+          num_rows * static_cast<int64_t>(sizeof(uint32_t)));
+      codes_batch_.values.emplace_back(
+          ArrayData::Make(uint32(), num_rows, {nullptr, std::move(buffer)},
+                          /*null_count=*/0));
+    }
+    return ExecSpan(codes_batch_);
+  }
+
+  uint32_t AddGroup(const uint32_t* row_codes, int64_t stride) {
+    for (size_t icol = 0; icol < key_types_.size(); ++icol) {
+      group_codes_.push_back(row_codes[icol * stride]);
+    }
+    return num_groups_++;
+  }
+
+  ExecContext* ctx_;
+  std::vector<TypeHolder> key_types_;
+  std::vector<DictionaryKeyUnifier> unifiers_;
+  // Number of bits of the codes of each column in the direct table keys
+  std::vector<int> bit_widths_;
+  std::vector<uint32_t> codes_;
+  // Codes of the key columns of each group, row-major
+  std::vector<uint32_t> group_codes_;
+  uint32_t num_groups_ = 0;
+
+  std::vector<uint32_t> direct_table_ = {kNoGroup};
+  // Groups the codes once there are too many for the direct table
+  std::unique_ptr<Grouper> codes_grouper_;
+  ExecBatch codes_batch_;
+};
+
 }  // namespace
 
 Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<TypeHolder>& key_types,
                                                ExecContext* ctx) {
+  if (GrouperDictionaryImpl::CanUse(key_types)) {
+    return GrouperDictionaryImpl::Make(key_types, ctx);
+  }
   if (GrouperFastImpl::CanUse(key_types)) {
     return GrouperFastImpl::Make(key_types, ctx);
   }
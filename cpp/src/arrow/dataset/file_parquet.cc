@@ -17,6 +17,8 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -24,11 +26,19 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
@@ -38,7 +48,9 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -134,6 +146,255 @@ std::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
   return ParquetFileFragment::EvaluateStatisticsAsExpression(*field, *statistics);
 }
 
+// Return the rows of a row group held by the pages whose column index statistics
+// don't rule out the (bound) predicate.
+Result<parquet::RowRanges> TestPages(const compute::Expression& predicate,
+                                     const Schema& physical_schema,
+                                     const SchemaField& schema_field,
+                                     const parquet::ColumnDescriptor* descr,
+                                     const parquet::ColumnIndex& column_index,
+                                     const parquet::OffsetIndex& offset_index,
+                                     int64_t num_rows) {
+  const auto pages = parquet::RowRanges::PageRanges(offset_index, num_rows);
+  const auto& null_pages = column_index.null_pages();
+  const auto& min_values = column_index.encoded_min_values();
+  const auto& max_values = column_index.encoded_max_values();
+  if (null_pages.size() != pages.size() || min_values.size() != pages.size() ||
+      max_values.size() != pages.size()) {
+    return parquet::RowRanges::All(num_rows);
+  }
+
+  parquet::RowRanges selected;
+  for (size_t i = 0; i < pages.size(); ++i) {
+    std::optional<compute::Expression> guarantee;
+    if (null_pages[i]) {
+      guarantee = compute::is_null(compute::field_ref(schema_field.field->name()));
+    } else {
+      const bool has_null_count = column_index.has_null_counts();
+      const int64_t null_count = has_null_count ? column_index.null_counts()[i] : 0;
+      // A page which is not a null page holds at least one value
+      auto statistics = parquet::Statistics::Make(
+          descr, min_values[i], max_values[i], /*num_values=*/pages[i].length(),
+          null_count, /*distinct_count=*/0, /*has_min_max=*/true, has_null_count,
+          /*has_distinct_count=*/false);
+      guarantee = ParquetFileFragment::EvaluateStatisticsAsExpression(
+          *schema_field.field, *statistics);
+      if (guarantee && !has_null_count) {
+        // The null count is unknown, so the page may hold nulls as well
+        guarantee = compute::or_(
+            std::move(*guarantee),
+            compute::is_null(compute::field_ref(schema_field.field->name())));
+      }
+    }
+    if (guarantee) {
+      ARROW_ASSIGN_OR_RAISE(auto bound_guarantee, guarantee->Bind(physical_schema));
+      ARROW_ASSIGN_OR_RAISE(auto page_predicate,
+                            SimplifyWithGuarantee(predicate, bound_guarantee));
+      if (!page_predicate.IsSatisfiable()) continue;
+    }
+    selected.Add(pages[i]);
+  }
+  return selected;
+}
+
+// Hash a scalar the way the Parquet writer hashes the values of a column chunk into
+// its bloom filter, or return std::nullopt if the scalar cannot be looked up in it.
+std::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                                        const parquet::ColumnDescriptor& descr,
+                                        const Scalar& value) {
+  if (!value.is_valid) return std::nullopt;
+  const Type::type type_id = value.type->id();
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+    case parquet::Type::INT64: {
+      // Integers are sign- or zero-extended depending on their signedness, then
+      // truncated to the physical width, like the writer does.
+      int64_t integer;
+      switch (type_id) {
+        case Type::INT8:
+          integer = checked_cast<const Int8Scalar&>(value).value;
+          break;
+        case Type::INT16:
+          integer = checked_cast<const Int16Scalar&>(value).value;
+          break;
+        case Type::INT32:
+          integer = checked_cast<const Int32Scalar&>(value).value;
+          break;
+        case Type::INT64:
+          integer = checked_cast<const Int64Scalar&>(value).value;
+          break;
+        case Type::UINT8:
+          integer = checked_cast<const UInt8Scalar&>(value).value;
+          break;
+        case Type::UINT16:
+          integer = checked_cast<const UInt16Scalar&>(value).value;
+          break;
+        case Type::UINT32:
+          integer = checked_cast<const UInt32Scalar&>(value).value;
+          break;
+        case Type::UINT64:
+          integer = static_cast<int64_t>(checked_cast<const UInt64Scalar&>(value).value);
+          break;
+        case Type::DATE32:
+          integer = checked_cast<const Date32Scalar&>(value).value;
+          break;
+        default:
+          // Temporal types other than date32 may be stored in another unit
+          return std::nullopt;
+      }
+      if (descr.physical_type() == parquet::Type::INT64) {
+        return bloom_filter.Hash(integer);
+      }
+      if (bit_width(type_id) > 32) return std::nullopt;
+      return bloom_filter.Hash(static_cast<int32_t>(integer));
+    }
+    // Zeros and NaNs compare equal to values with other bit patterns
+    case parquet::Type::FLOAT: {
+      if (type_id != Type::FLOAT) return std::nullopt;
+      const float floating = checked_cast<const FloatScalar&>(value).value;
+      if (floating == 0 || std::isnan(floating)) return std::nullopt;
+      return bloom_filter.Hash(floating);
+    }
+    case parquet::Type::DOUBLE: {
+      if (type_id != Type::DOUBLE) return std::nullopt;
+      const double floating = checked_cast<const DoubleScalar&>(value).value;
+      if (floating == 0 || std::isnan(floating)) return std::nullopt;
+      return bloom_filter.Hash(floating);
+    }
+    case parquet::Type::BYTE_ARRAY: {
+      if (!is_base_binary_like(type_id)) return std::nullopt;
+      const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+      const parquet::ByteArray byte_array(static_cast<uint32_t>(buffer.size()),
+                                          buffer.data());
+      return bloom_filter.Hash(&byte_array);
+    }
+    case parquet::Type::FIXED_LEN_BYTE_ARRAY: {
+      if (type_id != Type::FIXED_SIZE_BINARY) return std::nullopt;
+      const auto& buffer = *checked_cast<const FixedSizeBinaryScalar&>(value).value;
+      if (buffer.size() != descr.type_length()) return std::nullopt;
+      const parquet::FLBA flba(buffer.data());
+      return bloom_filter.Hash(&flba, static_cast<uint32_t>(buffer.size()));
+    }
+    default:
+      return std::nullopt;
+  }
+}
+
+// Tests a (bound) predicate against the bloom filters of a row group, which are
+// read lazily as equality and set membership tests need them.
+class RowGroupBloomFilters {
+ public:
+  RowGroupBloomFilters(parquet::BloomFilterReader* reader, int row_group,
+                       const Schema& physical_schema,
+                       const std::unordered_map<int, int>& leaf_columns,
+                       const parquet::SchemaDescriptor& parquet_schema)
+      : reader_(reader),
+        row_group_(row_group),
+        physical_schema_(physical_schema),
+        leaf_columns_(leaf_columns),
+        parquet_schema_(parquet_schema) {}
+
+  // Return whether no row of the row group can satisfy the predicate.
+  //
+  // Only the equal and is_in calls reached from the root through and/or are
+  // tested: under Kleene logic a row rejected when such a call is false is also
+  // rejected when it is null, so pruning stays correct for rows holding nulls.
+  Result<bool> Excludes(const compute::Expression& predicate) {
+    auto call = predicate.call();
+    if (call == nullptr) return false;
+    const std::string& name = call->function_name;
+    if (name == "and" || name == "and_kleene") {
+      for (const auto& argument : call->arguments) {
+        ARROW_ASSIGN_OR_RAISE(bool excluded, Excludes(argument));
+        if (excluded) return true;
+      }
+      return false;
+    }
+    if (name == "or" || name == "or_kleene") {
+      for (const auto& argument : call->arguments) {
+        ARROW_ASSIGN_OR_RAISE(bool excluded, Excludes(argument));
+        if (!excluded) return false;
+      }
+      return true;
+    }
+    if (name == "equal" && call->arguments.size() == 2) {
+      const auto& left = call->arguments[0];
+      const auto& right = call->arguments[1];
+      const bool field_on_left = left.field_ref() != nullptr;
+      const auto& ref = field_on_left ? left : right;
+      const auto* value = field_on_left ? right.literal() : left.literal();
+      if (ref.field_ref() == nullptr || value == nullptr || !value->is_scalar()) {
+        return false;
+      }
+      return ExcludesValues(*ref.field_ref(), {value->scalar()});
+    }
+    if (name == "is_in" && call->arguments.size() == 1 &&
+        call->arguments[0].field_ref() != nullptr) {
+      const auto& options =
+          checked_cast<const compute::SetLookupOptions&>(*call->options);
+      if (!options.value_set.is_array()) return false;
+      auto value_set = options.value_set.make_array();
+      ScalarVector values;
+      values.reserve(value_set->length());
+      for (int64_t i = 0; i < value_set->length(); ++i) {
+        if (value_set->IsNull(i)) {
+          // A null in the value set matches the null values of the column
+          if (!options.skip_nulls) return false;
+          continue;
+        }
+        ARROW_ASSIGN_OR_RAISE(auto value, value_set->GetScalar(i));
+        values.push_back(std::move(value));
+      }
+      return ExcludesValues(*call->arguments[0].field_ref(), values);
+    }
+    return false;
+  }
+
+ private:
+  // Return whether the bloom filter of the referenced column rules out all values.
+  Result<bool> ExcludesValues(const FieldRef& ref, const ScalarVector& values) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema_));
+    if (match.indices().size() != 1) return false;
+    auto it = leaf_columns_.find(match[0]);
+    if (it == leaf_columns_.end()) return false;
+    const int column = it->second;
+    // Values of another type than the column were cast when binding, so the
+    // referenced field itself must have the type of the values.
+    const auto& type = physical_schema_.field(match[0])->type();
+    for (const auto& value : values) {
+      if (!value->type->Equals(*type)) return false;
+    }
+    parquet::BloomFilter* bloom_filter = GetBloomFilter(column);
+    if (bloom_filter == nullptr) return false;
+    for (const auto& value : values) {
+      auto hash = BloomFilterHash(*bloom_filter, *parquet_schema_.Column(column), *value);
+      if (!hash.has_value() || bloom_filter->FindHash(*hash)) return false;
+    }
+    return true;
+  }
+
+  parquet::BloomFilter* GetBloomFilter(int column) {
+    auto it = bloom_filters_.find(column);
+    if (it == bloom_filters_.end()) {
+      if (row_group_reader_ == nullptr) {
+        row_group_reader_ = reader_->RowGroup(row_group_);
+      }
+      it = bloom_filters_
+               .emplace(column, row_group_reader_->GetColumnBloomFilter(column))
+               .first;
+    }
+    return it->second.get();
+  }
+
+  parquet::BloomFilterReader* reader_;
+  const int row_group_;
+  const Schema& physical_schema_;
+  const std::unordered_map<int, int>& leaf_columns_;
+  const parquet::SchemaDescriptor& parquet_schema_;
+  std::shared_ptr<parquet::RowGroupBloomFilterReader> row_group_reader_;
+  std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters_;
+};
+
 void AddColumnIndices(const SchemaField& schema_field,
                       std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -224,12 +485,10 @@ Status ResolveOneFieldRef(
   return Status::OK();
 }
 
-// Compute the column projection based on the scan options
-Result<std::vector<int>> InferColumnProjection(const parquet::arrow::FileReader& reader,
-                                               const ScanOptions& options) {
+// Compute the leaf columns holding the given fields
+Result<std::vector<int>> ResolveColumns(const parquet::arrow::FileReader& reader,
+                                        const std::vector<FieldRef>& field_refs) {
   auto manifest = reader.manifest();
-  // Checks if the field is needed in either the projection or the filter.
-  auto field_refs = options.MaterializedFields();
 
   // Build a lookup table from top level field name to field metadata.
   // This is to avoid quadratic-time mapping of projected fields to
@@ -255,6 +514,13 @@ Result<std::vector<int>> InferColumnProjection(const parquet::arrow::FileReader&
   return columns_selection;
 }
 
+// Compute the column projection based on the scan options
+Result<std::vector<int>> InferColumnProjection(const parquet::arrow::FileReader& reader,
+                                               const ScanOptions& options) {
+  // Checks if the field is needed in either the projection or the filter.
+  return ResolveColumns(reader, options.MaterializedFields());
+}
+
 Status WrapSourceError(const Status& status, const std::string& path) {
   return status.WithMessage("Could not open Parquet input source '", path,
                             "': ", status.message());
@@ -481,6 +747,283 @@ struct SlicingGenerator {
   std::shared_ptr<State> state;
 };
 
+namespace {
+
+// Above this fraction of the rows read from a row group passing the filter, the
+// other columns are read in full: skipping many short runs of rows costs more
+// than materializing them, and they are filtered out after the scan anyway.
+constexpr double kLateMaterializationMaxSelectivity = 0.5;
+
+// Return the rows of a row group which pass the filter, given the rows read from
+// it and the filter result for each of them (a null result counts as false)
+Result<parquet::RowRanges> SelectRows(const parquet::RowRanges& read_ranges,
+                                      const BooleanArray& mask, MemoryPool* pool) {
+  DCHECK_EQ(read_ranges.num_rows(), mask.length());
+  const uint8_t* selection = mask.values()->data();
+  int64_t selection_offset = mask.offset();
+  std::shared_ptr<Buffer> valid_selection;
+  if (mask.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        valid_selection,
+        ::arrow::internal::BitmapAnd(pool, selection, selection_offset,
+                                     mask.null_bitmap_data(), mask.offset(),
+                                     mask.length(), /*out_offset=*/0));
+    selection = valid_selection->data();
+    selection_offset = 0;
+  }
+
+  parquet::RowRanges selected;
+  auto range = read_ranges.ranges().begin();
+  // Position in the mask of the first row of *range
+  int64_t range_position = 0;
+  ::arrow::internal::SetBitRunReader runs(selection, selection_offset, mask.length());
+  for (auto run = runs.NextRun(); !run.AtEnd(); run = runs.NextRun()) {
+    int64_t position = run.position;
+    const int64_t run_end = run.position + run.length;
+    while (position < run_end) {
+      while (position >= range_position + range->length()) {
+        range_position += range->length();
+        ++range;
+      }
+      const int64_t end = std::min(run_end, range_position + range->length());
+      selected.Add({range->start + position - range_position,
+                    range->start + end - range_position});
+      position = end;
+    }
+  }
+  return selected;
+}
+
+// A scan which decodes the columns referenced by the filter first, then only the
+// rows of the other projected columns which pass the filter.
+class LateMaterializedScan : public std::enable_shared_from_this<LateMaterializedScan> {
+ public:
+  // Return null if the filter does not allow skipping any column
+  static Result<std::shared_ptr<LateMaterializedScan>> Make(
+      std::shared_ptr<parquet::arrow::FileReader> reader,
+      std::shared_ptr<ScanOptions> options, compute::Expression guarantee,
+      const std::vector<int>& column_projection) {
+    if (options->dataset_schema == nullptr || !options->filter.IsBound()) {
+      return nullptr;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto filter, SimplifyWithGuarantee(options->filter, guarantee));
+    if (filter.literal() != nullptr) return nullptr;
+    ARROW_ASSIGN_OR_RAISE(auto filter_columns,
+                          ResolveColumns(*reader, FieldsInExpression(filter)));
+    const std::unordered_set<int> filter_column_set(filter_columns.begin(),
+                                                    filter_columns.end());
+
+    // Columns are split by top-level field: the children of a struct must all be
+    // read in the same phase to be assembled into the same struct.
+    const auto& schema_manifest = reader->manifest();
+    std::vector<int> column_fields;
+    std::unordered_set<int> filter_field_set;
+    for (int column : column_projection) {
+      ARROW_ASSIGN_OR_RAISE(auto field, schema_manifest.GetFieldIndices({column}));
+      column_fields.push_back(field[0]);
+      if (filter_column_set.count(column) > 0) {
+        filter_field_set.insert(field[0]);
+      }
+    }
+
+    auto scan = std::shared_ptr<LateMaterializedScan>(new LateMaterializedScan(
+        std::move(reader), std::move(options), std::move(filter), std::move(guarantee)));
+    for (size_t i = 0; i < column_projection.size(); ++i) {
+      if (filter_field_set.count(column_fields[i]) > 0) {
+        scan->filter_columns_.push_back(column_projection[i]);
+      } else {
+        scan->payload_columns_.push_back(column_projection[i]);
+      }
+    }
+    if (scan->filter_columns_.empty() || scan->payload_columns_.empty()) {
+      return nullptr;
+    }
+
+    // Lay the fields out as a single read of the whole projection would
+    const auto& manifest = scan->reader_->manifest();
+    ARROW_ASSIGN_OR_RAISE(auto fields, manifest.GetFieldIndices(column_projection));
+    ARROW_ASSIGN_OR_RAISE(auto filter_fields,
+                          manifest.GetFieldIndices(scan->filter_columns_));
+    ARROW_ASSIGN_OR_RAISE(auto payload_fields,
+                          manifest.GetFieldIndices(scan->payload_columns_));
+    for (int field : fields) {
+      auto it = std::find(filter_fields.begin(), filter_fields.end(), field);
+      if (it != filter_fields.end()) {
+        scan->output_columns_.emplace_back(true,
+                                           static_cast<int>(it - filter_fields.begin()));
+      } else {
+        it = std::find(payload_fields.begin(), payload_fields.end(), field);
+        DCHECK(it != payload_fields.end());
+        scan->output_columns_.emplace_back(false,
+                                           static_cast<int>(it - payload_fields.begin()));
+      }
+    }
+    return scan;
+  }
+
+  // Scan the given row groups, restricted to row_ranges unless it is empty
+  RecordBatchGenerator ScanRowGroups(std::vector<int> row_groups,
+                                     std::vector<parquet::RowRanges> row_ranges) {
+    auto metadata = reader_->parquet_reader()->metadata();
+    if (row_ranges.empty()) {
+      for (int row_group : row_groups) {
+        row_ranges.push_back(
+            parquet::RowRanges::All(metadata->RowGroup(row_group)->num_rows()));
+      }
+    }
+    struct State {
+      std::vector<int> row_groups;
+      std::vector<parquet::RowRanges> row_ranges;
+      std::atomic<size_t> next{0};
+    };
+    auto state = std::make_shared<State>();
+    state->row_groups = std::move(row_groups);
+    state->row_ranges = std::move(row_ranges);
+
+    auto self = shared_from_this();
+    AsyncGenerator<RecordBatchGenerator> row_group_generator =
+        [self, state]() -> Future<RecordBatchGenerator> {
+      const size_t i = state->next.fetch_add(1);
+      if (i >= state->row_groups.size()) {
+        return AsyncGeneratorEnd<RecordBatchGenerator>();
+      }
+      return self->ScanRowGroup(state->row_groups[i], state->row_ranges[i]);
+    };
+    if (options_->batch_readahead > 0) {
+      // Evaluate the filter over the next row group while the current one is
+      // being consumed
+      row_group_generator =
+          MakeReadaheadGenerator(std::move(row_group_generator), /*max_readahead=*/1);
+    }
+    return MakeConcatenatedGenerator(std::move(row_group_generator));
+  }
+
+ private:
+  LateMaterializedScan(std::shared_ptr<parquet::arrow::FileReader> reader,
+                       std::shared_ptr<ScanOptions> options, compute::Expression filter,
+                       compute::Expression guarantee)
+      : reader_(std::move(reader)),
+        options_(std::move(options)),
+        filter_(std::move(filter)),
+        guarantee_(std::move(guarantee)),
+        rows_to_readahead_(options_->batch_readahead * options_->batch_size) {}
+
+  // The filter columns of a row group must be read in full before knowing which
+  // rows of the payload columns to read, then the payload is streamed.
+  Future<RecordBatchGenerator> ScanRowGroup(int row_group,
+                                            const parquet::RowRanges& read_ranges) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto filter_generator,
+        reader_->GetRecordBatchGenerator(reader_, {row_group}, filter_columns_,
+                                         {read_ranges},
+                                         ::arrow::internal::GetCpuThreadPool(),
+                                         rows_to_readahead_));
+    auto self = shared_from_this();
+    return CollectAsyncGenerator(std::move(filter_generator))
+        .Then([self, row_group, read_ranges](const RecordBatchVector& filter_batches) {
+          return self->ScanPayload(row_group, read_ranges, filter_batches);
+        });
+  }
+
+  Result<RecordBatchGenerator> ScanPayload(int row_group,
+                                           const parquet::RowRanges& read_ranges,
+                                           const RecordBatchVector& filter_batches) {
+    RecordBatchGenerator empty = MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    if (filter_batches.empty()) return empty;
+    ARROW_ASSIGN_OR_RAISE(auto mask, EvaluateFilter(filter_batches));
+    ARROW_ASSIGN_OR_RAISE(auto selected, SelectRows(read_ranges, *mask, options_->pool));
+    if (selected.empty()) return empty;
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> filter_table,
+                          Table::FromRecordBatches(filter_batches));
+    parquet::RowRanges payload_ranges = read_ranges;
+    if (selected.num_rows() <=
+        kLateMaterializationMaxSelectivity * read_ranges.num_rows()) {
+      compute::ExecContext exec_context(options_->pool);
+      ARROW_ASSIGN_OR_RAISE(Datum filtered,
+                            compute::Filter(filter_table, mask,
+                                            compute::FilterOptions::Defaults(),
+                                            &exec_context));
+      filter_table = filtered.table();
+      payload_ranges = std::move(selected);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> filter_batch,
+                          filter_table->CombineChunksToBatch(options_->pool));
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto payload_generator,
+        reader_->GetRecordBatchGenerator(reader_, {row_group}, payload_columns_,
+                                         {payload_ranges},
+                                         ::arrow::internal::GetCpuThreadPool(),
+                                         rows_to_readahead_));
+    // Each payload batch is paired with the next rows of the filter columns. The
+    // consumers of the row group generators pull one batch at a time, so batches
+    // are mapped in order.
+    auto self = shared_from_this();
+    auto filter_offset = std::make_shared<int64_t>(0);
+    return MakeMappedGenerator(
+        std::move(payload_generator),
+        [self, filter_batch, filter_offset](
+            const std::shared_ptr<RecordBatch>& payload_batch) {
+          auto filter_slice =
+              filter_batch->Slice(*filter_offset, payload_batch->num_rows());
+          *filter_offset += payload_batch->num_rows();
+          return self->Combine(*filter_slice, *payload_batch);
+        });
+  }
+
+  Result<std::shared_ptr<BooleanArray>> EvaluateFilter(
+      const RecordBatchVector& batches) const {
+    ArrayVector masks;
+    for (const auto& batch : batches) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto exec_batch,
+          compute::MakeExecBatch(*options_->dataset_schema, batch, guarantee_));
+      ARROW_ASSIGN_OR_RAISE(Datum mask,
+                            compute::ExecuteScalarExpression(filter_, exec_batch));
+      if (mask.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto mask_array,
+            MakeArrayFromScalar(*mask.scalar(), batch->num_rows(), options_->pool));
+        masks.push_back(std::move(mask_array));
+      } else {
+        masks.push_back(mask.make_array());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto mask, Concatenate(masks, options_->pool));
+    return checked_pointer_cast<BooleanArray>(std::move(mask));
+  }
+
+  std::shared_ptr<RecordBatch> Combine(const RecordBatch& filter_batch,
+                                       const RecordBatch& payload_batch) const {
+    FieldVector fields;
+    ArrayVector columns;
+    for (const auto& output_column : output_columns_) {
+      const RecordBatch& batch = output_column.first ? filter_batch : payload_batch;
+      fields.push_back(batch.schema()->field(output_column.second));
+      columns.push_back(batch.column(output_column.second));
+    }
+    return RecordBatch::Make(schema(std::move(fields), filter_batch.schema()->metadata()),
+                             payload_batch.num_rows(), std::move(columns));
+  }
+
+  std::shared_ptr<parquet::arrow::FileReader> reader_;
+  std::shared_ptr<ScanOptions> options_;
+  // The scan filter, simplified against the partition expression
+  compute::Expression filter_;
+  compute::Expression guarantee_;
+  // Leaf columns read before and after evaluating the filter
+  std::vector<int> filter_columns_;
+  std::vector<int> payload_columns_;
+  // For each output field, whether it is read with the filter columns, and its
+  // index among the fields read with them
+  std::vector<std::pair<bool, int>> output_columns_;
+  int64_t rows_to_readahead_;
+};
+
+}  // namespace
+
 Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
@@ -509,6 +1052,27 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
                             parquet_fragment->FilterRowGroups(options->filter));
       if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
     }
+    // Drop the row groups whose bloom filters rule out the filter
+    ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterBloomFilters(
+                                          options->filter, std::move(row_groups),
+                                          reader->parquet_reader()));
+    if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    // Narrow the selected row groups down to the pages which may hold matching rows
+    ARROW_ASSIGN_OR_RAISE(auto row_ranges,
+                          parquet_fragment->FilterPages(options->filter, row_groups,
+                                                        reader->parquet_reader()));
+    if (!row_ranges.empty()) {
+      size_t num_selected = 0;
+      for (size_t i = 0; i < row_groups.size(); ++i) {
+        if (row_ranges[i].empty()) continue;
+        row_groups[num_selected] = row_groups[i];
+        row_ranges[num_selected] = std::move(row_ranges[i]);
+        ++num_selected;
+      }
+      row_groups.resize(num_selected);
+      row_ranges.resize(num_selected);
+      if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
     ARROW_ASSIGN_OR_RAISE(auto column_projection,
                           InferColumnProjection(*reader, *options));
     ARROW_ASSIGN_OR_RAISE(
@@ -517,10 +1081,25 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
             kParquetTypeName, options.get(), default_fragment_scan_options));
     int batch_readahead = options->batch_readahead;
     int64_t rows_to_readahead = batch_readahead * options->batch_size;
-    ARROW_ASSIGN_OR_RAISE(auto generator,
-                          reader->GetRecordBatchGenerator(
-                              reader, row_groups, column_projection,
-                              ::arrow::internal::GetCpuThreadPool(), rows_to_readahead));
+    std::shared_ptr<LateMaterializedScan> late_materialized_scan;
+    if (parquet_scan_options->late_materialization) {
+      ARROW_ASSIGN_OR_RAISE(
+          late_materialized_scan,
+          LateMaterializedScan::Make(reader, options,
+                                     parquet_fragment->partition_expression(),
+                                     column_projection));
+    }
+    RecordBatchGenerator generator;
+    if (late_materialized_scan) {
+      generator = late_materialized_scan->ScanRowGroups(std::move(row_groups),
+                                                        std::move(row_ranges));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
+                                           reader, row_groups, column_projection,
+                                           row_ranges,
+                                           ::arrow::internal::GetCpuThreadPool(),
+                                           rows_to_readahead));
+    }
     RecordBatchGenerator sliced =
         SlicingGenerator(std::move(generator), options->batch_size);
     if (batch_readahead == 0) {
@@ -795,6 +1374,103 @@ Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
   return row_groups;
 }
 
+Result<std::vector<int>> ParquetFileFragment::FilterBloomFilters(
+    compute::Expression predicate, std::vector<int> row_groups,
+    parquet::ParquetFileReader* reader) {
+  // Top-level leaf fields referenced by the predicate, keyed to their column index
+  std::unordered_map<int, int> leaf_columns;
+  std::shared_ptr<Schema> physical_schema;
+  {
+    auto lock = physical_schema_mutex_.Lock();
+    DCHECK_NE(metadata_, nullptr);
+    physical_schema = physical_schema_;
+    ARROW_ASSIGN_OR_RAISE(
+        predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+    for (const FieldRef& ref : FieldsInExpression(predicate)) {
+      ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+      if (match.indices().size() != 1) continue;
+      const SchemaField& schema_field = manifest_->schema_fields[match[0]];
+      if (schema_field.is_leaf()) leaf_columns[match[0]] = schema_field.column_index;
+    }
+  }
+  if (leaf_columns.empty() || !predicate.IsSatisfiable()) {
+    return row_groups;
+  }
+  ARROW_ASSIGN_OR_RAISE(predicate, predicate.Bind(*physical_schema));
+
+  size_t num_selected = 0;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto& bloom_filter_reader = reader->GetBloomFilterReader();
+  for (int row_group : row_groups) {
+    RowGroupBloomFilters bloom_filters(&bloom_filter_reader, row_group,
+                                       *physical_schema, leaf_columns,
+                                       *metadata_->schema());
+    ARROW_ASSIGN_OR_RAISE(bool excluded, bloom_filters.Excludes(predicate));
+    if (!excluded) row_groups[num_selected++] = row_group;
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  row_groups.resize(num_selected);
+  return row_groups;
+}
+
+Result<std::vector<parquet::RowRanges>> ParquetFileFragment::FilterPages(
+    compute::Expression predicate, const std::vector<int>& row_groups,
+    parquet::ParquetFileReader* reader) {
+  std::vector<const SchemaField*> filter_fields;
+  std::shared_ptr<Schema> physical_schema;
+  {
+    auto lock = physical_schema_mutex_.Lock();
+    DCHECK_NE(metadata_, nullptr);
+    physical_schema = physical_schema_;
+    ARROW_ASSIGN_OR_RAISE(
+        predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+    for (const FieldRef& ref : FieldsInExpression(predicate)) {
+      ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+      if (match.empty()) continue;
+      // For now, only leaf (primitive) types are supported.
+      const SchemaField& schema_field = manifest_->schema_fields[match[0]];
+      if (schema_field.is_leaf()) filter_fields.push_back(&schema_field);
+    }
+  }
+  if (filter_fields.empty() || !predicate.IsSatisfiable()) {
+    return std::vector<parquet::RowRanges>{};
+  }
+  ARROW_ASSIGN_OR_RAISE(predicate, predicate.Bind(*physical_schema));
+
+  std::vector<parquet::RowRanges> row_ranges;
+  bool any_rows_excluded = false;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto page_index_reader = reader->GetPageIndexReader();
+  for (int row_group : row_groups) {
+    auto row_group_metadata = metadata_->RowGroup(row_group);
+    const int64_t num_rows = row_group_metadata->num_rows();
+    auto selected = parquet::RowRanges::All(num_rows);
+
+    auto row_group_index_reader = page_index_reader->RowGroup(row_group);
+    for (const SchemaField* schema_field : filter_fields) {
+      if (row_group_index_reader == nullptr) break;
+      const int column = schema_field->column_index;
+      // Page indexes of encrypted columns cannot be read yet
+      if (row_group_metadata->ColumnChunk(column)->crypto_metadata() != nullptr) {
+        continue;
+      }
+      auto column_index = row_group_index_reader->GetColumnIndex(column);
+      auto offset_index = row_group_index_reader->GetOffsetIndex(column);
+      if (column_index == nullptr || offset_index == nullptr) continue;
+      ARROW_ASSIGN_OR_RAISE(
+          auto pages, TestPages(predicate, *physical_schema, *schema_field,
+                                metadata_->schema()->Column(column), *column_index,
+                                *offset_index, num_rows));
+      selected = parquet::RowRanges::Intersection(selected, pages);
+    }
+    any_rows_excluded |= selected.num_rows() < num_rows;
+    row_ranges.push_back(std::move(selected));
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  if (!any_rows_excluded) return std::vector<parquet::RowRanges>{};
+  return row_ranges;
+}
+
 Result<std::optional<int64_t>> ParquetFileFragment::TryCountRows(
     compute::Expression predicate) {
   DCHECK_NE(metadata_, nullptr);
@@ -37,6 +37,7 @@ class ParquetFileReader;
 class Statistics;
 class ColumnChunkMetaData;
 class RowGroupMetaData;
+class RowRanges;
 class FileMetaData;
 class FileDecryptionProperties;
 class FileEncryptionProperties;
@@ -193,6 +194,16 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::vector<int>> FilterRowGroups(compute::Expression predicate);
   /// Simplify the predicate against the statistics of each row group.
   Result<std::vector<compute::Expression>> TestRowGroups(compute::Expression predicate);
+  /// Return the given row groups minus those whose bloom filters rule out the
+  /// equality and set membership tests of the predicate.
+  Result<std::vector<int>> FilterBloomFilters(compute::Expression predicate,
+                                              std::vector<int> row_groups,
+                                              parquet::ParquetFileReader* reader);
+  /// Return the rows of the given row groups held by the pages whose column index
+  /// doesn't rule out the predicate, or an empty vector if no rows were excluded.
+  Result<std::vector<parquet::RowRanges>> FilterPages(
+      compute::Expression predicate, const std::vector<int>& row_groups,
+      parquet::ParquetFileReader* reader);
   /// Try to count rows matching the predicate using metadata. Expects
   /// metadata to be present, and expects the predicate to have been
   /// simplified against the partition expression already.
@@ -226,6 +237,13 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   /// ScanOptions. Additionally, dictionary columns come from
   /// ParquetFileFormat::ReaderOptions::dict_columns.
   std::shared_ptr<parquet::ArrowReaderProperties> arrow_reader_properties;
+  /// Whether to read the columns referenced by the filter first, then only the
+  /// rows of the other columns which pass it.
+  ///
+  /// This saves decoding, and decompressing the pages holding no passing rows
+  /// when the file has a page index, at the cost of evaluating the filter twice.
+  /// Batches still hold rows not passing the filter when most rows pass.
+  bool late_materialization = false;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
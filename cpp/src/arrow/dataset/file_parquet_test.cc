@@ -29,6 +29,7 @@
 #include "arrow/io/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/testing/builder.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
@@ -551,6 +552,179 @@ TEST_P(TestParquetFileFormatScan, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_P(TestParquetFileFormatScan, PredicatePushdownPages) {
+  constexpr int64_t kNumRows = 1000;
+  constexpr int64_t kRowsPerPage = 10;
+
+  // A single row group of sorted values, with a page index
+  std::shared_ptr<Array> values;
+  ArrayFromVector<Int64Type>(::arrow::internal::Iota<int64_t>(kNumRows), &values);
+  auto table = Table::Make(schema({field("i64", int64())}), {values});
+  auto writer_properties = WriterProperties::Builder()
+                               .write_batch_size(kRowsPerPage)
+                               ->data_pagesize(1)
+                               ->enable_write_page_index()
+                               ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kNumRows, writer_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, kNumRows, 1);
+
+  // Only the pages which may hold matching rows are read
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(500)));
+  CountRowsAndBatchesInScan(fragment, kRowsPerPage, 1);
+  SetFilter(less(field_ref("i64"), literal<int64_t>(25)));
+  CountRowsAndBatchesInScan(fragment, 3 * kRowsPerPage, 1);
+  SetFilter(or_(equal(field_ref("i64"), literal<int64_t>(5)),
+                equal(field_ref("i64"), literal<int64_t>(995))));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowsPerPage, 1);
+  SetFilter(is_null(field_ref("i64")));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(greater(field_ref("i64"), literal(kNumRows)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+}
+
+TEST_P(TestParquetFileFormatScan, PredicatePushdownBloomFilter) {
+  constexpr int64_t kRowsPerRowGroup = 1000;
+
+  // Two row groups with overlapping min/max statistics: even values in the first,
+  // odd values in the second.
+  std::vector<int64_t> ints;
+  std::vector<std::string> strings;
+  for (int64_t i = 0; i < 2 * kRowsPerRowGroup; ++i) {
+    const int64_t value = 2 * (i % kRowsPerRowGroup) + i / kRowsPerRowGroup;
+    ints.push_back(value);
+    strings.push_back(std::to_string(value));
+  }
+  std::shared_ptr<Array> int_values, string_values;
+  ArrayFromVector<Int64Type>(ints, &int_values);
+  ArrayFromVector<StringType, std::string>(strings, &string_values);
+  auto table = Table::Make(schema({field("i64", int64()), field("str", utf8())}),
+                           {int_values, string_values});
+  parquet::BloomFilterOptions bloom_filter_options;
+  bloom_filter_options.ndv = kRowsPerRowGroup;
+  bloom_filter_options.fpp = 0.001;
+  auto writer_properties =
+      WriterProperties::Builder().enable_bloom_filter(bloom_filter_options)->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kRowsPerRowGroup,
+                       writer_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowsPerRowGroup, 2);
+
+  // Only the row groups whose bloom filters may hold the values are read
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(5)));
+  CountRowsAndBatchesInScan(fragment, kRowsPerRowGroup, 1);
+  SetFilter(equal(field_ref("str"), literal("6")));
+  CountRowsAndBatchesInScan(fragment, kRowsPerRowGroup, 1);
+  SetFilter(or_(equal(field_ref("i64"), literal<int64_t>(5)),
+                equal(field_ref("str"), literal("7"))));
+  CountRowsAndBatchesInScan(fragment, kRowsPerRowGroup, 1);
+  SetFilter(or_(equal(field_ref("i64"), literal<int64_t>(5)),
+                equal(field_ref("str"), literal("6"))));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowsPerRowGroup, 2);
+  SetFilter(and_(equal(field_ref("i64"), literal<int64_t>(5)),
+                 equal(field_ref("str"), literal("6"))));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(call("is_in", {field_ref("i64")},
+                 compute::SetLookupOptions{ArrayFromJSON(int64(), "[4, 6]")}));
+  CountRowsAndBatchesInScan(fragment, kRowsPerRowGroup, 1);
+  SetFilter(call("is_in", {field_ref("i64")},
+                 compute::SetLookupOptions{ArrayFromJSON(int64(), "[4, 5]")}));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowsPerRowGroup, 2);
+  // Nulls in the value set may match null values, which bloom filters don't track
+  SetFilter(call("is_in", {field_ref("i64")},
+                 compute::SetLookupOptions{ArrayFromJSON(int64(), "[5, null]")}));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowsPerRowGroup, 2);
+  // Negations can't be decided by bloom filters
+  SetFilter(not_(equal(field_ref("i64"), literal<int64_t>(5))));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowsPerRowGroup, 2);
+}
+
+TEST_P(TestParquetFileFormatScan, LateMaterialization) {
+  constexpr int64_t kNumRows = 1000;
+  constexpr int64_t kRowsPerRowGroup = 500;
+  constexpr int64_t kRowsPerPage = 10;
+
+  std::vector<std::string> strings;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    strings.push_back(std::to_string(i));
+  }
+  std::shared_ptr<Array> int_values, string_values;
+  ArrayFromVector<Int64Type>(::arrow::internal::Iota<int64_t>(kNumRows), &int_values);
+  ArrayFromVector<StringType, std::string>(strings, &string_values);
+  ASSERT_OK_AND_ASSIGN(auto struct_values,
+                       StructArray::Make({int_values, string_values},
+                                         {field("x", int64()), field("y", utf8())}));
+  auto table = Table::Make(schema({field("i64", int64()), field("str", utf8()),
+                                   field("struct", struct_values->type())}),
+                           {int_values, string_values, struct_values});
+  auto writer_properties = WriterProperties::Builder()
+                               .write_batch_size(kRowsPerPage)
+                               ->data_pagesize(1)
+                               ->enable_write_page_index()
+                               ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kRowsPerRowGroup,
+                       writer_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->late_materialization = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+  // Stream each row group in several batches
+  opts_->batch_size = 64;
+
+  auto scan = [&](compute::Expression filter) -> Result<std::shared_ptr<Table>> {
+    SetFilter(std::move(filter));
+    RecordBatchVector batches;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+      batches.push_back(std::move(batch));
+    }
+    return Table::FromRecordBatches(table->schema(), std::move(batches));
+  };
+
+  // Only the rows passing the filter are read from the other column
+  ASSERT_OK_AND_ASSIGN(auto actual, scan(equal(field_ref("str"), literal("123"))));
+  AssertTablesEqual(*table->Slice(123, 1), *actual, /*same_chunk_layout=*/false);
+
+  ASSERT_OK_AND_ASSIGN(
+      actual, scan(or_(less(field_ref("i64"), literal<int64_t>(3)),
+                       greater(field_ref("i64"), literal<int64_t>(997)))));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       ConcatenateTables({table->Slice(0, 3), table->Slice(998)}));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  ASSERT_OK_AND_ASSIGN(actual, scan(is_null(field_ref("str"))));
+  ASSERT_EQ(actual->num_rows(), 0);
+
+  // All the children of a struct are read along with the one the filter uses
+  ASSERT_OK_AND_ASSIGN(actual, scan(equal(field_ref(FieldRef("struct", "y")),
+                                          literal("123"))));
+  AssertTablesEqual(*table->Slice(123, 1), *actual, /*same_chunk_layout=*/false);
+  ASSERT_OK_AND_ASSIGN(actual, scan(less(field_ref(FieldRef("struct", "x")),
+                                         literal<int64_t>(3))));
+  AssertTablesEqual(*table->Slice(0, 3), *actual, /*same_chunk_layout=*/false);
+
+  // When most rows pass, all of them are read
+  ASSERT_OK_AND_ASSIGN(
+      actual, scan(not_equal(field_ref("i64"), literal(kRowsPerRowGroup))));
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST_P(TestParquetFileFormatScan, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
 
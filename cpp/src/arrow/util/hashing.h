@@ -42,6 +42,7 @@
 #include "arrow/util/endian.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 
 #define XXH_INLINE_ALL
@@ -193,12 +194,66 @@ hash_t ComputeStringHash(const void* data, int64_t length) {
 
 // ----------------------------------------------------------------------
 // An open-addressing insert-only hash table (no deletes)
+//
+// Besides the entries, the table keeps one control byte per slot, which is
+// either empty or holds a 7-bit tag derived from the entry's hash.  Slots are
+// probed a group at a time: the tag is compared against all the control bytes
+// of a group at once, so that entries are only touched on a likely match.
+
+#if defined(ARROW_HAVE_SSE4_2)
+// A group of control bytes, matched with SSE2 instructions
+struct HashTableGroup {
+  static constexpr uint64_t kSize = 16;
+  // Match masks have one bit per slot
+  static constexpr int kSlotShift = 0;
+
+  explicit HashTableGroup(const uint8_t* control)
+      : control_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+  uint64_t Match(uint8_t tag) const {
+    const __m128i tags = _mm_set1_epi8(static_cast<char>(tag));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(control_, tags)));
+  }
+
+  // Only the empty control byte has its high bit set
+  uint64_t MatchEmpty() const {
+    return static_cast<uint32_t>(_mm_movemask_epi8(control_));
+  }
+
+  __m128i control_;
+};
+#else
+// A group of control bytes, matched with 64-bit integer operations
+struct HashTableGroup {
+  static constexpr uint64_t kSize = 8;
+  // Match masks have the high bit of each matching byte set
+  static constexpr int kSlotShift = 3;
+
+  static constexpr uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+  explicit HashTableGroup(const uint8_t* control)
+      : control_(bit_util::FromLittleEndian(util::SafeLoadAs<uint64_t>(control))) {}
+
+  // This may report false positives in the byte following an actual match,
+  // callers must check the entries anyway.
+  uint64_t Match(uint8_t tag) const {
+    const uint64_t x = control_ ^ (kLsbs * tag);
+    return (x - kLsbs) & ~x & kMsbs;
+  }
+
+  // Only the empty control byte has its high bit set
+  uint64_t MatchEmpty() const { return control_ & kMsbs; }
+
+  uint64_t control_;
+};
+#endif
 
 template <typename Payload>
 class HashTable {
  public:
   static constexpr hash_t kSentinel = 0ULL;
-  static constexpr int64_t kLoadFactor = 2UL;
+  static constexpr uint8_t kEmptyControl = 0x80;
 
   struct Entry {
     hash_t h;
@@ -208,30 +263,31 @@ class HashTable {
     operator bool() const { return h != kSentinel; }
   };
 
-  HashTable(MemoryPool* pool, uint64_t capacity) : entries_builder_(pool) {
+  HashTable(MemoryPool* pool, uint64_t capacity)
+      : control_builder_(pool), entries_builder_(pool) {
     DCHECK_NE(pool, nullptr);
     // Minimum of 32 elements
     capacity = std::max<uint64_t>(capacity, 32UL);
     capacity_ = bit_util::NextPower2(capacity);
-    capacity_mask_ = capacity_ - 1;
+    group_mask_ = capacity_ / HashTableGroup::kSize - 1;
     size_ = 0;
 
     DCHECK_OK(UpsizeBuffer(capacity_));
   }
 
-  // Lookup with non-linear probing
+  // Lookup with group-wise probing
   // cmp_func should have signature bool(const Payload*).
   // Return a (Entry*, found) pair.
   template <typename CmpFunc>
   std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
-    auto p = Lookup<DoCompare, CmpFunc>(h, entries_, capacity_mask_,
+    auto p = Lookup<DoCompare, CmpFunc>(h, control_, entries_, group_mask_,
                                         std::forward<CmpFunc>(cmp_func));
     return {&entries_[p.first], p.second};
   }
 
   template <typename CmpFunc>
   std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
-    auto p = Lookup<DoCompare, CmpFunc>(h, entries_, capacity_mask_,
+    auto p = Lookup<DoCompare, CmpFunc>(h, control_, entries_, group_mask_,
                                         std::forward<CmpFunc>(cmp_func));
     return {&entries_[p.first], p.second};
   }
@@ -239,13 +295,15 @@ class HashTable {
   Status Insert(Entry* entry, hash_t h, const Payload& payload) {
     // Ensure entry is empty before inserting
     assert(!*entry);
-    entry->h = FixHash(h);
+    h = FixHash(h);
+    entry->h = h;
     entry->payload = payload;
+    control_[entry - entries_] = HashTag(h);
     ++size_;
 
     if (ARROW_PREDICT_FALSE(NeedUpsizing())) {
       // Resize less frequently since it is expensive
-      return Upsize(capacity_ * kLoadFactor * 2);
+      return Upsize(capacity_ * 4);
     }
     return Status::OK();
   }
@@ -257,9 +315,8 @@ class HashTable {
   template <typename VisitFunc>
   void VisitEntries(VisitFunc&& visit_func) const {
     for (uint64_t i = 0; i < capacity_; i++) {
-      const auto& entry = entries_[i];
-      if (entry) {
-        visit_func(&entry);
+      if (control_[i] != kEmptyControl) {
+        visit_func(&entries_[i]);
       }
     }
   }
@@ -270,51 +327,54 @@ class HashTable {
 
   // The workhorse lookup function
   template <CompareKind CKind, typename CmpFunc>
-  std::pair<uint64_t, bool> Lookup(hash_t h, const Entry* entries, uint64_t size_mask,
+  std::pair<uint64_t, bool> Lookup(hash_t h, const uint8_t* control,
+                                   const Entry* entries, uint64_t group_mask,
                                    CmpFunc&& cmp_func) const {
-    static constexpr uint8_t perturb_shift = 5;
-
-    uint64_t index, perturb;
-    const Entry* entry;
-
     h = FixHash(h);
-    index = h & size_mask;
-    perturb = (h >> perturb_shift) + 1U;
+    const uint8_t tag = HashTag(h);
+    uint64_t group = h & group_mask;
+    uint64_t step = 0;
 
     while (true) {
-      entry = &entries[index];
-      if (CompareEntry<CKind, CmpFunc>(h, entry, std::forward<CmpFunc>(cmp_func))) {
-        // Found
-        return {index, true};
+      const uint64_t base = group * HashTableGroup::kSize;
+      const HashTableGroup control_group(control + base);
+      if (CKind == DoCompare) {
+        for (uint64_t match = control_group.Match(tag); match != 0;
+             match &= match - 1) {
+          const uint64_t index = base + (bit_util::CountTrailingZeros(match) >>
+                                         HashTableGroup::kSlotShift);
+          // Empty entries have a sentinel hash and never compare equal
+          if (ARROW_PREDICT_TRUE(entries[index].h == h) &&
+              ARROW_PREDICT_TRUE(cmp_func(&entries[index].payload))) {
+            // Found
+            return {index, true};
+          }
+        }
       }
-      if (entry->h == kSentinel) {
-        // Empty slot
+      const uint64_t empty = control_group.MatchEmpty();
+      if (empty != 0) {
+        // Empty slot: since there are no deletes, the value isn't further
+        // down the probing sequence
+        const uint64_t index =
+            base + (bit_util::CountTrailingZeros(empty) >> HashTableGroup::kSlotShift);
         return {index, false};
       }
 
-      // Perturbation logic inspired from CPython's set / dict object.
-      // The goal is that all 64 bits of the unmasked hash value eventually
-      // participate in the probing sequence, to minimize clustering.
-      index = (index + perturb) & size_mask;
-      perturb = (perturb >> perturb_shift) + 1U;
-    }
-  }
-
-  template <CompareKind CKind, typename CmpFunc>
-  bool CompareEntry(hash_t h, const Entry* entry, CmpFunc&& cmp_func) const {
-    if (CKind == NoCompare) {
-      return false;
-    } else {
-      return entry->h == h && cmp_func(&entry->payload);
+      // Triangular probing visits all groups when their number is a power of two
+      group = (group + ++step) & group_mask;
     }
   }
 
   bool NeedUpsizing() const {
-    // Keep the load factor <= 1/2
-    return size_ * kLoadFactor >= capacity_;
+    // Keep the load factor < 3/4, group-wise probing copes well with high loads
+    return size_ * 4 >= capacity_ * 3;
   }
 
   Status UpsizeBuffer(uint64_t capacity) {
+    RETURN_NOT_OK(control_builder_.Resize(capacity));
+    control_ = control_builder_.mutable_data();
+    memset(control_, kEmptyControl, capacity);
+
     RETURN_NOT_OK(entries_builder_.Resize(capacity));
     entries_ = entries_builder_.mutable_data();
     memset(static_cast<void*>(entries_), 0, capacity * sizeof(Entry));
@@ -324,42 +384,56 @@ class HashTable {
 
   Status Upsize(uint64_t new_capacity) {
     assert(new_capacity > capacity_);
-    uint64_t new_mask = new_capacity - 1;
-    assert((new_capacity & new_mask) == 0);  // it's a power of two
+    assert((new_capacity & (new_capacity - 1)) == 0);  // it's a power of two
+    const uint64_t new_group_mask = new_capacity / HashTableGroup::kSize - 1;
 
-    // Stash old entries and seal builder, effectively resetting the Buffer
+    // Stash old entries and seal builders, effectively resetting the Buffers
+    const uint8_t* old_control = control_;
     const Entry* old_entries = entries_;
+    ARROW_ASSIGN_OR_RAISE(auto previous_control,
+                          control_builder_.FinishWithLength(capacity_));
     ARROW_ASSIGN_OR_RAISE(auto previous, entries_builder_.FinishWithLength(capacity_));
-    // Allocate new buffer
+    // Allocate new buffers
     RETURN_NOT_OK(UpsizeBuffer(new_capacity));
 
     for (uint64_t i = 0; i < capacity_; i++) {
-      const auto& entry = old_entries[i];
-      if (entry) {
+      if (old_control[i] != kEmptyControl) {
+        const auto& entry = old_entries[i];
         // Dummy compare function will not be called
-        auto p = Lookup<NoCompare>(entry.h, entries_, new_mask,
+        auto p = Lookup<NoCompare>(entry.h, control_, entries_, new_group_mask,
                                    [](const Payload*) { return false; });
-        // Lookup<NoCompare> (and CompareEntry<NoCompare>) ensure that an
-        // empty slots is always returned
+        // Lookup<NoCompare> ensures that an empty slot is always returned
         assert(!p.second);
         entries_[p.first] = entry;
+        control_[p.first] = old_control[i];
       }
     }
     capacity_ = new_capacity;
-    capacity_mask_ = new_mask;
+    group_mask_ = new_group_mask;
 
     return Status::OK();
   }
 
   hash_t FixHash(hash_t h) const { return (h == kSentinel) ? 42U : h; }
 
+  // The 7-bit tag stored in the control byte.  The raw high bits are not usable:
+  // integer hashes are byte-swapped products, whose top byte only depends on the
+  // low byte of the key.  Multiplying by an odd constant carries every bit of the
+  // hash up into the top bits, which the tag is taken from.
+  static uint8_t HashTag(hash_t h) {
+    return static_cast<uint8_t>((h * 0x9E3779B97F4A7C15ULL) >> 57);
+  }
+
   // The number of slots available in the hash table array.
   uint64_t capacity_;
-  uint64_t capacity_mask_;
+  // The number of slot groups minus one
+  uint64_t group_mask_;
   // The number of used slots in the hash table array.
   uint64_t size_;
 
+  uint8_t* control_;
   Entry* entries_;
+  TypedBufferBuilder<uint8_t> control_builder_;
   TypedBufferBuilder<Entry> entries_builder_;
 };
 
@@ -111,6 +111,54 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// Draw `n_values` values from the first `cardinality` ones in `distinct`
+template <typename Value>
+static std::vector<Value> DrawValues(const std::vector<Value>& distinct,
+                                     int64_t cardinality, int32_t n_values) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> index_dist(0, cardinality - 1);
+  std::vector<Value> values(n_values);
+  std::generate(values.begin(), values.end(),
+                [&]() { return distinct[index_dist(gen)]; });
+  return values;
+}
+
+static constexpr int32_t kMemoTableValues = 1 << 20;
+
+static void MemoTableInt64(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t cardinality = state.range(0);
+  const std::vector<int64_t> values = DrawValues(
+      MakeIntegers<int64_t>(static_cast<int32_t>(cardinality)), cardinality,
+      kMemoTableValues);
+
+  for (auto _ : state) {
+    ScalarMemoTable<int64_t> table(default_memory_pool(), 0);
+    int32_t memo_index = 0;
+    for (const int64_t v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(memo_index);
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void MemoTableStrings(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t cardinality = state.range(0);
+  const std::vector<std::string> values = DrawValues(
+      MakeStrings(static_cast<int32_t>(cardinality), 2, 20), cardinality,
+      kMemoTableValues);
+
+  for (auto _ : state) {
+    BinaryMemoTable<BinaryBuilder> table(default_memory_pool(), 0);
+    int32_t memo_index = 0;
+    for (const std::string& v : values) {
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(memo_index);
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +167,8 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+BENCHMARK(MemoTableInt64)->RangeMultiplier(100)->Range(100, 1000000);
+BENCHMARK(MemoTableStrings)->RangeMultiplier(100)->Range(100, 1000000);
+
 }  // namespace internal
 }  // namespace arrow
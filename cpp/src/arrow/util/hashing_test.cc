@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <limits>
@@ -374,6 +375,38 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(HashTable, Collisions) {
+  // Many entries share a probing start, a control tag or even their whole hash
+  // (including the sentinel value), they must all be found again after upsizing
+  HashTable<int32_t> table(default_memory_pool(), 0);
+  const int32_t n_values = 2000;
+  auto hash_of = [](int32_t v) -> hash_t {
+    return (v % 3 == 0) ? 0 : (static_cast<hash_t>(v % 7) << 57) | 0x1000;
+  };
+
+  for (int32_t v = 0; v < n_values; ++v) {
+    auto p = table.Lookup(hash_of(v), [&](const int32_t* other) { return *other == v; });
+    ASSERT_FALSE(p.second);
+    ASSERT_OK(table.Insert(p.first, hash_of(v), v));
+  }
+  ASSERT_EQ(table.size(), static_cast<uint64_t>(n_values));
+
+  for (int32_t v = 0; v < n_values; ++v) {
+    auto p = table.Lookup(hash_of(v), [&](const int32_t* other) { return *other == v; });
+    ASSERT_TRUE(p.second);
+    ASSERT_EQ(p.first->payload, v);
+  }
+  auto p = table.Lookup(hash_of(1), [](const int32_t* other) { return *other == -1; });
+  ASSERT_FALSE(p.second);
+
+  std::vector<bool> visited(n_values, false);
+  table.VisitEntries([&](const HashTable<int32_t>::Entry* entry) {
+    ASSERT_FALSE(visited[entry->payload]);
+    visited[entry->payload] = true;
+  });
+  ASSERT_EQ(std::count(visited.begin(), visited.end(), true), n_values);
+}
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
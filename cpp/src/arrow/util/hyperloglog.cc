@@ -0,0 +1,299 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/hyperloglog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+#include "arrow/status.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Sparse entries are encoded with a precision of 25 bits: the upper bits hold
+// the bucket index at that precision, the lower 6 bits hold the rank of the
+// remaining 39 hash bits (1 to 40).
+constexpr int kSparsePrecision = 25;
+constexpr int kSparseRankBits = 6;
+constexpr uint32_t kSparseRankMask = (1U << kSparseRankBits) - 1;
+
+constexpr uint8_t kSerializationVersion = 1;
+constexpr uint8_t kSparseFormat = 0;
+constexpr uint8_t kDenseFormat = 1;
+constexpr size_t kHeaderSize = 3;
+
+uint32_t SparseIndex(uint32_t entry) { return entry >> kSparseRankBits; }
+uint8_t SparseRank(uint32_t entry) {
+  return static_cast<uint8_t>(entry & kSparseRankMask);
+}
+
+// sigma and tau functions from Ertl's improved raw estimator
+double Sigma(double x) {
+  if (x == 1.0) return std::numeric_limits<double>::infinity();
+  double y = 1.0;
+  double z = x;
+  double z_prev;
+  do {
+    x *= x;
+    z_prev = z;
+    z += x * y;
+    y += y;
+  } while (z != z_prev);
+  return z;
+}
+
+double Tau(double x) {
+  if (x == 0.0 || x == 1.0) return 0.0;
+  double y = 1.0;
+  double z = 1 - x;
+  double z_prev;
+  do {
+    x = std::sqrt(x);
+    z_prev = z;
+    y *= 0.5;
+    z -= (1 - x) * (1 - x) * y;
+  } while (z != z_prev);
+  return z / 3;
+}
+
+}  // namespace
+
+HyperLogLog::HyperLogLog(int precision) : precision_(precision) {
+  DCHECK_GE(precision, kMinPrecision);
+  DCHECK_LE(precision, kMaxPrecision);
+}
+
+void HyperLogLog::Reset() {
+  registers_.clear();
+  registers_.shrink_to_fit();
+  sparse_.clear();
+  sparse_buffer_.clear();
+}
+
+void HyperLogLog::AddSparse(uint64_t hash) {
+  const auto index = static_cast<uint32_t>(hash >> (64 - kSparsePrecision));
+  const uint64_t w = hash << kSparsePrecision;
+  const auto rank = static_cast<uint32_t>(
+      w == 0 ? 65 - kSparsePrecision : bit_util::CountLeadingZeros(w) + 1);
+  sparse_buffer_.push_back((index << kSparseRankBits) | rank);
+  if (sparse_buffer_.size() >= max_sparse_size()) {
+    FlushSparseBuffer();
+    if (sparse_.size() > max_sparse_size()) {
+      ConvertToDense();
+    }
+  }
+}
+
+void HyperLogLog::FlushSparseBuffer() const {
+  if (sparse_buffer_.empty()) return;
+  std::sort(sparse_buffer_.begin(), sparse_buffer_.end());
+  std::vector<uint32_t> merged;
+  merged.reserve(sparse_.size() + sparse_buffer_.size());
+  std::merge(sparse_.begin(), sparse_.end(), sparse_buffer_.begin(),
+             sparse_buffer_.end(), std::back_inserter(merged));
+  sparse_buffer_.clear();
+  // Entries for the same index are now adjacent and sorted by rank,
+  // keep only the last (largest rank) one.
+  size_t out = 0;
+  for (size_t i = 0; i < merged.size(); ++i) {
+    if (i + 1 < merged.size() && SparseIndex(merged[i]) == SparseIndex(merged[i + 1])) {
+      continue;
+    }
+    merged[out++] = merged[i];
+  }
+  merged.resize(out);
+  sparse_ = std::move(merged);
+}
+
+void HyperLogLog::MergeSparseEntry(uint32_t entry) {
+  const int shift = kSparsePrecision - precision_;
+  const uint32_t sparse_index = SparseIndex(entry);
+  const uint32_t index = sparse_index >> shift;
+  const uint32_t low_bits = sparse_index & ((1U << shift) - 1);
+  // The bits between the dense and the sparse precision are the first bits
+  // considered by the rank at the dense precision
+  const auto rank = static_cast<uint8_t>(
+      low_bits != 0 ? bit_util::CountLeadingZeros(low_bits) - (32 - shift) + 1
+                    : shift + SparseRank(entry));
+  if (registers_[index] < rank) {
+    registers_[index] = rank;
+  }
+}
+
+void HyperLogLog::ConvertToDense() {
+  FlushSparseBuffer();
+  registers_.assign(size_t{1} << precision_, 0);
+  for (uint32_t entry : sparse_) {
+    MergeSparseEntry(entry);
+  }
+  sparse_.clear();
+  sparse_.shrink_to_fit();
+  sparse_buffer_.clear();
+  sparse_buffer_.shrink_to_fit();
+}
+
+Status HyperLogLog::Merge(const HyperLogLog& other) {
+  if (precision_ != other.precision_) {
+    return Status::Invalid("Cannot merge HyperLogLog sketches of different precisions (",
+                           precision_, " and ", other.precision_, ")");
+  }
+  if (other.is_sparse()) {
+    if (is_sparse()) {
+      sparse_buffer_.insert(sparse_buffer_.end(), other.sparse_.begin(),
+                            other.sparse_.end());
+      sparse_buffer_.insert(sparse_buffer_.end(), other.sparse_buffer_.begin(),
+                            other.sparse_buffer_.end());
+      FlushSparseBuffer();
+      if (sparse_.size() > max_sparse_size()) {
+        ConvertToDense();
+      }
+    } else {
+      for (uint32_t entry : other.sparse_) {
+        MergeSparseEntry(entry);
+      }
+      for (uint32_t entry : other.sparse_buffer_) {
+        MergeSparseEntry(entry);
+      }
+    }
+    return Status::OK();
+  }
+  if (is_sparse()) {
+    ConvertToDense();
+  }
+  for (size_t i = 0; i < registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+  return Status::OK();
+}
+
+double HyperLogLog::Estimate() const {
+  if (is_sparse()) {
+    // Linear counting at the sparse precision, which is very accurate for the
+    // cardinalities the sparse representation is used for
+    FlushSparseBuffer();
+    const double m = static_cast<double>(uint64_t{1} << kSparsePrecision);
+    const double empty = m - static_cast<double>(sparse_.size());
+    return m * std::log(m / empty);
+  }
+
+  const int q = 64 - precision_;
+  const double m = static_cast<double>(registers_.size());
+  std::vector<int64_t> histogram(q + 2, 0);
+  for (uint8_t reg : registers_) {
+    ++histogram[reg];
+  }
+  double z = m * Tau(1 - histogram[q + 1] / m);
+  for (int k = q; k >= 1; --k) {
+    z = 0.5 * (z + histogram[k]);
+  }
+  z += m * Sigma(histogram[0] / m);
+  constexpr double kAlphaInf = 0.7213475204444817;  // 1 / (2 ln 2)
+  return kAlphaInf * m * m / z;
+}
+
+std::string HyperLogLog::Serialize() const {
+  std::string out;
+  out.push_back(static_cast<char>(kSerializationVersion));
+  out.push_back(static_cast<char>(precision_));
+  if (is_sparse()) {
+    FlushSparseBuffer();
+    out.push_back(static_cast<char>(kSparseFormat));
+    const auto count = bit_util::ToLittleEndian(static_cast<uint32_t>(sparse_.size()));
+    out.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (uint32_t entry : sparse_) {
+      const auto le_entry = bit_util::ToLittleEndian(entry);
+      out.append(reinterpret_cast<const char*>(&le_entry), sizeof(le_entry));
+    }
+  } else {
+    out.push_back(static_cast<char>(kDenseFormat));
+    out.append(reinterpret_cast<const char*>(registers_.data()), registers_.size());
+  }
+  return out;
+}
+
+Result<HyperLogLog> HyperLogLog::Deserialize(std::string_view data) {
+  if (data.size() < kHeaderSize) {
+    return Status::Invalid("Serialized HyperLogLog sketch is truncated");
+  }
+  const auto version = static_cast<uint8_t>(data[0]);
+  const auto precision = static_cast<uint8_t>(data[1]);
+  const auto format = static_cast<uint8_t>(data[2]);
+  if (version != kSerializationVersion) {
+    return Status::Invalid("Unsupported HyperLogLog serialization version: ",
+                           static_cast<int>(version));
+  }
+  if (precision < kMinPrecision || precision > kMaxPrecision) {
+    return Status::Invalid("Invalid HyperLogLog precision: ",
+                           static_cast<int>(precision));
+  }
+  HyperLogLog hll(precision);
+  data.remove_prefix(kHeaderSize);
+
+  if (format == kSparseFormat) {
+    if (data.size() < sizeof(uint32_t)) {
+      return Status::Invalid("Serialized HyperLogLog sketch is truncated");
+    }
+    const uint32_t count = bit_util::FromLittleEndian(
+        util::SafeLoadAs<uint32_t>(reinterpret_cast<const uint8_t*>(data.data())));
+    data.remove_prefix(sizeof(uint32_t));
+    if (data.size() != count * sizeof(uint32_t) || count > (1U << kSparsePrecision)) {
+      return Status::Invalid("Invalid serialized HyperLogLog sparse representation");
+    }
+    hll.sparse_.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+      const uint32_t entry = bit_util::FromLittleEndian(util::SafeLoadAs<uint32_t>(
+          reinterpret_cast<const uint8_t*>(data.data()) + i * sizeof(uint32_t)));
+      const uint8_t rank = SparseRank(entry);
+      if (rank == 0 || rank > 65 - kSparsePrecision ||
+          SparseIndex(entry) >= (1U << kSparsePrecision) ||
+          (i > 0 && SparseIndex(entry) <= SparseIndex(hll.sparse_[i - 1]))) {
+        return Status::Invalid("Invalid serialized HyperLogLog sparse representation");
+      }
+      hll.sparse_[i] = entry;
+    }
+    if (hll.sparse_.size() > hll.max_sparse_size()) {
+      hll.ConvertToDense();
+    }
+  } else if (format == kDenseFormat) {
+    const size_t num_registers = size_t{1} << precision;
+    if (data.size() != num_registers) {
+      return Status::Invalid("Invalid serialized HyperLogLog dense representation");
+    }
+    hll.registers_.assign(data.begin(), data.end());
+    for (uint8_t reg : hll.registers_) {
+      if (reg > 65 - precision) {
+        return Status::Invalid("Invalid serialized HyperLogLog dense representation");
+      }
+    }
+  } else {
+    return Status::Invalid("Unknown HyperLogLog representation: ",
+                           static_cast<int>(format));
+  }
+  return std::move(hll);
+}
+
+}  // namespace internal
+}  // namespace arrow
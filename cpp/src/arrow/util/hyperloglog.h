@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// approximate distinct counting with O(2^precision) space
+// based on 'HyperLogLog in Practice' from Heule, Nunkesser & Hall (HyperLogLog++)
+// - https://research.google/pubs/pub40671/
+// the bias correction tables of HyperLogLog++ are replaced by the table-free
+// estimator from 'New cardinality estimation algorithms for HyperLogLog sketches'
+// from Ertl
+// - https://arxiv.org/abs/1702.01284
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Status;
+
+namespace internal {
+
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+  static constexpr int kDefaultPrecision = 14;
+
+  // precision must be within [kMinPrecision, kMaxPrecision], the relative
+  // standard error of the estimate is about 1.04 / sqrt(2^precision)
+  explicit HyperLogLog(int precision = kDefaultPrecision);
+
+  // reset and re-use this sketch
+  void Reset();
+
+  int precision() const { return precision_; }
+
+  // whether the sketch still uses the sparse (small cardinality) representation
+  bool is_sparse() const { return registers_.empty(); }
+
+  // add a 64-bit hash of a value, this function is intensively called and
+  // performance critical
+  // the hash must be uniformly distributed over all 64 bits, see MixHash()
+  void Add(uint64_t hash) {
+    if (ARROW_PREDICT_TRUE(!registers_.empty())) {
+      const uint64_t index = hash >> (64 - precision_);
+      const uint64_t w = hash << precision_;
+      const uint8_t rho = static_cast<uint8_t>(
+          w == 0 ? 65 - precision_ : bit_util::CountLeadingZeros(w) + 1);
+      if (registers_[index] < rho) {
+        registers_[index] = rho;
+      }
+      return;
+    }
+    AddSparse(hash);
+  }
+
+  // finalize a hash with a good avalanche behaviour (MurmurHash3 fmix64), useful
+  // to feed hashes of weaker quality to the sketch
+  static uint64_t MixHash(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  // merge with another sketch, both sketches must have the same precision
+  Status Merge(const HyperLogLog& other);
+
+  // estimate the number of distinct hashes added to the sketch
+  double Estimate() const;
+
+  // serialize to a portable binary representation, suitable to merge partial
+  // sketches computed on different processes or machines
+  std::string Serialize() const;
+
+  // reconstruct a sketch from the output of Serialize()
+  static Result<HyperLogLog> Deserialize(std::string_view data);
+
+ private:
+  void AddSparse(uint64_t hash);
+  // sort the pending sparse entries and merge them into the sorted sparse list
+  void FlushSparseBuffer() const;
+  void ConvertToDense();
+  void MergeSparseEntry(uint32_t entry);
+  size_t max_sparse_size() const { return (size_t{1} << precision_) / 4; }
+
+  int precision_;
+  // dense representation: one register per bucket, holding the maximum rank seen
+  std::vector<uint8_t> registers_;
+  // sparse representation: sorted, deduplicated entries encoded with a higher
+  // precision, plus a buffer of not yet merged entries
+  mutable std::vector<uint32_t> sparse_;
+  mutable std::vector<uint32_t> sparse_buffer_;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/hyperloglog.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+void AddRange(HyperLogLog* hll, uint64_t begin, uint64_t end) {
+  for (uint64_t i = begin; i < end; ++i) {
+    hll->Add(HyperLogLog::MixHash(i));
+  }
+}
+
+// The relative standard error is 1.04 / sqrt(m), allow for 4 standard errors
+void AssertEstimateNear(const HyperLogLog& hll, double expected) {
+  const double error = 4 * 1.04 / std::sqrt(static_cast<double>(1 << hll.precision()));
+  ASSERT_NEAR(hll.Estimate(), expected, std::max(1.0, expected * error));
+}
+
+}  // namespace
+
+TEST(HyperLogLogTest, Empty) {
+  HyperLogLog hll;
+  ASSERT_TRUE(hll.is_sparse());
+  ASSERT_EQ(hll.Estimate(), 0);
+}
+
+TEST(HyperLogLogTest, SmallCardinalityIsNearExact) {
+  HyperLogLog hll;
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    AddRange(&hll, 0, 1000);
+  }
+  ASSERT_TRUE(hll.is_sparse());
+  ASSERT_EQ(std::llround(hll.Estimate()), 1000);
+}
+
+TEST(HyperLogLogTest, LargeCardinality) {
+  for (int precision : {HyperLogLog::kMinPrecision, 10, HyperLogLog::kDefaultPrecision,
+                        HyperLogLog::kMaxPrecision}) {
+    ARROW_SCOPED_TRACE("precision = ", precision);
+    HyperLogLog hll(precision);
+    for (uint64_t n : {100, 10000, 1000000}) {
+      AddRange(&hll, 0, n);
+      AssertEstimateNear(hll, static_cast<double>(n));
+    }
+    ASSERT_FALSE(hll.is_sparse());
+  }
+}
+
+TEST(HyperLogLogTest, Merge) {
+  for (uint64_t n : {100, 300000}) {
+    ARROW_SCOPED_TRACE("n = ", n);
+    HyperLogLog left, right, sparse;
+    AddRange(&left, 0, n);
+    AddRange(&right, n / 2, n + n / 2);
+    AddRange(&sparse, 0, 10);
+    ASSERT_OK(left.Merge(right));
+    AssertEstimateNear(left, static_cast<double>(n + n / 2));
+    ASSERT_OK(left.Merge(sparse));
+    AssertEstimateNear(left, static_cast<double>(n + n / 2));
+    ASSERT_OK(sparse.Merge(left));
+    AssertEstimateNear(sparse, static_cast<double>(n + n / 2));
+  }
+
+  HyperLogLog other_precision(10);
+  HyperLogLog hll;
+  ASSERT_RAISES(Invalid, hll.Merge(other_precision));
+}
+
+TEST(HyperLogLogTest, MergeIsOrderIndependent) {
+  HyperLogLog all, parts[4];
+  AddRange(&all, 0, 100000);
+  for (int i = 0; i < 4; ++i) {
+    AddRange(&parts[i], i * 25000, (i + 1) * 25000);
+  }
+  HyperLogLog merged;
+  for (const auto& part : parts) {
+    ASSERT_OK(merged.Merge(part));
+  }
+  ASSERT_EQ(merged.Estimate(), all.Estimate());
+}
+
+TEST(HyperLogLogTest, SerializeRoundtrip) {
+  for (uint64_t n : {0, 50, 1000000}) {
+    ARROW_SCOPED_TRACE("n = ", n);
+    HyperLogLog hll(12);
+    AddRange(&hll, 0, n);
+    const std::string serialized = hll.Serialize();
+    ASSERT_OK_AND_ASSIGN(auto roundtripped, HyperLogLog::Deserialize(serialized));
+    ASSERT_EQ(roundtripped.precision(), 12);
+    ASSERT_EQ(roundtripped.is_sparse(), hll.is_sparse());
+    ASSERT_EQ(roundtripped.Estimate(), hll.Estimate());
+    ASSERT_EQ(roundtripped.Serialize(), serialized);
+
+    // Deserialized sketches can be merged and updated further
+    ASSERT_OK(roundtripped.Merge(hll));
+    ASSERT_EQ(roundtripped.Estimate(), hll.Estimate());
+  }
+}
+
+TEST(HyperLogLogTest, DeserializeInvalid) {
+  HyperLogLog hll;
+  AddRange(&hll, 0, 10);
+  const std::string sparse = hll.Serialize();
+  AddRange(&hll, 0, 100000);
+  const std::string dense = hll.Serialize();
+
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(""));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(sparse.substr(0, sparse.size() - 1)));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(dense.substr(0, dense.size() - 1)));
+
+  std::string bad_version = dense;
+  bad_version[0] = 42;
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(bad_version));
+  std::string bad_precision = dense;
+  bad_precision[1] = 30;
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(bad_precision));
+  std::string bad_register = dense;
+  bad_register.back() = 100;
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(bad_register));
+  // The high bits of the last (little-endian) sparse entry are set, so that its
+  // index is out of range
+  std::string bad_sparse_index = sparse;
+  bad_sparse_index.back() = static_cast<char>(0xff);
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(bad_sparse_index));
+}
+
+}  // namespace internal
+}  // namespace arrow
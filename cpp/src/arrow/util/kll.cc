@@ -0,0 +1,180 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/kll.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// capacity decay ratio between adjacent levels
+constexpr double kCapacityDecay = 2.0 / 3.0;
+// fixed seed, so that results are reproducible
+constexpr uint64_t kRandomSeed = 0x9E3779B97F4A7C15ULL;
+
+}  // namespace
+
+KllSketch::KllSketch(uint32_t k) : k_(k) {
+  DCHECK_GE(k, 2);
+  Reset();
+}
+
+void KllSketch::Reset() {
+  compactors_.clear();
+  size_ = 0;
+  max_size_ = 0;
+  count_ = 0;
+  min_ = max_ = 0;
+  random_state_ = kRandomSeed;
+  Grow();
+}
+
+uint32_t KllSketch::Capacity(size_t level) const {
+  const auto depth = static_cast<double>(compactors_.size() - level - 1);
+  return static_cast<uint32_t>(std::ceil(std::pow(kCapacityDecay, depth) * k_)) + 1;
+}
+
+void KllSketch::Grow() {
+  compactors_.emplace_back();
+  UpdateMaxSize();
+}
+
+void KllSketch::UpdateMaxSize() {
+  max_size_ = 0;
+  for (size_t h = 0; h < compactors_.size(); ++h) {
+    max_size_ += Capacity(h);
+  }
+}
+
+// splitmix64
+bool KllSketch::NextRandomBit() {
+  uint64_t z = (random_state_ += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return ((z ^ (z >> 31)) >> 63) != 0;
+}
+
+void KllSketch::Compress() {
+  for (size_t h = 0; h < compactors_.size(); ++h) {
+    if (compactors_[h].size() < Capacity(h)) {
+      continue;
+    }
+    if (h + 1 >= compactors_.size()) {
+      Grow();
+    }
+    // sort the level and promote every other data point to the next level,
+    // starting at a random offset, the weight of each promoted point doubles
+    std::vector<double>& level = compactors_[h];
+    std::vector<double>& next = compactors_[h + 1];
+    std::sort(level.begin(), level.end());
+    // with an odd number of data points, the smallest one stays at this level
+    const size_t start = level.size() & 1;
+    for (size_t i = start + (NextRandomBit() ? 1 : 0); i < level.size(); i += 2) {
+      next.push_back(level[i]);
+    }
+    level.resize(start);
+
+    size_ = 0;
+    for (const auto& compactor : compactors_) {
+      size_ += compactor.size();
+    }
+    // compact lazily: one level at a time is enough to free room
+    break;
+  }
+}
+
+void KllSketch::Merge(const KllSketch& other) {
+  if (other.is_empty()) {
+    return;
+  }
+  if (is_empty()) {
+    min_ = other.min_;
+    max_ = other.max_;
+  } else {
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+  }
+  count_ += other.count_;
+
+  if (other.k_ < k_) {
+    k_ = other.k_;
+  }
+  while (compactors_.size() < other.compactors_.size()) {
+    Grow();
+  }
+  UpdateMaxSize();
+
+  for (size_t h = 0; h < other.compactors_.size(); ++h) {
+    compactors_[h].insert(compactors_[h].end(), other.compactors_[h].begin(),
+                          other.compactors_[h].end());
+  }
+  size_ += other.size_;
+  while (size_ >= max_size_) {
+    Compress();
+  }
+}
+
+double KllSketch::Quantile(double q) const { return Quantiles({q})[0]; }
+
+std::vector<double> KllSketch::Quantiles(const std::vector<double>& q) const {
+  std::vector<double> result(q.size(), NAN);
+  if (is_empty()) {
+    return result;
+  }
+
+  // all retained data points with their weight, sorted by value
+  std::vector<std::pair<double, uint64_t>> points;
+  points.reserve(size_);
+  for (size_t h = 0; h < compactors_.size(); ++h) {
+    for (double value : compactors_[h]) {
+      points.emplace_back(value, uint64_t{1} << h);
+    }
+  }
+  std::sort(points.begin(), points.end());
+  uint64_t total_weight = 0;
+  for (auto& point : points) {
+    total_weight += point.second;
+    point.second = total_weight;
+  }
+
+  for (size_t i = 0; i < q.size(); ++i) {
+    if (q[i] <= 0) {
+      result[i] = min_;
+    } else if (q[i] >= 1) {
+      result[i] = max_;
+    } else {
+      // first data point whose cumulative weight reaches the requested rank
+      const double rank = q[i] * static_cast<double>(total_weight);
+      auto it = std::lower_bound(
+          points.begin(), points.end(), rank,
+          [](const std::pair<double, uint64_t>& point, double rank) {
+            return static_cast<double>(point.second) < rank;
+          });
+      result[i] = it == points.end() ? max_ : it->first;
+    }
+  }
+  return result;
+}
+
+}  // namespace internal
+}  // namespace arrow
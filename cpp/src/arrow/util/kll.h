@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// approximate quantiles with bounded memory and a rank error guarantee
+// based on 'Optimal Quantile Approximation in Streams' from Karnin, Lang & Liberty
+// - https://arxiv.org/abs/1603.05346
+// - https://github.com/edoliberty/streaming-quantiles
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+class ARROW_EXPORT KllSketch {
+ public:
+  // k controls the accuracy: the normalized rank error is about 1.7 / k,
+  // and the sketch retains O(k) values regardless of the input size
+  explicit KllSketch(uint32_t k = 200);
+
+  // reset and re-use this sketch
+  void Reset();
+
+  uint32_t k() const { return k_; }
+
+  // add a single data point, compact the sketch if it is full
+  // this function is intensively called and performance critical
+  // call it only if you are sure no NAN exists in input data
+  void Add(double value) {
+    DCHECK(!std::isnan(value)) << "cannot add NAN";
+    if (ARROW_PREDICT_FALSE(count_ == 0 || value < min_)) min_ = value;
+    if (ARROW_PREDICT_FALSE(count_ == 0 || value > max_)) max_ = value;
+    ++count_;
+    compactors_[0].push_back(value);
+    if (ARROW_PREDICT_FALSE(++size_ >= max_size_)) {
+      Compress();
+    }
+  }
+
+  // skip NAN on adding
+  template <typename T>
+  typename std::enable_if<std::is_floating_point<T>::value>::type NanAdd(T value) {
+    if (!std::isnan(value)) Add(value);
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value>::type NanAdd(T value) {
+    Add(static_cast<double>(value));
+  }
+
+  // merge with another sketch, the result has the accuracy of the smallest k
+  void Merge(const KllSketch& other);
+
+  // calculate quantile, the result is one of the added data points
+  double Quantile(double q) const;
+
+  // calculate several quantiles at once, cheaper than repeated Quantile() calls
+  std::vector<double> Quantiles(const std::vector<double>& q) const;
+
+  double Min() const { return min_; }
+  double Max() const { return max_; }
+
+  // number of data points added to the sketch (including merged sketches)
+  uint64_t count() const { return count_; }
+
+  // number of data points retained by the sketch
+  uint64_t num_retained() const { return size_; }
+
+  // check if this sketch contains no valid data points
+  bool is_empty() const { return count_ == 0; }
+
+ private:
+  // capacity of the compactor at the given level, lower levels have
+  // geometrically smaller capacities
+  uint32_t Capacity(size_t level) const;
+  void Grow();
+  void UpdateMaxSize();
+  void Compress();
+  bool NextRandomBit();
+
+  uint32_t k_;
+  // compactors_[h] holds data points of weight 2^h
+  std::vector<std::vector<double>> compactors_;
+  uint64_t size_;
+  uint64_t max_size_;
+  uint64_t count_;
+  double min_;
+  double max_;
+  // state of the (deterministic) generator choosing which half a compaction keeps
+  uint64_t random_state_;
+};
+
+}  // namespace internal
+}  // namespace arrow
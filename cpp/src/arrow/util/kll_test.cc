@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/kll.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+const std::vector<double> kQuantiles = {0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1};
+
+// Values are a permutation of [0, n), so the rank of a value is the value itself
+std::vector<double> ShuffledRange(int64_t n, uint32_t seed) {
+  std::vector<double> values(n);
+  std::iota(values.begin(), values.end(), 0.0);
+  std::shuffle(values.begin(), values.end(), std::default_random_engine(seed));
+  return values;
+}
+
+void AssertRankErrorWithin(const KllSketch& sketch, int64_t n, double max_error) {
+  for (double q : kQuantiles) {
+    ARROW_SCOPED_TRACE("q = ", q);
+    const double expected_rank = q * (n - 1);
+    ASSERT_NEAR(sketch.Quantile(q), expected_rank, max_error * n);
+  }
+}
+
+}  // namespace
+
+TEST(KllSketchTest, Empty) {
+  KllSketch sketch;
+  ASSERT_TRUE(sketch.is_empty());
+  ASSERT_EQ(sketch.count(), 0);
+  ASSERT_TRUE(std::isnan(sketch.Quantile(0.5)));
+}
+
+TEST(KllSketchTest, SmallInputIsExact) {
+  KllSketch sketch;
+  for (double value : ShuffledRange(101, 42)) {
+    sketch.Add(value);
+  }
+  ASSERT_EQ(sketch.count(), 101);
+  ASSERT_EQ(sketch.num_retained(), 101);
+  ASSERT_EQ(sketch.Min(), 0);
+  ASSERT_EQ(sketch.Max(), 100);
+  ASSERT_EQ(sketch.Quantile(0.5), 50);
+  ASSERT_EQ(sketch.Quantile(0.9), 90);
+  ASSERT_EQ(sketch.Quantiles({0, 0.25, 1}), std::vector<double>({0, 25, 100}));
+}
+
+TEST(KllSketchTest, BoundedMemoryAndError) {
+  const int64_t n = 1000000;
+  for (uint32_t k : {50, 200, 1000}) {
+    ARROW_SCOPED_TRACE("k = ", k);
+    KllSketch sketch(k);
+    for (double value : ShuffledRange(n, k)) {
+      sketch.Add(value);
+    }
+    ASSERT_EQ(sketch.count(), n);
+    ASSERT_LT(sketch.num_retained(), 4 * k);
+    ASSERT_EQ(sketch.Min(), 0);
+    ASSERT_EQ(sketch.Max(), n - 1);
+    // allow for twice the expected normalized rank error
+    AssertRankErrorWithin(sketch, n, 2 * 1.7 / k);
+  }
+}
+
+TEST(KllSketchTest, SortedInput) {
+  const int64_t n = 300000;
+  KllSketch sketch;
+  for (int64_t i = 0; i < n; ++i) {
+    sketch.Add(static_cast<double>(i));
+  }
+  AssertRankErrorWithin(sketch, n, 2 * 1.7 / sketch.k());
+}
+
+TEST(KllSketchTest, Merge) {
+  const int64_t n = 500000;
+  const auto values = ShuffledRange(n, 7);
+  std::vector<KllSketch> parts(8);
+  for (int64_t i = 0; i < n; ++i) {
+    parts[i % parts.size()].Add(values[i]);
+  }
+  KllSketch merged;
+  for (const auto& part : parts) {
+    merged.Merge(part);
+  }
+  merged.Merge(KllSketch());
+  ASSERT_EQ(merged.count(), n);
+  ASSERT_LT(merged.num_retained(), 4 * merged.k());
+  AssertRankErrorWithin(merged, n, 2 * 1.7 / merged.k());
+
+  // merging a sketch with a smaller k degrades the accuracy accordingly
+  KllSketch coarse(50);
+  coarse.Add(1);
+  merged.Merge(coarse);
+  ASSERT_EQ(merged.k(), 50);
+  ASSERT_EQ(merged.count(), n + 1);
+}
+
+TEST(KllSketchTest, NanAdd) {
+  KllSketch sketch;
+  sketch.NanAdd(NAN);
+  sketch.NanAdd(1.5f);
+  sketch.NanAdd(int64_t{3});
+  ASSERT_EQ(sketch.count(), 2);
+  ASSERT_EQ(sketch.Quantile(0), 1.5);
+  ASSERT_EQ(sketch.Quantile(1), 3);
+}
+
+TEST(KllSketchTest, Reset) {
+  KllSketch sketch(100);
+  for (double value : ShuffledRange(10000, 1)) {
+    sketch.Add(value);
+  }
+  sketch.Reset();
+  ASSERT_TRUE(sketch.is_empty());
+  ASSERT_EQ(sketch.num_retained(), 0);
+  sketch.Add(7);
+  ASSERT_EQ(sketch.Quantile(0.5), 7);
+}
+
+}  // namespace internal
+}  // namespace arrow
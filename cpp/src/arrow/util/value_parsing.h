@@ -32,8 +32,10 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/util/visibility.h"
 #include "arrow/vendored/datetime.h"
 #include "arrow/vendored/strptime.h"
@@ -167,6 +169,58 @@ struct StringConverter<DoubleType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+#if ARROW_LITTLE_ENDIAN
+
+// SWAR (SIMD within a register) helpers parsing 8 ASCII digits at once,
+// the first character being in the lowest byte.
+//
+// See "Fast numeric string to int" from Kholdstare and the simdjson number parser:
+// - https://kholdstare.github.io/technical/2020/05/26/faster-integer-parsing.html
+// - https://github.com/simdjson/simdjson/blob/master/include/simdjson/generic/numberparsing.h
+
+// Whether all the bytes of `chunk` are ASCII decimal digits
+inline bool IsEightDigits(uint64_t chunk) {
+  return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// The value of the 8 ASCII decimal digits in `chunk`
+inline uint32_t ParseEightDigits(uint64_t chunk) {
+  constexpr uint64_t kMask = 0x000000FF000000FFULL;
+  constexpr uint64_t kMul1 = 100 + (1000000ULL << 32);
+  constexpr uint64_t kMul2 = 1 + (10000ULL << 32);
+  chunk -= 0x3030303030303030ULL;
+  // Combine adjacent digits into 2-digit numbers, in every other byte
+  chunk = (chunk * 10) + (chunk >> 8);
+  // Combine the 2-digit numbers into 4-digit numbers, then into the result
+  return static_cast<uint32_t>(
+      (((chunk & kMask) * kMul1) + (((chunk >> 16) & kMask) * kMul2)) >> 32);
+}
+
+// Parse digits 8 at a time, the caller ensures that the result cannot overflow
+inline bool ParseUnsignedSwar(const char* s, size_t length, uint64_t* out) {
+  uint64_t result = 0;
+  for (; length >= 8; s += 8, length -= 8) {
+    const auto chunk = util::SafeLoadAs<uint64_t>(reinterpret_cast<const uint8_t*>(s));
+    if (ARROW_PREDICT_FALSE(!IsEightDigits(chunk))) {
+      return false;
+    }
+    result = result * 100000000U + ParseEightDigits(chunk);
+  }
+  for (; length > 0; --length) {
+    const uint8_t digit = ParseDecimalDigit(*s++);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  *out = result;
+  return true;
+}
+
+#endif
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -231,6 +285,17 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+#if ARROW_LITTLE_ENDIAN
+  // Up to 9 digits cannot overflow
+  if (length >= 8 && length <= 9) {
+    uint64_t result = 0;
+    if (ARROW_PREDICT_FALSE(!ParseUnsignedSwar(s, length, &result))) {
+      return false;
+    }
+    *out = static_cast<uint32_t>(result);
+    return true;
+  }
+#endif
   uint32_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -251,6 +316,12 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+#if ARROW_LITTLE_ENDIAN
+  // Up to 19 digits cannot overflow
+  if (length >= 8 && length <= 19) {
+    return ParseUnsignedSwar(s, length, out);
+  }
+#endif
   uint64_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -451,6 +522,21 @@ static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
   if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
     return false;
   }
+#if ARROW_LITTLE_ENDIAN
+  // Gather the digits as "YYYYMMDD" and parse them at once
+  const auto* bytes = reinterpret_cast<const uint8_t*>(s);
+  const uint64_t chunk =
+      static_cast<uint64_t>(util::SafeLoadAs<uint32_t>(bytes)) |
+      (static_cast<uint64_t>(util::SafeLoadAs<uint16_t>(bytes + 5)) << 32) |
+      (static_cast<uint64_t>(util::SafeLoadAs<uint16_t>(bytes + 8)) << 48);
+  if (ARROW_PREDICT_FALSE(!IsEightDigits(chunk))) {
+    return false;
+  }
+  const uint32_t yyyymmdd = ParseEightDigits(chunk);
+  year = static_cast<uint16_t>(yyyymmdd / 10000);
+  month = static_cast<uint8_t>(yyyymmdd / 100 % 100);
+  day = static_cast<uint8_t>(yyyymmdd % 100);
+#else
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
     return false;
   }
@@ -460,6 +546,7 @@ static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
     return false;
   }
+#endif
   arrow_vendored::date::year_month_day ymd{arrow_vendored::date::year{year},
                                            arrow_vendored::date::month{month},
                                            arrow_vendored::date::day{day}};
@@ -536,6 +623,20 @@ static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
   if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
     return false;
   }
+#if ARROW_LITTLE_ENDIAN
+  // Gather the digits as "00hhmmss" and parse them at once
+  const auto chunk = util::SafeLoadAs<uint64_t>(reinterpret_cast<const uint8_t*>(s));
+  const uint64_t digits = 0x3030ULL | ((chunk & 0xFFFFULL) << 16) |
+                          ((chunk & 0xFFFF000000ULL) << 8) |
+                          (chunk & 0xFFFF000000000000ULL);
+  if (ARROW_PREDICT_FALSE(!IsEightDigits(digits))) {
+    return false;
+  }
+  const uint32_t hhmmss = ParseEightDigits(digits);
+  hours = static_cast<uint8_t>(hhmmss / 10000);
+  minutes = static_cast<uint8_t>(hhmmss / 100 % 100);
+  seconds = static_cast<uint8_t>(hhmmss % 100);
+#else
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
     return false;
   }
@@ -545,6 +646,7 @@ static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
     return false;
   }
+#endif
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
     return false;
   }
@@ -56,6 +56,27 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   return strings;
 }
 
+// Integers with many digits, such as identifiers or epoch timestamps
+template <typename c_int>
+static std::vector<std::string> MakeLongIntStrings(int32_t num_items) {
+  using c_int_limits = std::numeric_limits<c_int>;
+  std::vector<std::string> base_strings = {"12345678",
+                                           "987654321",
+                                           "1542129070",
+                                           c_int_limits::is_signed ? "-1542129070" : "42",
+                                           std::to_string(c_int_limits::min()),
+                                           std::to_string(c_int_limits::max())};
+  if (sizeof(c_int) == 8) {
+    base_strings.push_back("1542129070123456");
+    base_strings.push_back("1542129070123456789");
+  }
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 template <typename c_int>
 static std::vector<std::string> MakeHexStrings(int32_t num_items) {
   int32_t num_bytes = sizeof(c_int);
@@ -143,6 +164,25 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void LongIntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakeLongIntStrings<C_TYPE>(1000);
+
+  while (state.KeepRunning()) {
+    C_TYPE total = 0;
+    for (const auto& s : strings) {
+      C_TYPE value;
+      if (!ParseValue<ARROW_TYPE>(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total = static_cast<C_TYPE>(total + value);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
 static void HexParsing(benchmark::State& state) {  // NOLINT non-const reference
   auto strings = MakeHexStrings<C_TYPE>(1000);
@@ -269,6 +309,11 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int32Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, Int64Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt32Type);
+BENCHMARK_TEMPLATE(LongIntegerParsing, UInt64Type);
+
 BENCHMARK_TEMPLATE(HexParsing, Int8Type);
 BENCHMARK_TEMPLATE(HexParsing, Int16Type);
 BENCHMARK_TEMPLATE(HexParsing, Int32Type);
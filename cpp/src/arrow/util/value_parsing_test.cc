@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cmath>
+#include <limits>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -371,6 +372,43 @@ TEST(StringConversion, ToInt64) {
   AssertConversionFails<Int64Type>("0x23512ak");
 }
 
+TEST(StringConversion, ToIntegerManyDigits) {
+  // Numbers of 8 digits or more are parsed eight digits at a time
+  const std::string digits = "1234567890123456789";
+  uint64_t expected = 0;
+  for (size_t length = 1; length <= digits.size(); ++length) {
+    expected = expected * 10 + (digits[length - 1] - '0');
+    const std::string s = digits.substr(0, length);
+    ARROW_SCOPED_TRACE("s = ", s);
+    AssertConversion<UInt64Type>(s, expected);
+    AssertConversion<Int64Type>(s, static_cast<int64_t>(expected));
+    AssertConversion<Int64Type>("-" + s, -static_cast<int64_t>(expected));
+    if (expected <= std::numeric_limits<uint32_t>::max()) {
+      AssertConversion<UInt32Type>(s, static_cast<uint32_t>(expected));
+    } else {
+      AssertConversionFails<UInt32Type>(s);
+    }
+
+    // A non-digit anywhere makes the conversion fail, including characters
+    // adjacent to '0' and '9' in ASCII
+    for (size_t pos = 0; pos < length; ++pos) {
+      for (char c : {'/', ':', 'a', ' ', '\0'}) {
+        std::string invalid = s;
+        invalid[pos] = c;
+        ARROW_SCOPED_TRACE("invalid = ", invalid);
+        AssertConversionFails<UInt64Type>(invalid);
+        AssertConversionFails<Int64Type>(invalid);
+        AssertConversionFails<UInt32Type>(invalid);
+      }
+    }
+  }
+
+  AssertConversion<UInt64Type>("99999999", 99999999);
+  AssertConversion<UInt64Type>("9999999999999999999", 9999999999999999999ULL);
+  AssertConversion<UInt64Type>("00000000000000000001", 1);
+  AssertConversion<UInt32Type>("000000004294967295", 4294967295U);
+}
+
 TEST(StringConversion, ToUInt64) {
   AssertConversion<UInt64Type>("0", 0);
   AssertConversion<UInt64Type>("18446744073709551615", 18446744073709551615ULL);
@@ -410,6 +448,16 @@ TEST(StringConversion, ToDate32) {
   AssertConversionFails<Date32Type>("1970-01");
   AssertConversionFails<Date32Type>("1970-01-01 00:00:00");
   AssertConversionFails<Date32Type>("1970/01/01");
+
+  // Non-digits in digit positions
+  for (size_t pos : {0, 3, 5, 6, 8, 9}) {
+    for (char c : {'/', ':', 'x'}) {
+      std::string s = "2020-03-15";
+      s[pos] = c;
+      ARROW_SCOPED_TRACE("s = ", s);
+      AssertConversionFails<Date32Type>(s);
+    }
+  }
 }
 
 TEST(StringConversion, ToDate64) {
@@ -431,6 +479,14 @@ void AssertInvalidTimes(const T& type) {
   AssertConversionFails(type, "00:00:00:");
   AssertConversionFails(type, "000000");
   AssertConversionFails(type, "000000.000");
+  for (size_t pos : {0, 1, 3, 4, 6, 7}) {
+    for (char c : {'/', ':', 'x'}) {
+      std::string s = "12:34:56";
+      s[pos] = c;
+      ARROW_SCOPED_TRACE("s = ", s);
+      AssertConversionFails(type, s);
+    }
+  }
 
   // Invalid time value
   AssertConversionFails(type, "24:00:00");
@@ -44,7 +44,9 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/config.h"  // for ARROW_CSV definition
 #include "arrow/util/decimal.h"
 #include "arrow/util/future.h"
@@ -66,6 +68,7 @@
 #include "parquet/arrow/writer.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/test_util.h"
 
 using arrow::Array;
@@ -2467,6 +2470,203 @@ TEST(TestArrowReadWrite, GetRecordBatchGenerator) {
   }
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchReaderRowRanges) {
+  const int num_rows = 400;
+  const int row_group_size = 200;
+
+  ::arrow::random::RandomArrayGenerator rag(/*seed=*/42);
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64()),
+                                 ::arrow::field("b", ::arrow::utf8()),
+                                 ::arrow::field("c", ::arrow::list(::arrow::int32()))});
+  auto list_values = rag.Int32(num_rows * 2, 0, 100, /*null_probability=*/0.1);
+  auto table = Table::Make(
+      schema, {rag.Int64(num_rows, 0, 1000, /*null_probability=*/0.1),
+               rag.String(num_rows, 0, 8, /*null_probability=*/0.1),
+               rag.List(*list_values, num_rows, /*null_probability=*/0.1)});
+
+  // Small pages, so that each column chunk spans many pages
+  auto sink = CreateOutputStream();
+  auto writer_properties = WriterProperties::Builder()
+                               .write_batch_size(10)
+                               ->data_pagesize(1)
+                               ->enable_write_page_index()
+                               ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                row_group_size, writer_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_batch_size(16);
+  std::shared_ptr<FileReader> reader;
+  {
+    std::unique_ptr<FileReader> unique_reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&unique_reader));
+    reader = std::move(unique_reader);
+  }
+  auto offset_index =
+      reader->parquet_reader()->GetPageIndexReader()->RowGroup(0)->GetOffsetIndex(0);
+  ASSERT_NE(offset_index, nullptr);
+  ASSERT_GT(offset_index->page_locations().size(), 10);
+
+  const std::vector<RowRanges> row_ranges = {
+      RowRanges({{0, 3}, {42, 45}, {61, 129}, {199, 200}}),
+      RowRanges({{95, 105}})};
+  std::vector<std::shared_ptr<Table>> slices;
+  for (size_t i = 0; i < row_ranges.size(); ++i) {
+    for (const auto& range : row_ranges[i].ranges()) {
+      slices.push_back(table->Slice(i * row_group_size + range.start, range.length()));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(slices));
+
+  {
+    std::unique_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(
+        reader->GetRecordBatchReader({0, 1}, {0, 1, 2}, row_ranges, &rb_reader));
+    ASSERT_OK_AND_ASSIGN(auto actual, rb_reader->ToTable());
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+  {
+    ASSERT_OK_AND_ASSIGN(auto batch_generator,
+                         reader->GetRecordBatchGenerator(reader, {0, 1}, {0, 1, 2},
+                                                         row_ranges));
+    ASSERT_OK_AND_ASSIGN(auto batches,
+                         ::arrow::CollectAsyncGenerator(batch_generator).result());
+    ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(schema, batches));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+  {
+    // Selecting no rows of a row group, and all rows of another
+    std::unique_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(
+        {0, 1}, {0, 2}, {RowRanges(), RowRanges::All(row_group_size)}, &rb_reader));
+    ASSERT_OK_AND_ASSIGN(auto actual, rb_reader->ToTable());
+    ASSERT_OK_AND_ASSIGN(auto expected_columns, table->SelectColumns({0, 2}));
+    AssertTablesEqual(*expected_columns->Slice(row_group_size), *actual,
+                      /*same_chunk_layout=*/false);
+  }
+  {
+    std::unique_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_RAISES(Invalid, reader->GetRecordBatchReader({0, 1}, {0}, {RowRanges()},
+                                                        &rb_reader));
+    ASSERT_RAISES(Invalid,
+                  reader->GetRecordBatchReader(
+                      {0}, {0}, {RowRanges({{0, row_group_size + 1}})}, &rb_reader));
+  }
+}
+
+TEST(TestArrowReadWrite, ParallelColumnChunkDecoding) {
+  const int num_rows = 400;
+  const int row_group_size = 200;
+
+  ::arrow::random::RandomArrayGenerator rag(/*seed=*/42);
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64()),
+                                 ::arrow::field("b", ::arrow::utf8()),
+                                 ::arrow::field("c", ::arrow::list(::arrow::int32()))});
+  auto list_values = rag.Int32(num_rows * 2, 0, 100, /*null_probability=*/0.1);
+  auto table = Table::Make(
+      schema, {rag.Int64(num_rows, 0, 1000, /*null_probability=*/0.1),
+               rag.String(num_rows, 0, 8, /*null_probability=*/0.1),
+               rag.List(*list_values, num_rows, /*null_probability=*/0.1)});
+
+  // Small compressed pages, so that each column chunk spans many pages
+  const auto compression = ::arrow::util::Codec::IsAvailable(Compression::SNAPPY)
+                               ? Compression::SNAPPY
+                               : Compression::UNCOMPRESSED;
+  auto sink = CreateOutputStream();
+  auto writer_properties = WriterProperties::Builder()
+                               .write_batch_size(10)
+                               ->data_pagesize(1)
+                               ->compression(compression)
+                               ->enable_write_page_index()
+                               ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                row_group_size, writer_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  for (int32_t readahead : {0, 1, 4}) {
+    for (int64_t split_bytes : {0, 1, 100}) {
+      ARROW_SCOPED_TRACE("readahead = ", readahead, ", split_bytes = ", split_bytes);
+      ReaderProperties reader_properties = default_reader_properties();
+      reader_properties.set_page_decompression_readahead(readahead);
+      ArrowReaderProperties properties = default_arrow_reader_properties();
+      properties.set_use_threads(true);
+      properties.set_column_chunk_split_bytes(split_bytes);
+
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer), reader_properties));
+      ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+      std::shared_ptr<Table> actual;
+      ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+      ASSERT_OK(actual->ValidateFull());
+      AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+      ASSERT_OK_NO_THROW(reader->ReadRowGroup(1, {1}, &actual));
+      AssertTablesEqual(*table->SelectColumns({1}).ValueOrDie()->Slice(row_group_size),
+                        *actual, /*same_chunk_layout=*/false);
+    }
+  }
+}
+
+TEST(TestArrowReadWrite, ZeroCopyPlainValues) {
+  const int num_rows = 400;
+  const int row_group_size = 200;
+
+  ::arrow::random::RandomArrayGenerator rag(/*seed=*/42);
+  auto schema = ::arrow::schema(
+      {::arrow::field("a", ::arrow::int32(), /*nullable=*/false),
+       ::arrow::field("b", ::arrow::int64(), /*nullable=*/false),
+       ::arrow::field("c", ::arrow::float32(), /*nullable=*/false),
+       ::arrow::field("d", ::arrow::float64(), /*nullable=*/false),
+       ::arrow::field("e", ::arrow::timestamp(TimeUnit::MICRO), /*nullable=*/false),
+       ::arrow::field("f", ::arrow::int64())});
+  ASSERT_OK_AND_ASSIGN(auto timestamps,
+                       rag.Int64(num_rows, 0, 1000000)->View(schema->field(4)->type()));
+  auto table =
+      Table::Make(schema, {rag.Int32(num_rows, 0, 1000), rag.Int64(num_rows, 0, 1000),
+                           rag.Float32(num_rows, 0, 1), rag.Float64(num_rows, 0, 1),
+                           timestamps, rag.Int64(num_rows, 0, 1000, 0.1)});
+
+  // Whole column chunks in a single page, and column chunks spanning many pages
+  for (int64_t page_size : {1 << 20, 100}) {
+    ARROW_SCOPED_TRACE("page_size = ", page_size);
+    auto sink = CreateOutputStream();
+    auto writer_properties = WriterProperties::Builder()
+                                 .write_batch_size(10)
+                                 ->data_pagesize(page_size)
+                                 ->disable_dictionary()
+                                 ->encoding(Encoding::PLAIN)
+                                 ->compression(Compression::UNCOMPRESSED)
+                                 ->build();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  row_group_size, writer_properties));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    for (int64_t batch_size : {30, 1000}) {
+      ARROW_SCOPED_TRACE("batch_size = ", batch_size);
+      ArrowReaderProperties properties = default_arrow_reader_properties();
+      properties.set_batch_size(batch_size);
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+      std::unique_ptr<::arrow::RecordBatchReader> batch_reader;
+      ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(&batch_reader));
+      ASSERT_OK_AND_ASSIGN(auto actual, batch_reader->ToTable());
+      // Values referenced in place must outlive the readers
+      batch_reader.reset();
+      reader.reset();
+      ASSERT_OK(actual->ValidateFull());
+      AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+    }
+  }
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -4413,6 +4613,91 @@ INSTANTIATE_TEST_SUITE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+std::vector<std::shared_ptr<DataType>> DictionaryReadableTypes() {
+  return {::arrow::int32(),   ::arrow::uint32(),
+          ::arrow::date32(),  ::arrow::int64(),
+          ::arrow::uint64(),  ::arrow::timestamp(TimeUnit::MILLI),
+          ::arrow::float32(), ::arrow::float64(),
+          ::arrow::fixed_size_binary(5)};
+}
+
+TEST(TestArrowReadDictionaryTypes, ChangingDictionaries) {
+  constexpr int64_t kNumRows = 4000;
+  constexpr int64_t kRowGroupSize = 1000;
+  ::arrow::random::RandomArrayGenerator rag(42);
+
+  for (const auto& type : DictionaryReadableTypes()) {
+    ARROW_SCOPED_TRACE("type = ", type->ToString());
+    auto uniques = rag.ArrayOf(type, /*size=*/20, /*null_probability=*/0.0);
+    auto indices = rag.Int32(kNumRows, /*min=*/0, /*max=*/19, /*null_probability=*/0.1);
+    ASSERT_OK_AND_ASSIGN(Datum dense, ::arrow::compute::Take(uniques, indices));
+    auto table = MakeSimpleTable(dense.make_array(), /*nullable=*/true);
+
+    ArrowReaderProperties reader_properties = default_arrow_reader_properties();
+    reader_properties.set_read_dictionary(0, true);
+    std::shared_ptr<Table> actual;
+    ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, kRowGroupSize, &actual,
+                                        default_writer_properties(),
+                                        default_arrow_writer_properties(),
+                                        reader_properties));
+    ASSERT_OK(actual->ValidateFull());
+
+    const auto& column = actual->column(0);
+    ASSERT_TRUE(column->type()->Equals(::arrow::dictionary(::arrow::int32(), type)));
+    // Each row group has its own dictionary
+    ASSERT_EQ(column->num_chunks(), kNumRows / kRowGroupSize);
+
+    ::arrow::ArrayVector dense_chunks;
+    for (const auto& chunk : column->chunks()) {
+      ASSERT_OK_AND_ASSIGN(auto dense_chunk, ::arrow::compute::Cast(*chunk, type));
+      dense_chunks.push_back(dense_chunk);
+    }
+    ::arrow::AssertChunkedEquivalent(ChunkedArray(dense.make_array()),
+                                     ChunkedArray(dense_chunks));
+  }
+}
+
+TEST(TestArrowReadDictionaryTypes, SharedDictionaries) {
+  constexpr int64_t kNumRows = 4000;
+  constexpr int64_t kRowGroupSize = 1000;
+  ::arrow::random::RandomArrayGenerator rag(42);
+
+  // Every row group sees the values in the same order, so that they are
+  // all written with the same dictionary.
+  ::arrow::Int32Builder indices_builder;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    if (i % 5 == 4) {
+      ASSERT_OK(indices_builder.AppendNull());
+    } else {
+      ASSERT_OK(indices_builder.Append(static_cast<int32_t>(i % 8)));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto indices, indices_builder.Finish());
+
+  for (const auto& type : DictionaryReadableTypes()) {
+    ARROW_SCOPED_TRACE("type = ", type->ToString());
+    auto uniques = rag.ArrayOf(type, /*size=*/8, /*null_probability=*/0.0);
+    ASSERT_OK_AND_ASSIGN(Datum dense, ::arrow::compute::Take(uniques, indices));
+    auto table = MakeSimpleTable(dense.make_array(), /*nullable=*/true);
+
+    ArrowReaderProperties reader_properties = default_arrow_reader_properties();
+    reader_properties.set_read_dictionary(0, true);
+    std::shared_ptr<Table> actual;
+    ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, kRowGroupSize, &actual,
+                                        default_writer_properties(),
+                                        default_arrow_writer_properties(),
+                                        reader_properties));
+    ASSERT_OK(actual->ValidateFull());
+
+    // All row groups were decoded against a single dictionary
+    const auto& column = actual->column(0);
+    ASSERT_EQ(column->num_chunks(), 1);
+    ASSERT_OK_AND_ASSIGN(auto dense_chunk,
+                         ::arrow::compute::Cast(*column->chunk(0), type));
+    AssertArraysEqual(*dense.make_array(), *dense_chunk);
+  }
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -4465,6 +4750,80 @@ TEST(TestArrowWriteDictionaries, AutoReadAsDictionary) {
   ::arrow::AssertTablesEqual(*expected_dense, *actual_dense);
 }
 
+TEST(TestArrowWriteDictionaries, AutoReadAsDictionaryTypes) {
+  constexpr int64_t kNumRows = 1000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto props_store_schema = ArrowWriterProperties::Builder().store_schema()->build();
+
+  for (const auto& type : DictionaryReadableTypes()) {
+    ARROW_SCOPED_TRACE("type = ", type->ToString());
+    auto uniques = rag.ArrayOf(type, /*size=*/20, /*null_probability=*/0.0);
+    auto indices = rag.Int32(kNumRows, /*min=*/0, /*max=*/19, /*null_probability=*/0.1);
+    ASSERT_OK_AND_ASSIGN(Datum dense, ::arrow::compute::Take(uniques, indices));
+    ASSERT_OK_AND_ASSIGN(Datum encoded, DictionaryEncode(dense));
+    auto table = MakeSimpleTable(encoded.make_array(), /*nullable=*/true);
+
+    std::shared_ptr<Table> actual;
+    ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, kNumRows, &actual,
+                                        default_writer_properties(),
+                                        props_store_schema));
+    ASSERT_OK(actual->ValidateFull());
+
+    // The stored schema makes the column read back as a dictionary
+    const auto& column = actual->column(0);
+    ASSERT_TRUE(column->type()->Equals(::arrow::dictionary(::arrow::int32(), type)));
+    ::arrow::ArrayVector dense_chunks;
+    for (const auto& chunk : column->chunks()) {
+      ASSERT_OK_AND_ASSIGN(auto dense_chunk, ::arrow::compute::Cast(*chunk, type));
+      dense_chunks.push_back(dense_chunk);
+    }
+    ::arrow::AssertChunkedEquivalent(ChunkedArray(dense.make_array()),
+                                     ChunkedArray(dense_chunks));
+  }
+}
+
+TEST(TestArrowWriteDictionaries, AutoReadAsDictionaryPlainEncodings) {
+  // Without dictionary encoding, the values of each page are looked up in the
+  // dictionary being built as they are decoded
+  constexpr int64_t kNumRows = 1000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto props_store_schema = ArrowWriterProperties::Builder().store_schema()->build();
+
+  for (const auto& type_and_encoding :
+       {std::make_pair(::arrow::float64(), Encoding::BYTE_STREAM_SPLIT),
+        std::make_pair(::arrow::float32(), Encoding::BYTE_STREAM_SPLIT),
+        std::make_pair(::arrow::int64(), Encoding::DELTA_BINARY_PACKED),
+        std::make_pair(::arrow::int32(), Encoding::DELTA_BINARY_PACKED)}) {
+    const auto& type = type_and_encoding.first;
+    ARROW_SCOPED_TRACE("type = ", type->ToString(),
+                       ", encoding = ", EncodingToString(type_and_encoding.second));
+    auto uniques = rag.ArrayOf(type, /*size=*/20, /*null_probability=*/0.0);
+    auto indices = rag.Int32(kNumRows, /*min=*/0, /*max=*/19, /*null_probability=*/0.1);
+    ASSERT_OK_AND_ASSIGN(Datum dense, ::arrow::compute::Take(uniques, indices));
+    ASSERT_OK_AND_ASSIGN(Datum encoded, DictionaryEncode(dense));
+    auto table = MakeSimpleTable(encoded.make_array(), /*nullable=*/true);
+
+    auto writer_properties = WriterProperties::Builder()
+                                 .disable_dictionary()
+                                 ->encoding(type_and_encoding.second)
+                                 ->build();
+    std::shared_ptr<Table> actual;
+    ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, kNumRows, &actual, writer_properties,
+                                        props_store_schema));
+    ASSERT_OK(actual->ValidateFull());
+
+    const auto& column = actual->column(0);
+    ASSERT_TRUE(column->type()->Equals(::arrow::dictionary(::arrow::int32(), type)));
+    ::arrow::ArrayVector dense_chunks;
+    for (const auto& chunk : column->chunks()) {
+      ASSERT_OK_AND_ASSIGN(auto dense_chunk, ::arrow::compute::Cast(*chunk, type));
+      dense_chunks.push_back(dense_chunk);
+    }
+    ::arrow::AssertChunkedEquivalent(ChunkedArray(dense.make_array()),
+                                     ChunkedArray(dense_chunks));
+  }
+}
+
 TEST(TestArrowWriteDictionaries, NestedSubfield) {
   auto offsets = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 0, 2, 3]");
   auto indices = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 0, 0]");
@@ -5072,6 +5431,60 @@ TEST(TestArrowReadWrite, MultithreadedWrite) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWriteTable) {
+  const int num_rows = 1000;
+  const int64_t row_group_size = 300;
+
+  ::arrow::random::RandomArrayGenerator rag(/*seed=*/42);
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64()),
+                                 ::arrow::field("b", ::arrow::utf8()),
+                                 ::arrow::field("c", ::arrow::list(::arrow::int32())),
+                                 ::arrow::field("d", ::arrow::float64())});
+  auto list_values = rag.Int32(num_rows * 2, 0, 100, /*null_probability=*/0.1);
+  auto table = Table::Make(
+      schema, {rag.Int64(num_rows, 0, 1000, /*null_probability=*/0.1),
+               rag.String(num_rows, 0, 8, /*null_probability=*/0.1),
+               rag.List(*list_values, num_rows, /*null_probability=*/0.1),
+               rag.Float64(num_rows, -1, 1, /*null_probability=*/0.1)});
+  auto batch = table->Slice(0, 100)->CombineChunksToBatch().ValueOrDie();
+
+  const auto compression = ::arrow::util::Codec::IsAvailable(Compression::SNAPPY)
+                               ? Compression::SNAPPY
+                               : Compression::UNCOMPRESSED;
+  auto write = [&](bool use_threads) -> std::shared_ptr<Buffer> {
+    auto sink = CreateOutputStream();
+    auto write_props = WriterProperties::Builder()
+                           .write_batch_size(100)
+                           ->data_pagesize(512)
+                           ->compression(compression)
+                           ->enable_write_page_index()
+                           ->build();
+    auto arrow_properties =
+        ArrowWriterProperties::Builder().set_use_threads(use_threads)->build();
+    auto writer = FileWriter::Open(*schema, ::arrow::default_memory_pool(), sink,
+                                   write_props, arrow_properties)
+                      .ValueOrDie();
+    ARROW_EXPECT_OK(writer->WriteTable(*table, row_group_size));
+    // Starts a row group of its own
+    ARROW_EXPECT_OK(writer->WriteRecordBatch(*batch));
+    ARROW_EXPECT_OK(writer->Close());
+    return sink->Finish().ValueOrDie();
+  };
+  auto serial = write(/*use_threads=*/false);
+  auto parallel = write(/*use_threads=*/true);
+  ASSERT_TRUE(serial->Equals(*parallel));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(parallel),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(5, reader->num_row_groups());
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       ::arrow::ConcatenateTables({table, table->Slice(0, 100)}));
+  AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+}
+
 TEST(TestArrowReadWrite, FuzzReader) {
   constexpr size_t kMaxFileSize = 1024 * 1024 * 1;
   {
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -44,6 +45,7 @@
 #include "parquet/exception.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
 
@@ -131,6 +133,17 @@ std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
   return result;
 }
 
+// A range of whole pages of a column chunk, decoded by a reader of its own. A null
+// selection stands for the whole column chunk.
+struct ColumnChunkPiece {
+  int row_group;
+  std::shared_ptr<const RowGroupSelection> selection;
+};
+
+// The pieces of the column chunks of the row groups being read, in order, keyed by
+// leaf column index. Columns which are not split are missing.
+using ColumnChunkSplits = std::unordered_map<int, std::vector<ColumnChunkPiece>>;
+
 // Forward declaration
 Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>& context,
                  std::unique_ptr<ColumnReaderImpl>* out);
@@ -152,9 +165,10 @@ class FileReaderImpl : public FileReader {
                                 reader_properties_, &manifest_);
   }
 
-  FileColumnIteratorFactory SomeRowGroupsFactory(std::vector<int> row_groups) {
-    return [row_groups](int i, ParquetFileReader* reader) {
-      return new FileColumnIterator(i, reader, row_groups);
+  FileColumnIteratorFactory SomeRowGroupsFactory(std::vector<int> row_groups,
+                                                 RowGroupSelections selections = {}) {
+    return [row_groups, selections](int i, ParquetFileReader* reader) {
+      return new FileColumnIterator(i, reader, row_groups, selections);
     };
   }
 
@@ -200,9 +214,123 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroups(Iota(reader_->metadata()->num_row_groups()), indices, out);
   }
 
+  // Resolve the rows selected in each row group into RowGroupSelections, along with
+  // the offset indexes of the columns to read. This must run before decoding starts:
+  // the page index reader cannot be used from several threads at once.
+  ::arrow::Result<RowGroupSelections> ResolveRowSelections(
+      const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges) {
+    if (row_ranges.empty()) {
+      return RowGroupSelections{};
+    }
+    if (row_ranges.size() != row_groups.size()) {
+      return Status::Invalid("Got row ranges for ", row_ranges.size(),
+                             " row groups but reading ", row_groups.size(),
+                             " row groups");
+    }
+    RowGroupSelections selections(row_groups.size());
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    std::shared_ptr<PageIndexReader> page_index_reader;
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      auto row_group_metadata = reader_->metadata()->RowGroup(row_groups[i]);
+      const int64_t num_rows = row_group_metadata->num_rows();
+      if (!row_ranges[i].empty() && (row_ranges[i].ranges().front().start < 0 ||
+                                     row_ranges[i].ranges().back().end > num_rows)) {
+        return Status::Invalid("Row ranges ", row_ranges[i].ToString(),
+                               " out of bounds for row group ", row_groups[i], " of ",
+                               num_rows, " rows");
+      }
+      if (row_ranges[i] == RowRanges::All(num_rows)) continue;
+
+      auto selection = std::make_shared<RowGroupSelection>();
+      selection->rows = row_ranges[i];
+      selection->num_rows = num_rows;
+      if (page_index_reader == nullptr) {
+        page_index_reader = reader_->GetPageIndexReader();
+      }
+      auto row_group_index_reader = page_index_reader->RowGroup(row_groups[i]);
+      if (row_group_index_reader != nullptr) {
+        for (int column : column_indices) {
+          // Offset indexes of encrypted columns cannot be read yet
+          if (row_group_metadata->ColumnChunk(column)->crypto_metadata() != nullptr) {
+            continue;
+          }
+          if (auto offset_index = row_group_index_reader->GetOffsetIndex(column)) {
+            selection->offset_indexes.emplace(column, std::move(offset_index));
+          }
+        }
+      }
+      selections[i] = std::move(selection);
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+    return selections;
+  }
+
+  // Split the column chunks of the flat columns being read into ranges of whole
+  // pages holding about column_chunk_split_bytes() compressed bytes, using their
+  // offset index. Like ResolveRowSelections, this must run before decoding starts.
+  ::arrow::Result<ColumnChunkSplits> SplitColumnChunks(
+      const std::vector<int>& row_groups, const std::vector<int>& column_indices) {
+    ColumnChunkSplits splits;
+    const int64_t split_bytes = reader_properties_.column_chunk_split_bytes();
+    if (!reader_properties_.use_threads() || split_bytes <= 0) {
+      return splits;
+    }
+    ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
+                          manifest_.GetFieldIndices(column_indices));
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    std::shared_ptr<PageIndexReader> page_index_reader = reader_->GetPageIndexReader();
+    for (int field_index : field_indices) {
+      const SchemaField& field = manifest_.schema_fields[field_index];
+      if (!field.is_leaf()) continue;
+      const int column = field.column_index;
+      if (reader_->metadata()->schema()->Column(column)->max_repetition_level() > 0) {
+        continue;
+      }
+      std::vector<ColumnChunkPiece> pieces;
+      for (int row_group : row_groups) {
+        auto row_group_metadata = reader_->metadata()->RowGroup(row_group);
+        const int64_t num_rows = row_group_metadata->num_rows();
+        std::shared_ptr<OffsetIndex> offset_index;
+        // Offset indexes of encrypted columns cannot be read yet
+        if (row_group_metadata->ColumnChunk(column)->crypto_metadata() == nullptr) {
+          if (auto row_group_index_reader = page_index_reader->RowGroup(row_group)) {
+            offset_index = row_group_index_reader->GetOffsetIndex(column);
+          }
+        }
+        if (offset_index == nullptr || offset_index->page_locations().empty()) {
+          pieces.push_back({row_group, nullptr});
+          continue;
+        }
+        const std::vector<PageLocation>& page_locations = offset_index->page_locations();
+        const std::vector<RowRanges::Range> page_ranges =
+            RowRanges::PageRanges(*offset_index, num_rows);
+        int64_t piece_start = page_ranges.front().start;
+        int64_t piece_bytes = 0;
+        for (size_t page = 0; page < page_locations.size(); ++page) {
+          piece_bytes += page_locations[page].compressed_page_size;
+          if (piece_bytes < split_bytes && page + 1 < page_locations.size()) continue;
+          auto selection = std::make_shared<RowGroupSelection>();
+          selection->rows = RowRanges({{piece_start, page_ranges[page].end}});
+          selection->num_rows = num_rows;
+          selection->offset_indexes.emplace(column, offset_index);
+          pieces.push_back({row_group, std::move(selection)});
+          piece_start = page_ranges[page].end;
+          piece_bytes = 0;
+        }
+      }
+      if (pieces.size() > row_groups.size()) {
+        splits.emplace(column, std::move(pieces));
+      }
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+    return splits;
+  }
+
   Status GetFieldReader(int i,
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
                         const std::vector<int>& row_groups,
+                        const RowGroupSelections& selections,
                         std::unique_ptr<ColumnReaderImpl>* out) {
     // Should be covered by GetRecordBatchReader checks but
     // manifest_.schema_fields is a separate variable so be extra careful.
@@ -216,7 +344,7 @@ class FileReaderImpl : public FileReader {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
-    ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx->iterator_factory = SomeRowGroupsFactory(row_groups, selections);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
     return GetReader(manifest_.schema_fields[i], ctx, out);
@@ -224,6 +352,7 @@ class FileReaderImpl : public FileReader {
 
   Status GetFieldReaders(const std::vector<int>& column_indices,
                          const std::vector<int>& row_groups,
+                         const RowGroupSelections& selections,
                          std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
                          std::shared_ptr<::arrow::Schema>* out_schema) {
     // We only need to read schema fields which have columns indicated
@@ -237,8 +366,8 @@ class FileReaderImpl : public FileReader {
     ::arrow::FieldVector out_fields(field_indices.size());
     for (size_t i = 0; i < out->size(); ++i) {
       std::unique_ptr<ColumnReaderImpl> reader;
-      RETURN_NOT_OK(
-          GetFieldReader(field_indices[i], included_leaves, row_groups, &reader));
+      RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, row_groups,
+                                   selections, &reader));
 
       out_fields[i] = reader->field();
       out->at(i) = std::move(reader);
@@ -265,21 +394,26 @@ class FileReaderImpl : public FileReader {
     std::vector<int> row_groups = Iota(reader_->metadata()->num_row_groups());
 
     std::unique_ptr<ColumnReaderImpl> reader;
-    RETURN_NOT_OK(GetFieldReader(i, included_leaves, row_groups, &reader));
+    RETURN_NOT_OK(GetFieldReader(i, included_leaves, row_groups, {}, &reader));
 
     return ReadColumn(i, row_groups, reader.get(), out);
   }
 
   Status ReadColumn(int i, const std::vector<int>& row_groups, ColumnReader* reader,
-                    std::shared_ptr<ChunkedArray>* out) {
+                    std::shared_ptr<ChunkedArray>* out,
+                    const RowGroupSelections& selections = {}) {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     // TODO(wesm): This calculation doesn't make much sense when we have repeated
     // schema nodes
     int64_t records_to_read = 0;
-    for (auto row_group : row_groups) {
+    for (size_t j = 0; j < row_groups.size(); ++j) {
+      if (!selections.empty() && selections[j] != nullptr) {
+        records_to_read += selections[j]->rows.num_rows();
+        continue;
+      }
       // Can throw exception
       records_to_read +=
-          reader_->metadata()->RowGroup(row_group)->ColumnChunk(i)->num_values();
+          reader_->metadata()->RowGroup(row_groups[j])->ColumnChunk(i)->num_values();
     }
 #ifdef ARROW_WITH_OPENTELEMETRY
     std::string column_name = reader_->metadata()->schema()->Column(i)->name();
@@ -320,7 +454,15 @@ class FileReaderImpl : public FileReader {
   // alive in async contexts.
   Future<std::shared_ptr<Table>> DecodeRowGroups(
       std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor);
+      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor,
+      const RowGroupSelections& selections = {}, const ColumnChunkSplits& splits = {});
+
+  // Helper method used by DecodeRowGroups when column chunks are split - decode each
+  // piece of the split columns on its own, in parallel with the other columns.
+  Future<std::shared_ptr<Table>> DecodeColumnChunkPieces(
+      std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
+      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor,
+      const RowGroupSelections& selections, const ColumnChunkSplits& splits);
 
   Status ReadRowGroups(const std::vector<int>& row_groups,
                        std::shared_ptr<Table>* table) override {
@@ -338,6 +480,13 @@ class FileReaderImpl : public FileReader {
 
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               const std::vector<int>& column_indices,
+                              std::unique_ptr<RecordBatchReader>* out) override {
+    return GetRecordBatchReader(row_group_indices, column_indices, {}, out);
+  }
+
+  Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                              const std::vector<int>& column_indices,
+                              const std::vector<RowRanges>& row_ranges,
                               std::unique_ptr<RecordBatchReader>* out) override;
 
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
@@ -356,6 +505,17 @@ class FileReaderImpl : public FileReader {
                           const std::vector<int> row_group_indices,
                           const std::vector<int> column_indices,
                           ::arrow::internal::Executor* cpu_executor,
+                          int64_t rows_to_readahead) override {
+    return GetRecordBatchGenerator(std::move(reader), row_group_indices, column_indices,
+                                   {}, cpu_executor, rows_to_readahead);
+  }
+
+  ::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          const std::vector<RowRanges>& row_ranges,
+                          ::arrow::internal::Executor* cpu_executor,
                           int64_t rows_to_readahead) override;
 
   int num_columns() const { return reader_->metadata()->num_columns(); }
@@ -463,9 +623,28 @@ class LeafReader : public ColumnReaderImpl {
         descr_(input_->descr()) {
     record_reader_ = RecordReader::Make(
         descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+    record_reader_->set_zero_copy_values(TransfersValuesZeroCopy());
     NextRowGroup();
   }
 
+  // Whether TransferColumnData() hands the values buffer over to the array
+  // unchanged, in which case values may reference the data pages in place
+  bool TransfersValuesZeroCopy() const {
+    switch (field_->type()->id()) {
+      case ::arrow::Type::INT32:
+      case ::arrow::Type::INT64:
+      case ::arrow::Type::FLOAT:
+      case ::arrow::Type::DOUBLE:
+        return true;
+      case ::arrow::Type::TIMESTAMP:
+        return descr_->physical_type() != ::parquet::Type::INT96 &&
+               checked_cast<const ::arrow::TimestampType&>(*field_->type()).unit() !=
+                   ::arrow::TimeUnit::SECOND;
+      default:
+        return false;
+    }
+  }
+
   Status GetDefLevels(const int16_t** data, int64_t* length) final {
     *data = record_reader_->def_levels();
     *length = record_reader_->levels_position();
@@ -490,7 +669,9 @@ class LeafReader : public ColumnReaderImpl {
       if (!record_reader_->HasMoreData()) {
         break;
       }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      int64_t records_read = selection_ != nullptr
+                                 ? ReadSelectedRecords(records_to_read)
+                                 : record_reader_->ReadRecords(records_to_read);
       records_to_read -= records_read;
       if (records_read == 0) {
         NextRowGroup();
@@ -514,14 +695,105 @@ class LeafReader : public ColumnReaderImpl {
   std::shared_ptr<ChunkedArray> out_;
   void NextRowGroup() {
     std::unique_ptr<PageReader> page_reader = input_->NextChunk();
+    selection_ = input_->selection();
+    if (selection_ != nullptr && page_reader != nullptr) {
+      SelectPages(page_reader.get());
+    }
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  // Translate the row selection of the current row group into the records seen by
+  // the record reader. Data pages holding no selected rows are skipped before being
+  // decompressed when the offset index tells which rows they hold. This requires
+  // pages to start at record boundaries, so repeated columns only skip records.
+  void SelectPages(PageReader* page_reader) {
+    skip_pages_.clear();
+    next_page_ = 0;
+    next_range_ = 0;
+    position_ = 0;
+    selection_exhausted_ = false;
+    selected_rows_ = selection_->rows;
+    num_records_ = selection_->num_rows;
+
+    auto it = selection_->offset_indexes.find(input_->column_index());
+    if (descr_->max_repetition_level() == 0 && it != selection_->offset_indexes.end()) {
+      RowRanges selected_rows;
+      int64_t num_records = 0;
+      for (const auto& page :
+           RowRanges::PageRanges(*it->second, selection_->num_rows)) {
+        const bool skip_page = !selection_->rows.Overlaps(page);
+        skip_pages_.push_back(skip_page);
+        if (skip_page) continue;
+        // Rows are renumbered as if the skipped pages did not exist
+        const int64_t shift = num_records - page.start;
+        for (const auto& range :
+             RowRanges::Intersection(selection_->rows, RowRanges({page})).ranges()) {
+          selected_rows.Add({range.start + shift, range.end + shift});
+        }
+        num_records += page.length();
+      }
+      selected_rows_ = std::move(selected_rows);
+      num_records_ = num_records;
+    }
+    // The page reader is owned by record_reader_, which this reader outlives
+    page_reader->set_data_page_filter(
+        [this](const DataPageStats&) { return SkipNextPage(); });
+  }
+
+  bool SkipNextPage() {
+    const size_t page = next_page_++;
+    if (selection_exhausted_) return true;
+    return page < skip_pages_.size() && skip_pages_[page];
+  }
+
+  // Read up to num_records selected records from the current row group, skipping
+  // the records in between. Return 0 once the selection is exhausted.
+  int64_t ReadSelectedRecords(int64_t num_records) {
+    const auto& ranges = selected_rows_.ranges();
+    while (next_range_ < ranges.size()) {
+      const auto& range = ranges[next_range_];
+      if (position_ < range.start) {
+        const int64_t skipped = record_reader_->SkipRecords(range.start - position_);
+        if (skipped == 0) return 0;
+        position_ += skipped;
+        continue;
+      }
+      const int64_t records_read =
+          record_reader_->ReadRecords(std::min(num_records, range.end - position_));
+      position_ += records_read;
+      if (position_ == range.end) ++next_range_;
+      return records_read;
+    }
+    // Drop the rest of the current page so that the row group ends cleanly; all
+    // the pages after it are skipped.
+    if (!selection_exhausted_) {
+      selection_exhausted_ = true;
+      if (position_ < num_records_) {
+        position_ += record_reader_->SkipRecords(num_records_ - position_);
+      }
+    }
+    return 0;
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
   std::shared_ptr<RecordReader> record_reader_;
+
+  // Row selection of the current row group, null if all rows are read
+  const RowGroupSelection* selection_ = nullptr;
+  // Selected records, numbered as seen by the record reader
+  RowRanges selected_rows_;
+  // Number of records the record reader will see in the current row group
+  int64_t num_records_ = 0;
+  // Index of the next range of selected_rows_ to read
+  size_t next_range_ = 0;
+  // Number of records read or skipped in the current row group
+  int64_t position_ = 0;
+  std::vector<bool> skip_pages_;
+  size_t next_page_ = 0;
+  bool selection_exhausted_ = false;
 };
 
 // Column reader for extension arrays
@@ -976,8 +1248,11 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
 
 Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
                                             const std::vector<int>& column_indices,
+                                            const std::vector<RowRanges>& row_ranges,
                                             std::unique_ptr<RecordBatchReader>* out) {
   RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
+  ARROW_ASSIGN_OR_RAISE(auto selections,
+                        ResolveRowSelections(row_groups, column_indices, row_ranges));
 
   if (reader_properties_.pre_buffer()) {
     // PARQUET-1698/PARQUET-1820: pre-buffer row groups/column chunks if enabled
@@ -989,7 +1264,17 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
 
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> batch_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &batch_schema));
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, selections, &readers,
+                                &batch_schema));
+
+  // Number of rows read from each row group
+  std::vector<int64_t> row_group_num_rows(row_groups.size());
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    row_group_num_rows[i] =
+        !selections.empty() && selections[i] != nullptr
+            ? selections[i]->rows.num_rows()
+            : parquet_reader()->metadata()->RowGroup(row_groups[i])->num_rows();
+  }
 
   if (readers.empty()) {
     // Just generate all batches right now; they're cheap since they have no columns.
@@ -999,9 +1284,7 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
 
     ::arrow::RecordBatchVector batches;
 
-    for (int row_group : row_groups) {
-      int64_t num_rows = parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
-
+    for (int64_t num_rows : row_group_num_rows) {
       batches.insert(batches.end(), num_rows / batch_size, max_sized_batch);
 
       if (int64_t trailing_rows = num_rows % batch_size) {
@@ -1016,8 +1299,8 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
   }
 
   int64_t num_rows = 0;
-  for (int row_group : row_groups) {
-    num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+  for (int64_t row_group_rows : row_group_num_rows) {
+    num_rows += row_group_rows;
   }
 
   using ::arrow::RecordBatchIterator;
@@ -1074,11 +1357,12 @@ class RowGroupGenerator {
   explicit RowGroupGenerator(std::shared_ptr<FileReaderImpl> arrow_reader,
                              ::arrow::internal::Executor* cpu_executor,
                              std::vector<int> row_groups, std::vector<int> column_indices,
-                             int64_t min_rows_in_flight)
+                             RowGroupSelections selections, int64_t min_rows_in_flight)
       : arrow_reader_(std::move(arrow_reader)),
         cpu_executor_(cpu_executor),
         row_groups_(std::move(row_groups)),
         column_indices_(std::move(column_indices)),
+        selections_(std::move(selections)),
         min_rows_in_flight_(min_rows_in_flight),
         rows_in_flight_(0),
         index_(0),
@@ -1114,21 +1398,27 @@ class RowGroupGenerator {
     size_t row_group_index = readahead_index_++;
     int row_group = row_groups_[row_group_index];
     std::vector<int> column_indices = column_indices_;
+    RowGroupSelections selection;
+    if (!selections_.empty()) selection = {selections_[row_group_index]};
     auto reader = arrow_reader_;
     int64_t num_rows =
-        reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+        selection.empty() || selection[0] == nullptr
+            ? reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows()
+            : selection[0]->rows.num_rows();
     rows_in_flight_ += num_rows;
     ::arrow::Future<RecordBatchGenerator> row_group_read;
     if (!reader->properties().pre_buffer()) {
-      row_group_read = SubmitRead(cpu_executor_, reader, row_group, column_indices);
+      row_group_read =
+          SubmitRead(cpu_executor_, reader, row_group, column_indices, selection);
     } else {
       auto ready = reader->parquet_reader()->WhenBuffered({row_group}, column_indices);
       if (cpu_executor_) ready = cpu_executor_->TransferAlways(ready);
       row_group_read =
-          ready.Then([this, reader, row_group,
-                      column_indices = std::move(
-                          column_indices)]() -> ::arrow::Future<RecordBatchGenerator> {
-            return ReadOneRowGroup(cpu_executor_, reader, row_group, column_indices);
+          ready.Then([this, reader, row_group, column_indices = std::move(column_indices),
+                      selection = std::move(
+                          selection)]() -> ::arrow::Future<RecordBatchGenerator> {
+            return ReadOneRowGroup(cpu_executor_, reader, row_group, column_indices,
+                                   selection);
           });
     }
     in_flight_reads_.push({std::move(row_group_read), num_rows});
@@ -1141,21 +1431,25 @@ class RowGroupGenerator {
   // async I/O without forcing readahead.
   static ::arrow::Future<RecordBatchGenerator> SubmitRead(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      const RowGroupSelections& selection) {
     if (!cpu_executor) {
-      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices);
+      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices, selection);
     }
     // If we have an executor, then force transfer (even if I/O was complete)
     return ::arrow::DeferNotOk(cpu_executor->Submit(ReadOneRowGroup, cpu_executor, self,
-                                                    row_group, column_indices));
+                                                    row_group, column_indices,
+                                                    selection));
   }
 
   static ::arrow::Future<RecordBatchGenerator> ReadOneRowGroup(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      const RowGroupSelections& selection) {
     // Skips bound checks/pre-buffering, since we've done that already
     const int64_t batch_size = self->properties().batch_size();
-    return self->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor)
+    return self->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor,
+                                 selection)
         .Then([batch_size](const std::shared_ptr<Table>& table)
                   -> ::arrow::Result<RecordBatchGenerator> {
           ::arrow::TableBatchReader table_reader(*table);
@@ -1169,6 +1463,7 @@ class RowGroupGenerator {
   ::arrow::internal::Executor* cpu_executor_;
   std::vector<int> row_groups_;
   std::vector<int> column_indices_;
+  RowGroupSelections selections_;
   int64_t min_rows_in_flight_;
   std::queue<ReadRequest> in_flight_reads_;
   int64_t rows_in_flight_;
@@ -1180,12 +1475,16 @@ class RowGroupGenerator {
 FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
                                         const std::vector<int> row_group_indices,
                                         const std::vector<int> column_indices,
+                                        const std::vector<RowRanges>& row_ranges,
                                         ::arrow::internal::Executor* cpu_executor,
                                         int64_t rows_to_readahead) {
   RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
   if (rows_to_readahead < 0) {
     return Status::Invalid("rows_to_readahead must be > 0");
   }
+  ARROW_ASSIGN_OR_RAISE(
+      auto selections,
+      ResolveRowSelections(row_group_indices, column_indices, row_ranges));
   if (reader_properties_.pre_buffer()) {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     reader_->PreBuffer(row_group_indices, column_indices, reader_properties_.io_context(),
@@ -1195,7 +1494,7 @@ FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
   ::arrow::AsyncGenerator<RowGroupGenerator::RecordBatchGenerator> row_group_generator =
       RowGroupGenerator(::arrow::internal::checked_pointer_cast<FileReaderImpl>(reader),
                         cpu_executor, row_group_indices, column_indices,
-                        rows_to_readahead);
+                        std::move(selections), rows_to_readahead);
   ::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>> concatenated =
       ::arrow::MakeConcatenatedGenerator(std::move(row_group_generator));
   WRAP_ASYNC_GENERATOR(std::move(concatenated));
@@ -1230,39 +1529,52 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  ARROW_ASSIGN_OR_RAISE(auto splits, SplitColumnChunks(row_groups, column_indices));
   auto fut = DecodeRowGroups(/*self=*/nullptr, row_groups, column_indices,
-                             /*cpu_executor=*/nullptr);
+                             /*cpu_executor=*/nullptr, /*selections=*/{}, splits);
   ARROW_ASSIGN_OR_RAISE(*out, fut.MoveResult());
   return Status::OK();
 }
 
 Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor) {
+    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor,
+    const RowGroupSelections& selections, const ColumnChunkSplits& splits) {
   // `self` is used solely to keep `this` alive in an async context - but we use this
   // in a sync context too so use `this` over `self`
+  if (!splits.empty()) {
+    // OptionalParallelForAsync requires an executor
+    if (!cpu_executor) cpu_executor = ::arrow::internal::GetCpuThreadPool();
+    return DecodeColumnChunkPieces(std::move(self), row_groups, column_indices,
+                                   cpu_executor, selections, splits);
+  }
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> result_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, selections, &readers,
+                                &result_schema));
   // OptionalParallelForAsync requires an executor
   if (!cpu_executor) cpu_executor = ::arrow::internal::GetCpuThreadPool();
 
-  auto read_column = [row_groups, self, this](size_t i,
-                                              std::shared_ptr<ColumnReaderImpl> reader)
+  auto read_column = [row_groups, selections, self, this](
+                         size_t i, std::shared_ptr<ColumnReaderImpl> reader)
       -> ::arrow::Result<std::shared_ptr<::arrow::ChunkedArray>> {
     std::shared_ptr<::arrow::ChunkedArray> column;
-    RETURN_NOT_OK(ReadColumn(static_cast<int>(i), row_groups, reader.get(), &column));
+    RETURN_NOT_OK(ReadColumn(static_cast<int>(i), row_groups, reader.get(), &column,
+                             selections));
     return column;
   };
-  auto make_table = [result_schema, row_groups, self,
+  auto make_table = [result_schema, row_groups, selections, self,
                      this](const ::arrow::ChunkedArrayVector& columns)
       -> ::arrow::Result<std::shared_ptr<Table>> {
     int64_t num_rows = 0;
     if (!columns.empty()) {
       num_rows = columns[0]->length();
     } else {
-      for (int i : row_groups) {
-        num_rows += parquet_reader()->metadata()->RowGroup(i)->num_rows();
+      for (size_t i = 0; i < row_groups.size(); ++i) {
+        num_rows +=
+            !selections.empty() && selections[i] != nullptr
+                ? selections[i]->rows.num_rows()
+                : parquet_reader()->metadata()->RowGroup(row_groups[i])->num_rows();
       }
     }
     auto table = Table::Make(std::move(result_schema), columns, num_rows);
@@ -1275,6 +1587,85 @@ Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
       .Then(std::move(make_table));
 }
 
+Future<std::shared_ptr<Table>> FileReaderImpl::DecodeColumnChunkPieces(
+    std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
+    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor,
+    const RowGroupSelections& selections, const ColumnChunkSplits& splits) {
+  // Decodes a whole field, or a single piece of a split column
+  struct DecodeTask {
+    size_t field;
+    int column;
+    std::shared_ptr<ColumnReaderImpl> reader;
+    std::vector<int> row_groups;
+    RowGroupSelections selections;
+  };
+
+  ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
+                        manifest_.GetFieldIndices(column_indices));
+  auto included_leaves = VectorToSharedSet(column_indices);
+
+  std::vector<DecodeTask> tasks;
+  ::arrow::FieldVector fields(field_indices.size());
+  for (size_t i = 0; i < field_indices.size(); ++i) {
+    const SchemaField& field = manifest_.schema_fields[field_indices[i]];
+    auto it = field.is_leaf() ? splits.find(field.column_index) : splits.end();
+    if (it == splits.end()) {
+      std::unique_ptr<ColumnReaderImpl> reader;
+      RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, row_groups,
+                                   selections, &reader));
+      fields[i] = reader->field();
+      tasks.push_back(
+          {i, static_cast<int>(i), std::move(reader), row_groups, selections});
+      continue;
+    }
+    for (const ColumnChunkPiece& piece : it->second) {
+      std::unique_ptr<ColumnReaderImpl> reader;
+      RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, {piece.row_group},
+                                   {piece.selection}, &reader));
+      fields[i] = reader->field();
+      tasks.push_back({i, field.column_index, std::move(reader), {piece.row_group},
+                       {piece.selection}});
+    }
+  }
+  auto result_schema = ::arrow::schema(std::move(fields), manifest_.schema_metadata);
+  std::vector<size_t> task_fields;
+  for (const DecodeTask& task : tasks) {
+    task_fields.push_back(task.field);
+  }
+
+  auto read_task = [self, this](size_t, DecodeTask task)
+      -> ::arrow::Result<std::shared_ptr<::arrow::ChunkedArray>> {
+    std::shared_ptr<::arrow::ChunkedArray> column;
+    RETURN_NOT_OK(ReadColumn(task.column, task.row_groups, task.reader.get(), &column,
+                             task.selections));
+    return column;
+  };
+  // Stitch the pieces of each column back together, in order
+  auto make_table = [result_schema, task_fields](
+                        const ::arrow::ChunkedArrayVector& decoded)
+      -> ::arrow::Result<std::shared_ptr<Table>> {
+    std::vector<::arrow::ArrayVector> chunks(result_schema->num_fields());
+    for (size_t i = 0; i < decoded.size(); ++i) {
+      const ::arrow::ArrayVector& decoded_chunks = decoded[i]->chunks();
+      chunks[task_fields[i]].insert(chunks[task_fields[i]].end(), decoded_chunks.begin(),
+                                    decoded_chunks.end());
+    }
+    ::arrow::ChunkedArrayVector columns(chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      columns[i] = std::make_shared<ChunkedArray>(std::move(chunks[i]),
+                                                  result_schema->field(i)->type());
+    }
+    const int64_t num_rows = columns.front()->length();
+    auto table = Table::Make(std::move(result_schema), std::move(columns), num_rows);
+    RETURN_NOT_OK(table->Validate());
+    return table;
+  };
+  return ::arrow::internal::OptionalParallelForAsync(/*use_threads=*/true,
+                                                     std::move(tasks), read_task,
+                                                     cpu_executor)
+      .Then(std::move(make_table));
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
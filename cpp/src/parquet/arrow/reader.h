@@ -42,6 +42,7 @@ class RecordBatch;
 namespace parquet {
 
 class FileMetaData;
+class RowRanges;
 class SchemaDescriptor;
 
 namespace arrow {
@@ -187,6 +188,26 @@ class PARQUET_EXPORT FileReader {
       const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
       std::unique_ptr<::arrow::RecordBatchReader>* out) = 0;
 
+  /// \brief Return a RecordBatchReader of the rows selected by row_ranges in the
+  /// row groups selected from row_group_indices, whose columns are selected by
+  /// column_indices.
+  ///
+  /// The data pages holding no selected rows are skipped without being
+  /// decompressed, for columns which have an offset index and are not repeated.
+  ///
+  /// \param row_group_indices which row groups to read (order determines read order).
+  /// \param column_indices which columns to read (order determines output schema).
+  /// \param row_ranges rows to read from each row group, one entry per element of
+  ///     row_group_indices.
+  /// \param[out] out record batch stream from parquet data.
+  ///
+  /// \returns error Status if either row_group_indices or column_indices
+  ///     contains an invalid index, or row_ranges does not match row_group_indices
+  virtual ::arrow::Status GetRecordBatchReader(
+      const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges,
+      std::unique_ptr<::arrow::RecordBatchReader>* out) = 0;
+
   /// \brief Return a RecordBatchReader of row groups selected from
   /// row_group_indices, whose columns are selected by column_indices.
   ///
@@ -221,6 +242,19 @@ class PARQUET_EXPORT FileReader {
                           ::arrow::internal::Executor* cpu_executor = NULLPTR,
                           int64_t rows_to_readahead = 0) = 0;
 
+  /// \brief Return a generator of the record batches holding the rows selected by
+  /// row_ranges, one entry per element of row_group_indices.
+  ///
+  /// \see GetRecordBatchReader for how the row selection is applied.
+  virtual ::arrow::Result<
+      std::function<::arrow::Future<std::shared_ptr<::arrow::RecordBatch>>()>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          const std::vector<RowRanges>& row_ranges,
+                          ::arrow::internal::Executor* cpu_executor = NULLPTR,
+                          int64_t rows_to_readahead = 0) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out) = 0;
 
@@ -346,11 +346,12 @@ std::shared_ptr<Array> TransferZeroCopy(RecordReader* reader,
   std::shared_ptr<::arrow::ArrayData> data;
   if (field->nullable()) {
     std::vector<std::shared_ptr<Buffer>> buffers = {reader->ReleaseIsValid(),
-                                                    reader->ReleaseValues()};
+                                                    reader->ReleaseValuesZeroCopy()};
     data = std::make_shared<::arrow::ArrayData>(field->type(), reader->values_written(),
                                                 std::move(buffers), reader->null_count());
   } else {
-    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr, reader->ReleaseValues()};
+    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr,
+                                                    reader->ReleaseValuesZeroCopy()};
     data = std::make_shared<::arrow::ArrayData>(field->type(), reader->values_written(),
                                                 std::move(buffers), /*null_count=*/0);
   }
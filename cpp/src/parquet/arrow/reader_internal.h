@@ -22,6 +22,7 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -30,6 +31,7 @@
 #include "parquet/column_reader.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
@@ -57,26 +59,46 @@ class ColumnReaderImpl;
 // ----------------------------------------------------------------------
 // Iteration utilities
 
+// Rows to read from a row group, along with the offset index of each leaf column
+// being read, which lets column readers skip the data pages holding no selected rows
+struct RowGroupSelection {
+  RowRanges rows;
+  int64_t num_rows;
+  // Keyed by leaf column index. Columns without an offset index are missing.
+  std::unordered_map<int, std::shared_ptr<OffsetIndex>> offset_indexes;
+};
+
+// One entry per row group being read, null if all its rows are read. An empty
+// vector reads all rows of all row groups.
+using RowGroupSelections = std::vector<std::shared_ptr<const RowGroupSelection>>;
+
 // Abstraction to decouple row group iteration details from the ColumnReader,
 // so we can read only a single row group if we want
 class FileColumnIterator {
  public:
   explicit FileColumnIterator(int column_index, ParquetFileReader* reader,
-                              std::vector<int> row_groups)
+                              std::vector<int> row_groups,
+                              RowGroupSelections selections = {})
       : column_index_(column_index),
         reader_(reader),
         schema_(reader->metadata()->schema()),
-        row_groups_(row_groups.begin(), row_groups.end()) {}
+        row_groups_(row_groups.begin(), row_groups.end()),
+        selections_(selections.begin(), selections.end()) {}
 
   virtual ~FileColumnIterator() {}
 
   std::unique_ptr<::parquet::PageReader> NextChunk() {
+    current_selection_ = nullptr;
     if (row_groups_.empty()) {
       return nullptr;
     }
 
     auto row_group_reader = reader_->RowGroup(row_groups_.front());
     row_groups_.pop_front();
+    if (!selections_.empty()) {
+      current_selection_ = std::move(selections_.front());
+      selections_.pop_front();
+    }
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
@@ -88,11 +110,17 @@ class FileColumnIterator {
 
   int column_index() const { return column_index_; }
 
+  // Rows to read from the chunk last returned by NextChunk(), or null to read
+  // all of them
+  const RowGroupSelection* selection() const { return current_selection_.get(); }
+
  protected:
   int column_index_;
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  std::deque<std::shared_ptr<const RowGroupSelection>> selections_;
+  std::shared_ptr<const RowGroupSelection> current_selection_;
 };
 
 using FileColumnIteratorFactory =
@@ -465,6 +465,45 @@ bool IsDictionaryReadSupported(const ArrowType& type) {
   return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
 }
 
+// Whether set_read_dictionary() is honored for a column: dictionary pages are
+// decoded as-is into the Arrow dictionary, so the Arrow value type must be a
+// zero-copy view of the values of the Parquet physical type.
+bool IsDictionaryReadSupported(const schema::PrimitiveNode& node,
+                               const ArrowType& type) {
+  switch (node.physical_type()) {
+    case ParquetType::INT32:
+      switch (type.id()) {
+        case ::arrow::Type::INT32:
+        case ::arrow::Type::UINT32:
+        case ::arrow::Type::DATE32:
+        case ::arrow::Type::TIME32:
+          return true;
+        default:
+          return false;
+      }
+    case ParquetType::INT64:
+      switch (type.id()) {
+        case ::arrow::Type::INT64:
+        case ::arrow::Type::UINT64:
+        case ::arrow::Type::TIME64:
+        case ::arrow::Type::TIMESTAMP:
+          return true;
+        default:
+          return false;
+      }
+    case ParquetType::FLOAT:
+      return type.id() == ::arrow::Type::FLOAT;
+    case ParquetType::DOUBLE:
+      return type.id() == ::arrow::Type::DOUBLE;
+    case ParquetType::FIXED_LEN_BYTE_ARRAY:
+      return type.id() == ::arrow::Type::FIXED_SIZE_BINARY;
+    case ParquetType::BYTE_ARRAY:
+      return IsDictionaryReadSupported(type);
+    default:
+      return false;
+  }
+}
+
 // ----------------------------------------------------------------------
 // Schema logic
 
@@ -475,7 +514,7 @@ bool IsDictionaryReadSupported(const ArrowType& type) {
       std::shared_ptr<ArrowType> storage_type,
       GetArrowType(primitive_node, ctx->properties.coerce_int96_timestamp_unit()));
   if (ctx->properties.read_dictionary(column_index) &&
-      IsDictionaryReadSupported(*storage_type)) {
+      IsDictionaryReadSupported(primitive_node, *storage_type)) {
     return ::arrow::dictionary(::arrow::int32(), storage_type);
   }
   return storage_type;
@@ -834,7 +873,9 @@ Status GetOriginSchema(const std::shared_ptr<const KeyValueMetadata>& metadata,
 // but that is not necessarily present in the field reconstitued from Parquet data
 // (for example, Parquet timestamp types doesn't carry timezone information).
 
-Result<bool> ApplyOriginalMetadata(const Field& origin_field, SchemaField* inferred);
+Result<bool> ApplyOriginalMetadata(const Field& origin_field,
+                                   const SchemaDescriptor& parquet_schema,
+                                   SchemaField* inferred);
 
 std::function<std::shared_ptr<::arrow::DataType>(FieldVector)> GetNestedFactory(
     const ArrowType& origin_type, const ArrowType& inferred_type) {
@@ -873,6 +914,7 @@ std::function<std::shared_ptr<::arrow::DataType>(FieldVector)> GetNestedFactory(
 }
 
 Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
+                                          const SchemaDescriptor& parquet_schema,
                                           SchemaField* inferred) {
   bool modified = false;
 
@@ -892,7 +934,8 @@ Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
       for (int i = 0; i < inferred_type->num_fields(); ++i) {
         ARROW_ASSIGN_OR_RAISE(
             const bool child_modified,
-            ApplyOriginalMetadata(*origin_type->field(i), &inferred->children[i]));
+            ApplyOriginalMetadata(*origin_type->field(i), parquet_schema,
+                                  &inferred->children[i]));
         modified |= child_modified;
       }
       if (modified) {
@@ -935,8 +978,11 @@ Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
   }
 
   if (origin_type->id() == ::arrow::Type::DICTIONARY &&
-      inferred_type->id() != ::arrow::Type::DICTIONARY &&
-      IsDictionaryReadSupported(*inferred_type)) {
+      inferred_type->id() != ::arrow::Type::DICTIONARY && inferred->is_leaf() &&
+      IsDictionaryReadSupported(
+          *checked_cast<const schema::PrimitiveNode*>(
+              parquet_schema.Column(inferred->column_index)->schema_node().get()),
+          *inferred_type)) {
     // Direct dictionary reads are only suppored for a couple primitive types,
     // so no need to recurse on value types.
     const auto& dict_origin_type =
@@ -975,7 +1021,9 @@ Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
   return modified;
 }
 
-Result<bool> ApplyOriginalMetadata(const Field& origin_field, SchemaField* inferred) {
+Result<bool> ApplyOriginalMetadata(const Field& origin_field,
+                                   const SchemaDescriptor& parquet_schema,
+                                   SchemaField* inferred) {
   bool modified = false;
 
   auto origin_type = origin_field.type();
@@ -986,7 +1034,8 @@ Result<bool> ApplyOriginalMetadata(const Field& origin_field, SchemaField* infer
     auto origin_storage_field = origin_field.WithType(ex_type.storage_type());
 
     // Apply metadata recursively to storage type
-    RETURN_NOT_OK(ApplyOriginalStorageMetadata(*origin_storage_field, inferred));
+    RETURN_NOT_OK(
+        ApplyOriginalStorageMetadata(*origin_storage_field, parquet_schema, inferred));
 
     // Restore extension type, if the storage type is the same as inferred
     // from the Parquet type
@@ -995,7 +1044,9 @@ Result<bool> ApplyOriginalMetadata(const Field& origin_field, SchemaField* infer
     }
     modified = true;
   } else {
-    ARROW_ASSIGN_OR_RAISE(modified, ApplyOriginalStorageMetadata(origin_field, inferred));
+    ARROW_ASSIGN_OR_RAISE(modified,
+                          ApplyOriginalStorageMetadata(origin_field, parquet_schema,
+                                                       inferred));
   }
 
   return modified;
@@ -1102,7 +1153,7 @@ Status SchemaManifest::Make(const SchemaDescriptor* schema,
     }
 
     auto origin_field = manifest->origin_schema->field(i);
-    RETURN_NOT_OK(ApplyOriginalMetadata(*origin_field, out_field));
+    RETURN_NOT_OK(ApplyOriginalMetadata(*origin_field, *schema, out_field));
   }
   return Status::OK();
 }
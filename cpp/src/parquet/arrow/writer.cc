@@ -311,6 +311,7 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
+    row_group_writer_closed_ = false;
     return Status::OK();
   }
 
@@ -370,6 +371,16 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (arrow_properties_->use_threads()) {
+        // Encode the column chunks in parallel into a buffered row group, which
+        // writes them out in column order once closed: the file is the same as
+        // when writing the columns one after another.
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        RETURN_NOT_OK(WriteBufferedColumns(table.columns(), offset, size));
+        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        row_group_writer_closed_ = true;
+        return Status::OK();
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -397,6 +408,7 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    row_group_writer_closed_ = false;
     return Status::OK();
   }
 
@@ -409,45 +421,23 @@ class FileWriterImpl : public FileWriter {
     const int64_t max_row_group_length = this->properties().max_row_group_length();
 
     if (row_group_writer_ == nullptr || !row_group_writer_->buffered() ||
+        row_group_writer_closed_ ||
         row_group_writer_->num_rows() >= max_row_group_length) {
       RETURN_NOT_OK(NewBufferedRowGroup());
     }
 
-    auto WriteBatch = [&](int64_t offset, int64_t size) {
-      std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers;
-      int column_index_start = 0;
-
-      for (int i = 0; i < batch.num_columns(); i++) {
-        ChunkedArray chunked_array{batch.column(i)};
-        ARROW_ASSIGN_OR_RAISE(
-            std::unique_ptr<ArrowColumnWriterV2> writer,
-            ArrowColumnWriterV2::Make(chunked_array, offset, size, schema_manifest_,
-                                      row_group_writer_, column_index_start));
-        column_index_start += writer->leaf_count();
-        if (arrow_properties_->use_threads()) {
-          writers.emplace_back(std::move(writer));
-        } else {
-          RETURN_NOT_OK(writer->Write(&column_write_context_));
-        }
-      }
-
-      if (arrow_properties_->use_threads()) {
-        DCHECK_EQ(parallel_column_write_contexts_.size(), writers.size());
-        RETURN_NOT_OK(::arrow::internal::ParallelFor(
-            static_cast<int>(writers.size()),
-            [&](int i) { return writers[i]->Write(&parallel_column_write_contexts_[i]); },
-            arrow_properties_->executor()));
-      }
-
-      return Status::OK();
-    };
+    ::arrow::ChunkedArrayVector columns;
+    columns.reserve(batch.num_columns());
+    for (const auto& column : batch.columns()) {
+      columns.push_back(std::make_shared<ChunkedArray>(column));
+    }
 
     int64_t offset = 0;
     while (offset < batch.num_rows()) {
       const int64_t batch_size =
           std::min(max_row_group_length - row_group_writer_->num_rows(),
                    batch.num_rows() - offset);
-      RETURN_NOT_OK(WriteBatch(offset, batch_size));
+      RETURN_NOT_OK(WriteBufferedColumns(columns, offset, batch_size));
       offset += batch_size;
 
       // Flush current row group if it is full.
@@ -472,12 +462,47 @@ class FileWriterImpl : public FileWriter {
  private:
   friend class FileWriter;
 
+  // Write rows [offset, offset + size) of `columns` to the current buffered row
+  // group. With use_threads, the column chunks are encoded and compressed in
+  // parallel, each with its own write context.
+  Status WriteBufferedColumns(const ::arrow::ChunkedArrayVector& columns, int64_t offset,
+                              int64_t size) {
+    std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers;
+    int column_index_start = 0;
+
+    for (const auto& column : columns) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::unique_ptr<ArrowColumnWriterV2> writer,
+          ArrowColumnWriterV2::Make(*column, offset, size, schema_manifest_,
+                                    row_group_writer_, column_index_start));
+      column_index_start += writer->leaf_count();
+      if (arrow_properties_->use_threads()) {
+        writers.emplace_back(std::move(writer));
+      } else {
+        RETURN_NOT_OK(writer->Write(&column_write_context_));
+      }
+    }
+
+    if (arrow_properties_->use_threads()) {
+      DCHECK_EQ(parallel_column_write_contexts_.size(), writers.size());
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          static_cast<int>(writers.size()),
+          [&](int i) { return writers[i]->Write(&parallel_column_write_contexts_[i]); },
+          arrow_properties_->executor()));
+    }
+
+    return Status::OK();
+  }
+
   std::shared_ptr<::arrow::Schema> schema_;
 
   SchemaManifest schema_manifest_;
 
   std::unique_ptr<ParquetFileWriter> writer_;
   RowGroupWriter* row_group_writer_;
+  // Set when WriteTable has closed row_group_writer_ early, so that it takes no
+  // more rows.
+  bool row_group_writer_closed_ = false;
   ArrowWriteContext column_write_context_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
   bool closed_;
@@ -17,13 +17,20 @@
 
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/result.h"
 #include "arrow/util/logging.h"
 #include "generated/parquet_types.h"
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/properties.h"
+#include "parquet/schema.h"
 #include "parquet/thrift_internal.h"
 #include "parquet/xxhasher.h"
 
@@ -227,4 +234,156 @@ void BlockSplitBloomFilter::InsertHash(uint64_t hash) {
   }
 }
 
+namespace {
+
+class RowGroupBloomFilterReaderImpl : public RowGroupBloomFilterReader {
+ public:
+  RowGroupBloomFilterReaderImpl(std::shared_ptr<ArrowInputFile> input,
+                                std::shared_ptr<RowGroupMetaData> row_group_metadata,
+                                const ReaderProperties& properties)
+      : input_(std::move(input)),
+        row_group_metadata_(std::move(row_group_metadata)),
+        properties_(properties) {}
+
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    if (i < 0 || i >= row_group_metadata_->num_columns()) {
+      throw ParquetException("Invalid column index at column ordinal ", i);
+    }
+    auto col_chunk = row_group_metadata_->ColumnChunk(i);
+    const std::optional<int64_t> bloom_filter_offset = col_chunk->bloom_filter_offset();
+    if (!bloom_filter_offset.has_value()) {
+      return nullptr;
+    }
+    if (col_chunk->crypto_metadata() != nullptr) {
+      ParquetException::NYI("Reading bloom filter of encrypted columns");
+    }
+    PARQUET_ASSIGN_OR_THROW(const int64_t file_size, input_->GetSize());
+    if (*bloom_filter_offset < 0 || *bloom_filter_offset >= file_size) {
+      throw ParquetException("Invalid bloom filter offset ", *bloom_filter_offset,
+                             " for column ordinal ", i);
+    }
+    // The bloom filter length is not recorded in the metadata, so read lazily up to
+    // the end of the file: Deserialize() only consumes the header and the bitset.
+    PARQUET_ASSIGN_OR_THROW(
+        auto stream,
+        ::arrow::io::RandomAccessFile::GetStream(input_, *bloom_filter_offset,
+                                                 file_size - *bloom_filter_offset));
+    return std::make_unique<BlockSplitBloomFilter>(
+        BlockSplitBloomFilter::Deserialize(properties_, stream.get()));
+  }
+
+ private:
+  std::shared_ptr<ArrowInputFile> input_;
+  std::shared_ptr<RowGroupMetaData> row_group_metadata_;
+  const ReaderProperties& properties_;
+};
+
+class BloomFilterReaderImpl : public BloomFilterReader {
+ public:
+  BloomFilterReaderImpl(std::shared_ptr<ArrowInputFile> input,
+                        std::shared_ptr<FileMetaData> file_metadata,
+                        const ReaderProperties& properties)
+      : input_(std::move(input)),
+        file_metadata_(std::move(file_metadata)),
+        properties_(properties) {}
+
+  std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) override {
+    if (i < 0 || i >= file_metadata_->num_row_groups()) {
+      throw ParquetException("Invalid row group ordinal: ", i);
+    }
+    std::shared_ptr<RowGroupMetaData> row_group_metadata = file_metadata_->RowGroup(i);
+    return std::make_shared<RowGroupBloomFilterReaderImpl>(
+        input_, std::move(row_group_metadata), properties_);
+  }
+
+ private:
+  std::shared_ptr<ArrowInputFile> input_;
+  std::shared_ptr<FileMetaData> file_metadata_;
+  const ReaderProperties& properties_;
+};
+
+class BloomFilterBuilderImpl : public BloomFilterBuilder {
+ public:
+  BloomFilterBuilderImpl(const SchemaDescriptor* schema,
+                         const WriterProperties* properties)
+      : schema_(schema), properties_(properties) {}
+
+  void AppendRowGroup() override {
+    if (finished_) {
+      throw ParquetException(
+          "Cannot call AppendRowGroup() to finished BloomFilterBuilder.");
+    }
+    file_bloom_filters_.emplace_back();
+  }
+
+  BloomFilter* GetOrCreateBloomFilter(int32_t i) override {
+    if (finished_) {
+      throw ParquetException("BloomFilterBuilder is already finished.");
+    }
+    if (i < 0 || i >= schema_->num_columns()) {
+      throw ParquetException("Invalid column ordinal: ", i);
+    }
+    if (file_bloom_filters_.empty()) {
+      throw ParquetException("No row group appended to BloomFilterBuilder.");
+    }
+    const ColumnDescriptor* descr = schema_->Column(i);
+    if (descr->physical_type() == Type::BOOLEAN) {
+      return nullptr;
+    }
+    const auto& options = properties_->bloom_filter_options(descr->path());
+    if (!options.has_value()) {
+      return nullptr;
+    }
+    auto& row_group_bloom_filters = file_bloom_filters_.back();
+    auto iter = row_group_bloom_filters.find(i);
+    if (iter == row_group_bloom_filters.end()) {
+      auto bloom_filter =
+          std::make_unique<BlockSplitBloomFilter>(properties_->memory_pool());
+      bloom_filter->Init(BlockSplitBloomFilter::OptimalNumOfBytes(
+          static_cast<uint32_t>(options->ndv), options->fpp));
+      iter = row_group_bloom_filters.emplace(i, std::move(bloom_filter)).first;
+    }
+    return iter->second.get();
+  }
+
+  void WriteTo(ArrowOutputStream* sink, BloomFilterLocation* location) override {
+    finished_ = true;
+    for (size_t row_group = 0; row_group < file_bloom_filters_.size(); ++row_group) {
+      const auto& row_group_bloom_filters = file_bloom_filters_[row_group];
+      if (row_group_bloom_filters.empty()) {
+        continue;
+      }
+      BloomFilterLocation::RowGroupBloomFilterLocation row_group_location(
+          schema_->num_columns());
+      for (const auto& [column, bloom_filter] : row_group_bloom_filters) {
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+        bloom_filter->WriteTo(sink);
+        row_group_location[column] = offset;
+      }
+      location->bloom_filter_location.emplace(row_group, std::move(row_group_location));
+    }
+  }
+
+ private:
+  const SchemaDescriptor* schema_;
+  const WriterProperties* properties_;
+  bool finished_ = false;
+  // Bloom filters of each row group, keyed by column ordinal.
+  std::vector<std::map<int32_t, std::unique_ptr<BloomFilter>>> file_bloom_filters_;
+};
+
+}  // namespace
+
+std::unique_ptr<BloomFilterReader> BloomFilterReader::Make(
+    std::shared_ptr<ArrowInputFile> input, std::shared_ptr<FileMetaData> file_metadata,
+    const ReaderProperties& properties) {
+  return std::make_unique<BloomFilterReaderImpl>(std::move(input),
+                                                 std::move(file_metadata), properties);
+}
+
+std::unique_ptr<BloomFilterBuilder> BloomFilterBuilder::Make(
+    const SchemaDescriptor* schema, const WriterProperties* properties) {
+  return std::make_unique<BloomFilterBuilderImpl>(schema, properties);
+}
+
 }  // namespace parquet
@@ -19,16 +19,21 @@
 
 #include <cmath>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <vector>
 
 #include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 #include "parquet/hasher.h"
 #include "parquet/platform.h"
+#include "parquet/type_fwd.h"
 #include "parquet/types.h"
 
 namespace parquet {
 
+struct BloomFilterLocation;
+
 // A Bloom filter is a compact structure to indicate whether an item is not in a set or
 // probably in a set. The Bloom filter usually consists of a bit set that represents a
 // set of elements, a hash strategy and a Bloom filter algorithm.
@@ -267,4 +272,67 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   std::unique_ptr<Hasher> hasher_;
 };
 
+/// Interface for reading the Bloom filters of the column chunks in a row group.
+class PARQUET_EXPORT RowGroupBloomFilterReader {
+ public:
+  virtual ~RowGroupBloomFilterReader() = default;
+
+  /// Read the Bloom filter of a column chunk.
+  ///
+  /// @param i the column ordinal.
+  /// @return the Bloom filter, or nullptr if the column chunk does not have one.
+  /// @throws ParquetException if the column ordinal is out of bound or the Bloom
+  /// filter cannot be read.
+  virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) = 0;
+};
+
+/// Interface for reading the Bloom filters of a Parquet file.
+class PARQUET_EXPORT BloomFilterReader {
+ public:
+  virtual ~BloomFilterReader() = default;
+
+  /// Create a BloomFilterReader instance. The returned reader keeps references to
+  /// all the input parameters, so it must not outlive the ParquetFileReader they
+  /// usually come from. Bloom filters of encrypted columns are not supported yet.
+  static std::unique_ptr<BloomFilterReader> Make(
+      std::shared_ptr<ArrowInputFile> input,
+      std::shared_ptr<FileMetaData> file_metadata, const ReaderProperties& properties);
+
+  /// Get the Bloom filter reader of a row group.
+  ///
+  /// @param i the row group ordinal.
+  /// @throws ParquetException if the row group ordinal is out of bound.
+  virtual std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) = 0;
+};
+
+/// Interface for collecting the Bloom filters of a Parquet file while it is written.
+class PARQUET_EXPORT BloomFilterBuilder {
+ public:
+  /// Create a BloomFilterBuilder. Bloom filters are built for the columns that have
+  /// BloomFilterOptions set in `properties`, except BOOLEAN columns.
+  static std::unique_ptr<BloomFilterBuilder> Make(const SchemaDescriptor* schema,
+                                                  const WriterProperties* properties);
+
+  virtual ~BloomFilterBuilder() = default;
+
+  /// Start a new row group.
+  virtual void AppendRowGroup() = 0;
+
+  /// Get the Bloom filter of a column chunk in the current row group, creating it
+  /// on first use.
+  ///
+  /// @param i the column ordinal.
+  /// @return the Bloom filter, owned by this builder, or nullptr if no Bloom filter
+  /// is written for the column.
+  virtual BloomFilter* GetOrCreateBloomFilter(int32_t i) = 0;
+
+  /// Serialize the Bloom filters of all row groups. No more row groups can be
+  /// appended afterwards.
+  ///
+  /// @param sink the output stream to write the Bloom filters.
+  /// @param location file offsets of the serialized Bloom filters, to be recorded
+  /// in the column chunk metadata.
+  virtual void WriteTo(ArrowOutputStream* sink, BloomFilterLocation* location) = 0;
+};
+
 }  // namespace parquet
@@ -27,12 +27,20 @@
 
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/bit_util.h"
 
 #include "parquet/bloom_filter.h"
+#include "parquet/column_writer.h"
 #include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/metadata.h"
 #include "parquet/platform.h"
+#include "parquet/properties.h"
+#include "parquet/schema.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
 #include "parquet/xxhasher.h"
@@ -335,5 +343,123 @@ TEST(XxHashTest, TestBloomFilter) {
   }
 }
 
+class TestWriteBloomFilter : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestWriteBloomFilter, RoundTrip) {
+  const bool buffered_row_group = GetParam();
+  constexpr int kNumRowGroups = 2;
+  constexpr int kRowsPerRowGroup = 1000;
+
+  schema::NodeVector fields = {schema::Int64("c1", Repetition::OPTIONAL),
+                               schema::ByteArray("c2"), schema::Int64("c3")};
+  auto schema_node = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  // Bloom filters are only written for c1 and c2
+  BloomFilterOptions options;
+  options.ndv = kRowsPerRowGroup;
+  options.fpp = 0.01;
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("c1", options)
+                        ->enable_bloom_filter("c2", options)
+                        ->build();
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema_node, properties);
+  std::vector<int16_t> def_levels(kRowsPerRowGroup);
+  std::vector<uint8_t> valid_bits(::arrow::bit_util::BytesForBits(kRowsPerRowGroup));
+  std::vector<int64_t> values;
+  std::vector<std::string> strings(kRowsPerRowGroup);
+  std::vector<ByteArray> byte_arrays(kRowsPerRowGroup);
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    values.clear();
+    for (int i = 0; i < kRowsPerRowGroup; ++i) {
+      // Every 7th row of c1 is null, its slot is still filled to test that only
+      // valid values are inserted
+      def_levels[i] = i % 7 == 0 ? 0 : 1;
+      ::arrow::bit_util::SetBitTo(valid_bits.data(), i, def_levels[i] == 1);
+      values.push_back(rg * kRowsPerRowGroup + i);
+      strings[i] = "value-" + std::to_string(rg * kRowsPerRowGroup + i);
+      byte_arrays[i] = ByteArray(strings[i]);
+    }
+    auto rg_writer = buffered_row_group ? file_writer->AppendBufferedRowGroup()
+                                        : file_writer->AppendRowGroup();
+    auto next_column = [&](int i) {
+      return buffered_row_group ? rg_writer->column(i) : rg_writer->NextColumn();
+    };
+    static_cast<Int64Writer*>(next_column(0))
+        ->WriteBatchSpaced(kRowsPerRowGroup, def_levels.data(), nullptr,
+                           valid_bits.data(), 0, values.data());
+    static_cast<ByteArrayWriter*>(next_column(1))
+        ->WriteBatch(kRowsPerRowGroup, nullptr, nullptr, byte_arrays.data());
+    static_cast<Int64Writer*>(next_column(2))
+        ->WriteBatch(kRowsPerRowGroup, nullptr, nullptr, values.data());
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto metadata = reader->metadata();
+  auto& bloom_filter_reader = reader->GetBloomFilterReader();
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    ARROW_SCOPED_TRACE("row group = ", rg);
+    auto rg_metadata = metadata->RowGroup(rg);
+    ASSERT_TRUE(rg_metadata->ColumnChunk(0)->bloom_filter_offset().has_value());
+    ASSERT_TRUE(rg_metadata->ColumnChunk(1)->bloom_filter_offset().has_value());
+    ASSERT_FALSE(rg_metadata->ColumnChunk(2)->bloom_filter_offset().has_value());
+
+    auto rg_bloom_filter_reader = bloom_filter_reader.RowGroup(rg);
+    auto int_filter = rg_bloom_filter_reader->GetColumnBloomFilter(0);
+    auto string_filter = rg_bloom_filter_reader->GetColumnBloomFilter(1);
+    ASSERT_NE(int_filter, nullptr);
+    ASSERT_NE(string_filter, nullptr);
+    ASSERT_EQ(rg_bloom_filter_reader->GetColumnBloomFilter(2), nullptr);
+    EXPECT_EQ(int_filter->GetBitsetSize(),
+              BlockSplitBloomFilter::OptimalNumOfBytes(options.ndv, options.fpp));
+
+    // Non-null values written to the row group are always found, values of the
+    // other row groups or nulled out mostly are not.
+    int false_positives = 0;
+    for (int i = 0; i < kRowsPerRowGroup; ++i) {
+      const int64_t value = rg * kRowsPerRowGroup + i;
+      const std::string string = "value-" + std::to_string(value);
+      const ByteArray byte_array(string);
+      EXPECT_TRUE(string_filter->FindHash(string_filter->Hash(&byte_array)));
+      if (i % 7 != 0) {
+        EXPECT_TRUE(int_filter->FindHash(int_filter->Hash(value)));
+      } else {
+        false_positives += int_filter->FindHash(int_filter->Hash(value));
+      }
+      const int64_t other_value = value + kNumRowGroups * kRowsPerRowGroup;
+      const std::string other_string = "value-" + std::to_string(other_value);
+      const ByteArray other_byte_array(other_string);
+      false_positives += int_filter->FindHash(int_filter->Hash(other_value));
+      false_positives += string_filter->FindHash(string_filter->Hash(&other_byte_array));
+    }
+    EXPECT_LT(false_positives, 100);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(BloomFilter, TestWriteBloomFilter, ::testing::Bool());
+
+TEST(TestBloomFilterBuilder, UnsupportedColumns) {
+  schema::NodeVector fields = {schema::Boolean("b")};
+  auto schema_node = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  SchemaDescriptor schema;
+  schema.Init(schema_node);
+  auto properties = WriterProperties::Builder().enable_bloom_filter()->build();
+  auto builder = BloomFilterBuilder::Make(&schema, properties.get());
+  builder->AppendRowGroup();
+  // BOOLEAN columns never get a bloom filter
+  ASSERT_EQ(builder->GetOrCreateBloomFilter(0), nullptr);
+  EXPECT_THROW(builder->GetOrCreateBloomFilter(1), ParquetException);
+
+  BloomFilterOptions invalid_options;
+  invalid_options.fpp = 1.0;
+  EXPECT_THROW(WriterProperties::Builder().enable_bloom_filter(invalid_options),
+               ParquetException);
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -18,9 +18,12 @@
 #include "parquet/column_reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <exception>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -40,9 +43,11 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/crc32.h"
+#include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/thread_pool.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption/encryption_internal.h"
@@ -237,6 +242,97 @@ void CheckNumValuesInHeader(int num_values) {
 // SerializedPageReader deserializes Thrift metadata and pages that have been
 // assembled in a serialized stream for storing in a Parquet files
 
+// Decompress a page into `decompression_buffer`. The first `levels_byte_len`
+// bytes (the levels of a data page V2) are not compressed and copied as-is.
+std::shared_ptr<Buffer> DecompressPage(
+    ::arrow::util::Codec* codec, const Buffer& page_buffer, int compressed_len,
+    int uncompressed_len, int levels_byte_len,
+    std::shared_ptr<ResizableBuffer> decompression_buffer) {
+  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
+    throw ParquetException("Invalid page header");
+  }
+
+  // Grow the uncompressed buffer if we need to.
+  if (uncompressed_len > static_cast<int>(decompression_buffer->size())) {
+    PARQUET_THROW_NOT_OK(
+        decompression_buffer->Resize(uncompressed_len, /*shrink_to_fit=*/false));
+  }
+
+  if (levels_byte_len > 0) {
+    // First copy the levels as-is
+    uint8_t* decompressed = decompression_buffer->mutable_data();
+    memcpy(decompressed, page_buffer.data(), levels_byte_len);
+  }
+
+  // Decompress the values
+  PARQUET_THROW_NOT_OK(codec->Decompress(
+      compressed_len - levels_byte_len, page_buffer.data() + levels_byte_len,
+      uncompressed_len - levels_byte_len,
+      decompression_buffer->mutable_data() + levels_byte_len));
+
+  return decompression_buffer;
+}
+
+// A page read (and decrypted) from the stream, whose contents may still need
+// to be decompressed before the page can be handed to the decoder
+struct CompressedPage {
+  std::shared_ptr<Buffer> buffer;
+  int compressed_len = 0;
+  int uncompressed_len = 0;
+  int levels_byte_len = 0;
+  bool needs_decompression = false;
+  // Build the page from its decompressed contents
+  std::function<std::shared_ptr<Page>(std::shared_ptr<Buffer>)> make_page;
+};
+
+// A page decompressed ahead of the decoder on the CPU thread pool.
+//
+// The decoder may itself be running on the CPU thread pool, so it must never
+// block on a task that is queued behind it: whichever of the pool task and the
+// decoder gets to the page first decompresses it.
+class PendingPage {
+ public:
+  PendingPage(CompressedPage page, Compression::type codec, MemoryPool* pool)
+      : page_(std::move(page)),
+        codec_(codec),
+        pool_(pool),
+        decompressed_(::arrow::Future<std::shared_ptr<Page>>::Make()) {}
+
+  void Run() {
+    if (started_.exchange(true)) {
+      return;
+    }
+    decompressed_.MarkFinished(Decompress());
+  }
+
+  std::shared_ptr<Page> Wait() {
+    Run();
+    PARQUET_ASSIGN_OR_THROW(auto page, decompressed_.result());
+    return page;
+  }
+
+ private:
+  ::arrow::Result<std::shared_ptr<Page>> Decompress() {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    std::shared_ptr<Buffer> buffer = std::move(page_.buffer);
+    if (page_.needs_decompression) {
+      // Codecs keep state across calls, so each page gets its own
+      std::unique_ptr<::arrow::util::Codec> decompressor = GetCodec(codec_);
+      buffer = DecompressPage(decompressor.get(), *buffer, page_.compressed_len,
+                              page_.uncompressed_len, page_.levels_byte_len,
+                              AllocateBuffer(pool_, 0));
+    }
+    return page_.make_page(std::move(buffer));
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  CompressedPage page_;
+  const Compression::type codec_;
+  MemoryPool* pool_;
+  std::atomic<bool> started_{false};
+  ::arrow::Future<std::shared_ptr<Page>> decompressed_;
+};
+
 // This subclass delimits pages appearing in a serialized stream, each preceded
 // by a serialized Thrift format::PageHeader indicating the type of each page
 // and the page metadata.
@@ -257,8 +353,13 @@ class SerializedPageReader : public PageReader {
       InitDecryption();
     }
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
+    codec_ = codec;
     decompressor_ = GetCodec(codec);
     always_compressed_ = always_compressed;
+    // There is nothing to run ahead of the decoder for uncompressed pages
+    if (decompressor_ != nullptr) {
+      decompression_readahead_ = std::max(properties_.page_decompression_readahead(), 0);
+    }
   }
 
   // Implement the PageReader interface
@@ -266,12 +367,22 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  bool stable_page_buffers() const override {
+    // Pages decompressed or decrypted on the decoding thread share a buffer
+    return decompression_readahead_ > 0 ||
+           (decompressor_ == nullptr && crypto_ctx_.data_decryptor == nullptr);
+  }
+
  private:
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         std::string* page_aad);
 
   void InitDecryption();
 
+  // Read the next page to return from the stream, leaving its decompression to
+  // the caller. Returns false at the end of the column chunk.
+  bool ReadCompressedPage(CompressedPage* page);
+
   std::shared_ptr<Buffer> DecompressIfNeeded(std::shared_ptr<Buffer> page_buffer,
                                              int compressed_len, int uncompressed_len,
                                              int levels_byte_len = 0);
@@ -288,9 +399,14 @@ class SerializedPageReader : public PageReader {
   std::shared_ptr<Page> current_page_;
 
   // Compression codec to use.
+  Compression::type codec_;
   std::unique_ptr<::arrow::util::Codec> decompressor_;
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
 
+  // Pages being decompressed ahead of the decoder, in stream order
+  int32_t decompression_readahead_ = 0;
+  std::deque<std::shared_ptr<PendingPage>> pending_pages_;
+
   bool always_compressed_;
 
   // The fields below are used for calculation of AAD (additional authenticated data)
@@ -367,6 +483,8 @@ bool SerializedPageReader::ShouldSkipPage(EncodedStatistics* data_page_statistic
       DataPageStats data_page_stats(filter_statistics, header.num_values,
                                     /*num_rows=*/std::nullopt);
       if (data_page_filter_(data_page_stats)) {
+        // Skipped pages still count towards the ordinal used for decryption
+        ++page_ordinal_;
         return true;
       }
     }
@@ -388,6 +506,8 @@ bool SerializedPageReader::ShouldSkipPage(EncodedStatistics* data_page_statistic
       DataPageStats data_page_stats(filter_statistics, header.num_values,
                                     header.num_rows);
       if (data_page_filter_(data_page_stats)) {
+        // Skipped pages still count towards the ordinal used for decryption
+        ++page_ordinal_;
         return true;
       }
     }
@@ -404,6 +524,41 @@ bool SerializedPageReader::ShouldSkipPage(EncodedStatistics* data_page_statistic
 }
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  if (decompression_readahead_ == 0) {
+    CompressedPage page;
+    if (!ReadCompressedPage(&page)) {
+      return std::shared_ptr<Page>(nullptr);
+    }
+    if (page.needs_decompression) {
+      page.buffer = DecompressIfNeeded(std::move(page.buffer), page.compressed_len,
+                                       page.uncompressed_len, page.levels_byte_len);
+    }
+    return page.make_page(std::move(page.buffer));
+  }
+
+  // Keep the readahead window full. Headers, checksums and decryption are
+  // handled here, in stream order; only the decompression is handed off.
+  while (static_cast<int32_t>(pending_pages_.size()) < decompression_readahead_) {
+    CompressedPage page;
+    if (!ReadCompressedPage(&page)) {
+      break;
+    }
+    auto pending = std::make_shared<PendingPage>(std::move(page), codec_,
+                                                 properties_.memory_pool());
+    pending_pages_.push_back(pending);
+    // If the task can't be spawned, Wait() decompresses the page inline
+    ARROW_UNUSED(::arrow::internal::GetCpuThreadPool()->Spawn(
+        [pending]() { pending->Run(); }));
+  }
+  if (pending_pages_.empty()) {
+    return std::shared_ptr<Page>(nullptr);
+  }
+  std::shared_ptr<PendingPage> pending = std::move(pending_pages_.front());
+  pending_pages_.pop_front();
+  return pending->Wait();
+}
+
+bool SerializedPageReader::ReadCompressedPage(CompressedPage* page) {
   ThriftDeserializer deserializer(properties_);
 
   // Loop here because there may be unhandled page types that we skip until
@@ -418,7 +573,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     while (true) {
       PARQUET_ASSIGN_OR_THROW(auto view, stream_->Peek(allowed_page_size));
       if (view.size() == 0) {
-        return std::shared_ptr<Page>(nullptr);
+        return false;
       }
 
       // This gets used, then set by DeserializeThriftMsg
@@ -488,38 +643,55 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     // Decrypt it if we need to
     if (crypto_ctx_.data_decryptor != nullptr) {
-      PARQUET_THROW_NOT_OK(decryption_buffer_->Resize(
+      // Pages decompressed ahead of the decoder can't share a decryption buffer
+      std::shared_ptr<ResizableBuffer> decryption_buffer =
+          decompression_readahead_ > 0 ? AllocateBuffer(properties_.memory_pool(), 0)
+                                       : decryption_buffer_;
+      PARQUET_THROW_NOT_OK(decryption_buffer->Resize(
           compressed_len - crypto_ctx_.data_decryptor->CiphertextSizeDelta(),
           /*shrink_to_fit=*/false));
       compressed_len = crypto_ctx_.data_decryptor->Decrypt(
-          page_buffer->data(), compressed_len, decryption_buffer_->mutable_data());
+          page_buffer->data(), compressed_len, decryption_buffer->mutable_data());
 
-      page_buffer = decryption_buffer_;
+      page_buffer = std::move(decryption_buffer);
     }
 
+    page->buffer = std::move(page_buffer);
+    page->compressed_len = compressed_len;
+    page->uncompressed_len = uncompressed_len;
+
     if (page_type == PageType::DICTIONARY_PAGE) {
       crypto_ctx_.start_decrypt_with_dictionary_page = false;
       const format::DictionaryPageHeader& dict_header =
           current_page_header_.dictionary_page_header;
       bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
-
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
-                                              LoadEnumSafe(&dict_header.encoding),
-                                              is_sorted);
+      const int32_t num_values = dict_header.num_values;
+      const Encoding::type encoding = LoadEnumSafe(&dict_header.encoding);
+
+      page->needs_decompression = true;
+      page->make_page = [=](std::shared_ptr<Buffer> buffer) {
+        return std::make_shared<DictionaryPage>(std::move(buffer), num_values, encoding,
+                                                is_sorted);
+      };
+      return true;
     } else if (page_type == PageType::DATA_PAGE) {
       ++page_ordinal_;
       const format::DataPageHeader& header = current_page_header_.data_page_header;
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DataPageV1>(page_buffer, header.num_values,
-                                          LoadEnumSafe(&header.encoding),
-                                          LoadEnumSafe(&header.definition_level_encoding),
-                                          LoadEnumSafe(&header.repetition_level_encoding),
-                                          uncompressed_len, data_page_statistics);
+      const int32_t num_values = header.num_values;
+      const Encoding::type encoding = LoadEnumSafe(&header.encoding);
+      const Encoding::type definition_level_encoding =
+          LoadEnumSafe(&header.definition_level_encoding);
+      const Encoding::type repetition_level_encoding =
+          LoadEnumSafe(&header.repetition_level_encoding);
+
+      page->needs_decompression = true;
+      page->make_page = [=](std::shared_ptr<Buffer> buffer) {
+        return std::make_shared<DataPageV1>(std::move(buffer), num_values, encoding,
+                                            definition_level_encoding,
+                                            repetition_level_encoding, uncompressed_len,
+                                            data_page_statistics);
+      };
+      return true;
     } else if (page_type == PageType::DATA_PAGE_V2) {
       ++page_ordinal_;
       const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
@@ -535,24 +707,30 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
                           header.repetition_levels_byte_length, &levels_byte_len)) {
         throw ParquetException("Levels size too large (corrupt file?)");
       }
+      const int32_t num_values = header.num_values;
+      const int32_t num_nulls = header.num_nulls;
+      const int32_t num_rows = header.num_rows;
+      const Encoding::type encoding = LoadEnumSafe(&header.encoding);
+      const int32_t definition_levels_byte_length = header.definition_levels_byte_length;
+      const int32_t repetition_levels_byte_length = header.repetition_levels_byte_length;
+
       // DecompressIfNeeded doesn't take `is_compressed` into account as
       // it's page type-agnostic.
-      if (is_compressed) {
-        page_buffer = DecompressIfNeeded(std::move(page_buffer), compressed_len,
-                                         uncompressed_len, levels_byte_len);
-      }
-
-      return std::make_shared<DataPageV2>(
-          page_buffer, header.num_values, header.num_nulls, header.num_rows,
-          LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
-          header.repetition_levels_byte_length, uncompressed_len, is_compressed,
-          data_page_statistics);
+      page->needs_decompression = is_compressed;
+      page->levels_byte_len = levels_byte_len;
+      page->make_page = [=](std::shared_ptr<Buffer> buffer) {
+        return std::make_shared<DataPageV2>(
+            std::move(buffer), num_values, num_nulls, num_rows, encoding,
+            definition_levels_byte_length, repetition_levels_byte_length,
+            uncompressed_len, is_compressed, data_page_statistics);
+      };
+      return true;
     } else {
       throw ParquetException(
           "Internal error, we have already skipped non-data pages in ShouldSkipPage()");
     }
   }
-  return std::shared_ptr<Page>(nullptr);
+  return false;
 }
 
 std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
@@ -561,29 +739,8 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
   if (decompressor_ == nullptr) {
     return page_buffer;
   }
-  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
-    throw ParquetException("Invalid page header");
-  }
-
-  // Grow the uncompressed buffer if we need to.
-  if (uncompressed_len > static_cast<int>(decompression_buffer_->size())) {
-    PARQUET_THROW_NOT_OK(
-        decompression_buffer_->Resize(uncompressed_len, /*shrink_to_fit=*/false));
-  }
-
-  if (levels_byte_len > 0) {
-    // First copy the levels as-is
-    uint8_t* decompressed = decompression_buffer_->mutable_data();
-    memcpy(decompressed, page_buffer->data(), levels_byte_len);
-  }
-
-  // Decompress the values
-  PARQUET_THROW_NOT_OK(decompressor_->Decompress(
-      compressed_len - levels_byte_len, page_buffer->data() + levels_byte_len,
-      uncompressed_len - levels_byte_len,
-      decompression_buffer_->mutable_data() + levels_byte_len));
-
-  return decompression_buffer_;
+  return DecompressPage(decompressor_.get(), *page_buffer, compressed_len,
+                        uncompressed_len, levels_byte_len, decompression_buffer_);
 }
 
 }  // namespace
@@ -905,6 +1062,7 @@ class ColumnReaderImplBase {
       }
     }
     current_encoding_ = encoding;
+    current_values_offset_ = levels_byte_size;
     current_decoder_->SetData(static_cast<int>(num_buffered_values_), buffer,
                               static_cast<int>(data_size));
   }
@@ -943,6 +1101,8 @@ class ColumnReaderImplBase {
   using DecoderType = TypedDecoder<DType>;
   DecoderType* current_decoder_;
   Encoding::type current_encoding_;
+  // Offset of the encoded values in the current data page
+  int64_t current_values_offset_ = 0;
 
   /// Flag to signal when a new dictionary has been set, for the benefit of
   /// DictionaryRecordReader
@@ -1638,6 +1798,7 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
 
   std::shared_ptr<ResizableBuffer> ReleaseValues() override {
     if (uses_values_) {
+      MaterializeValues();
       auto result = values_;
       PARQUET_THROW_NOT_OK(
           result->Resize(bytes_for_values(values_written_), /*shrink_to_fit=*/true));
@@ -1649,6 +1810,13 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
     }
   }
 
+  std::shared_ptr<Buffer> ReleaseValuesZeroCopy() override {
+    if (values_in_place_ != nullptr) {
+      return std::move(values_in_place_);
+    }
+    return ReleaseValues();
+  }
+
   std::shared_ptr<ResizableBuffer> ReleaseIsValid() override {
     if (leaf_info_.HasNullableValues()) {
       auto result = valid_bits_;
@@ -1816,8 +1984,63 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
     CheckNumberDecoded(num_decoded, values_to_read);
   }
 
+  // Reference the next `num_values` values of the current data page in place,
+  // rather than decoding them into values_ (see set_zero_copy_values()).
+  // Returns false if they must be decoded.
+  bool ReadValuesInPlace(int64_t num_values) {
+    constexpr bool kIsNumeric =
+        std::is_same_v<DType, Int32Type> || std::is_same_v<DType, Int64Type> ||
+        std::is_same_v<DType, FloatType> || std::is_same_v<DType, DoubleType>;
+    if (!kIsNumeric || !zero_copy_values_ || read_dictionary_ || !uses_values_ ||
+        values_written_ > 0 || this->max_def_level_ > 0 || this->max_rep_level_ > 0 ||
+        this->current_encoding_ != Encoding::PLAIN ||
+        num_values > this->available_values_current_page() ||
+        !this->pager_->stable_page_buffers()) {
+      return false;
+    }
+    const int64_t offset = this->current_values_offset_ +
+                           this->num_decoded_values_ * static_cast<int64_t>(sizeof(T));
+    const int64_t length = num_values * static_cast<int64_t>(sizeof(T));
+    const int64_t page_size = this->current_page_->size();
+    const uint8_t* data = this->current_page_->data() + offset;
+    if (offset + length > page_size ||
+        reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+      // Let the decoder report truncated pages
+      return false;
+    }
+    values_in_place_ = SliceBuffer(this->current_page_->buffer(), offset, length);
+    // Move the decoder past the values referenced
+    this->current_decoder_->SetData(
+        static_cast<int>(this->available_values_current_page() - num_values),
+        data + length, static_cast<int>(page_size - offset - length));
+    return true;
+  }
+
+  // Copy the values referenced in place into values_, so that more values can be
+  // read after them
+  void MaterializeValues() {
+    if (values_in_place_ == nullptr) {
+      return;
+    }
+    if (values_capacity_ < values_written_) {
+      PARQUET_THROW_NOT_OK(values_->Resize(bytes_for_values(values_written_),
+                                           /*shrink_to_fit=*/false));
+      values_capacity_ = values_written_;
+    }
+    memcpy(values_->mutable_data(), values_in_place_->data(), values_in_place_->size());
+    values_in_place_.reset();
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(int64_t num_records) {
+    if (ReadValuesInPlace(num_records)) {
+      // Flat, non-repeated and required: each record is a single value
+      this->ConsumeBufferedValues(num_records);
+      values_written_ += num_records;
+      return num_records;
+    }
+    MaterializeValues();
+
     // Conservative upper bound
     const int64_t possible_num_values =
         std::max<int64_t>(num_records, levels_written_ - levels_position_);
@@ -1899,6 +2122,7 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
   }
 
   void ResetValues() {
+    values_in_place_.reset();
     if (values_written_ > 0) {
       // Resize to 0, but do not shrink to fit
       if (uses_values_) {
@@ -1917,6 +2141,8 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
   LevelInfo leaf_info_;
+  // Values of a data page referenced in place of values_, if any
+  std::shared_ptr<Buffer> values_in_place_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -2014,13 +2240,40 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
+// Arrow value type of the dictionaries read from a column of the given physical type
+std::shared_ptr<::arrow::DataType> DictionaryValueType(const ColumnDescriptor* descr) {
+  switch (descr->physical_type()) {
+    case Type::INT32:
+      return ::arrow::int32();
+    case Type::INT64:
+      return ::arrow::int64();
+    case Type::FLOAT:
+      return ::arrow::float32();
+    case Type::DOUBLE:
+      return ::arrow::float64();
+    case Type::BYTE_ARRAY:
+      return ::arrow::binary();
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return ::arrow::fixed_size_binary(descr->type_length());
+    default:
+      throw ParquetException("Cannot read dictionary-encoded Arrow arrays of type " +
+                             TypeToString(descr->physical_type()));
+  }
+}
+
+template <typename DType>
+class TypedDictionaryRecordReader : public TypedRecordReader<DType>,
+                                    virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool), builder_(pool) {
+  using BuilderType = typename EncodingTraits<DType>::DictAccumulator;
+
+  TypedDictionaryRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
+                              ::arrow::MemoryPool* pool)
+      : TypedRecordReader<DType>(descr, leaf_info, pool),
+        builder_(DictionaryValueType(descr), pool) {
     this->read_dictionary_ = true;
+    // Values go straight to the builder
+    this->uses_values_ = false;
   }
 
   std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
@@ -2034,6 +2287,15 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
     if (builder_.length() > 0) {
       std::shared_ptr<::arrow::Array> chunk;
       PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
+      // The builder materializes its dictionary anew on every Finish. As long as
+      // only the values of the dictionary page were memoized, share the buffers
+      // of that dictionary between all the chunks decoded with it instead.
+      if (dictionary_ != nullptr &&
+          chunk->data()->dictionary->length == dictionary_->length()) {
+        auto data = chunk->data()->Copy();
+        data->dictionary = dictionary_->data();
+        chunk = ::arrow::MakeArray(std::move(data));
+      }
       result_chunks_.emplace_back(std::move(chunk));
 
       // Also clears the dictionary memo table
@@ -2045,54 +2307,81 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
     if (this->new_dictionary_) {
       /// If there is a new dictionary, we may need to flush the builder, then
       /// insert the new dictionary values
-      FlushBuilder();
-      builder_.ResetFull();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      decoder->InsertDictionary(&builder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
+      BuilderType dictionary_builder(DictionaryValueType(this->descr_), this->pool_);
+      decoder->InsertDictionary(&dictionary_builder);
+      std::shared_ptr<::arrow::DictionaryArray> empty;
+      PARQUET_THROW_NOT_OK(dictionary_builder.Finish(&empty));
+      std::shared_ptr<::arrow::Array> dictionary = empty->dictionary();
+
+      // Row groups written with the same dictionary keep appending indices to
+      // the current chunk, so that they share a single dictionary. Floating-point
+      // values must be identical bit for bit, as they are in the memo table.
+      const auto equal_options =
+          ::arrow::EqualOptions::Defaults().nans_equal(true).signed_zeros_equal(false);
+      if (dictionary_ == nullptr || !dictionary_->Equals(*dictionary, equal_options)) {
+        FlushBuilder();
+        builder_.ResetFull();
+        PARQUET_THROW_NOT_OK(builder_.InsertMemoValues(*dictionary));
+        dictionary_ = std::move(dictionary);
+      }
+      // The memo table collapses duplicate values (and e.g. 0.0 and -0.0); if
+      // some values of the page dictionary collapsed, its indices don't match the
+      // memo and the values must be decoded instead.
+      const typename DType::c_type* page_dictionary = nullptr;
+      int32_t page_dictionary_length = 0;
+      decoder->GetDictionary(&page_dictionary, &page_dictionary_length);
+      indices_match_memo_ = builder_.dictionary_length() == page_dictionary_length;
       this->new_dictionary_ = false;
     }
   }
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+    }
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY && indices_match_memo_) {
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     CheckNumberDecoded(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+    }
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY && indices_match_memo_) {
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read - null_count);
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
-
-  ::arrow::BinaryDictionary32Builder builder_;
+  BuilderType builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
+  // The last dictionary inserted into the builder's memo table
+  std::shared_ptr<::arrow::Array> dictionary_;
+  // Whether the indices of dictionary_ are also those of the memo table
+  bool indices_match_memo_ = true;
 };
 
 // TODO(wesm): Implement these to some satisfaction
@@ -2110,12 +2399,25 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
                                                         ::arrow::MemoryPool* pool,
                                                         bool read_dictionary) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, leaf_info, pool);
+    return std::make_shared<TypedDictionaryRecordReader<ByteArrayType>>(descr, leaf_info,
+                                                                        pool);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, leaf_info, pool);
   }
 }
 
+template <typename DType, typename RecordReaderType = TypedRecordReader<DType>>
+std::shared_ptr<RecordReader> MakeRecordReader(const ColumnDescriptor* descr,
+                                               LevelInfo leaf_info,
+                                               ::arrow::MemoryPool* pool,
+                                               bool read_dictionary) {
+  if (read_dictionary) {
+    return std::make_shared<TypedDictionaryRecordReader<DType>>(descr, leaf_info, pool);
+  } else {
+    return std::make_shared<RecordReaderType>(descr, leaf_info, pool);
+  }
+}
+
 }  // namespace
 
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
@@ -2125,19 +2427,20 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, leaf_info, pool);
     case Type::INT32:
-      return std::make_shared<TypedRecordReader<Int32Type>>(descr, leaf_info, pool);
+      return MakeRecordReader<Int32Type>(descr, leaf_info, pool, read_dictionary);
     case Type::INT64:
-      return std::make_shared<TypedRecordReader<Int64Type>>(descr, leaf_info, pool);
+      return MakeRecordReader<Int64Type>(descr, leaf_info, pool, read_dictionary);
     case Type::INT96:
       return std::make_shared<TypedRecordReader<Int96Type>>(descr, leaf_info, pool);
     case Type::FLOAT:
-      return std::make_shared<TypedRecordReader<FloatType>>(descr, leaf_info, pool);
+      return MakeRecordReader<FloatType>(descr, leaf_info, pool, read_dictionary);
     case Type::DOUBLE:
-      return std::make_shared<TypedRecordReader<DoubleType>>(descr, leaf_info, pool);
+      return MakeRecordReader<DoubleType>(descr, leaf_info, pool, read_dictionary);
     case Type::BYTE_ARRAY:
       return MakeByteArrayRecordReader(descr, leaf_info, pool, read_dictionary);
     case Type::FIXED_LEN_BYTE_ARRAY:
-      return std::make_shared<FLBARecordReader>(descr, leaf_info, pool);
+      return MakeRecordReader<FLBAType, FLBARecordReader>(descr, leaf_info, pool,
+                                                          read_dictionary);
     default: {
       // PARQUET-1481: This can occur if the file is corrupt
       std::stringstream ss;
@@ -156,6 +156,12 @@ class PARQUET_EXPORT PageReader {
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
 
+  // @returns: whether the buffer of a page returned by NextPage() stays valid
+  // and unchanged after the following pages are read. If false, the page
+  // reader may reuse the buffer, for example to decompress the next page.
+  // \note API EXPERIMENTAL
+  virtual bool stable_page_buffers() const { return false; }
+
  protected:
   // Callback that decides if we should skip a page or not.
   DataPageFilter data_page_filter_;
@@ -338,6 +344,24 @@ class PARQUET_EXPORT RecordReader {
   /// allocated in subsequent ReadRecords calls
   virtual std::shared_ptr<ResizableBuffer> ReleaseValues() = 0;
 
+  /// \brief Transfer the values to caller like ReleaseValues(), but as a slice
+  /// of the data page they were read from if they were not copied out of it
+  /// (see set_zero_copy_values()).
+  virtual std::shared_ptr<Buffer> ReleaseValuesZeroCopy() { return ReleaseValues(); }
+
+  /// \brief Allow ReadRecords to reference the values of PLAIN-encoded data
+  /// pages in place rather than copying them, when the column is INT32, INT64,
+  /// FLOAT or DOUBLE, required and not repeated, the values are suitably
+  /// aligned, and the page reader does not reuse page buffers (such as for
+  /// uncompressed pages read from memory). Only the values of a single page
+  /// can be referenced between calls to Reset().
+  ///
+  /// While values are referenced in place, values() is not valid: they must be
+  /// taken with ReleaseValuesZeroCopy() (ReleaseValues() copies them).
+  void set_zero_copy_values(bool zero_copy_values) {
+    zero_copy_values_ = zero_copy_values;
+  }
+
   /// \brief Transfer filled validity bitmap buffer to caller. A new one will
   /// be allocated in subsequent ReadRecords calls
   virtual std::shared_ptr<ResizableBuffer> ReleaseIsValid() = 0;
@@ -434,6 +458,7 @@ class PARQUET_EXPORT RecordReader {
   int64_t levels_capacity_;
 
   bool read_dictionary_ = false;
+  bool zero_copy_values_ = false;
 };
 
 class BinaryRecordReader : virtual public RecordReader {
@@ -442,7 +467,8 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Only valid for INT32, INT64, FLOAT, DOUBLE, BYTE_ARRAY and
+/// FIXED_LEN_BYTE_ARRAY columns
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
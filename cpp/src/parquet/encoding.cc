@@ -18,6 +18,7 @@
 #include "parquet/encoding.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
@@ -43,6 +44,7 @@
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visit_data_inline.h"
 #include "parquet/exception.h"
@@ -1552,9 +1554,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
         valid_bits, valid_bits_offset, num_values, null_count,
         [&]() { valid_bytes[i++] = 1; }, [&]() { ++i; });
 
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendIndices(builder, indices_buffer, num_values, valid_bytes.data());
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1573,8 +1573,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendIndices(builder, indices_buffer, num_values);
     num_values_ -= num_values;
     return num_values;
   }
@@ -1593,6 +1592,10 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   }
 
  protected:
+  // Append indices to the Arrow dictionary builder for this type
+  void AppendIndices(::arrow::ArrayBuilder* builder, const int32_t* indices,
+                     int64_t length, const uint8_t* valid_bytes = NULLPTR);
+
   Status IndexInBounds(int32_t index) {
     if (ARROW_PREDICT_TRUE(0 <= index && index < dictionary_length_)) {
       return Status::OK();
@@ -1832,9 +1835,60 @@ int DictDecoderImpl<Type>::DecodeArrow(
   return num_values - null_count;
 }
 
+template <typename Type>
+void DictDecoderImpl<Type>::AppendIndices(::arrow::ArrayBuilder* builder,
+                                          const int32_t* indices, int64_t length,
+                                          const uint8_t* valid_bytes) {
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+  PARQUET_THROW_NOT_OK(dict_builder->AppendIndices(indices, length, valid_bytes));
+}
+
+template <>
+void DictDecoderImpl<BooleanType>::AppendIndices(::arrow::ArrayBuilder* builder,
+                                                 const int32_t* indices, int64_t length,
+                                                 const uint8_t* valid_bytes) {
+  ParquetException::NYI("No dictionary encoding for BooleanType");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::AppendIndices(::arrow::ArrayBuilder* builder,
+                                               const int32_t* indices, int64_t length,
+                                               const uint8_t* valid_bytes) {
+  ParquetException::NYI("Dictionary indices of Int96Type");
+}
+
 template <typename Type>
 void DictDecoderImpl<Type>::InsertDictionary(::arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+  using ArrowType = typename EncodingTraits<Type>::ArrowType;
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+
+  // Make an array referencing the internal dictionary data
+  auto arr = std::make_shared<::arrow::NumericArray<ArrowType>>(dictionary_length_,
+                                                                dictionary_);
+  PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(*arr));
+}
+
+template <>
+void DictDecoderImpl<BooleanType>::InsertDictionary(::arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("No dictionary encoding for BooleanType");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::InsertDictionary(::arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("InsertDictionary for Int96Type");
+}
+
+template <>
+void DictDecoderImpl<FLBAType>::InsertDictionary(::arrow::ArrayBuilder* builder) {
+  auto fsb_builder = checked_cast<EncodingTraits<FLBAType>::DictAccumulator*>(builder);
+
+  // Make a FixedSizeBinaryArray referencing the internal dictionary data
+  auto arr = std::make_shared<::arrow::FixedSizeBinaryArray>(
+      ::arrow::fixed_size_binary(descr_->type_length()), dictionary_length_,
+      byte_array_data_);
+  PARQUET_THROW_NOT_OK(fsb_builder->InsertMemoValues(*arr));
 }
 
 template <>
@@ -2345,14 +2399,328 @@ void DeltaBitPackEncoder<DType>::PutSpaced(const T* src, int num_values,
   }
 }
 
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY encoder
+
+/// DeltaLengthByteArrayEncoder is an encoder for the DELTA_LENGTH_BYTE_ARRAY format
+/// as per the parquet spec. See:
+/// https://github.com/apache/parquet-format/blob/master/Encodings.md#delta-length-byte-array-delta_length_byte_array--6
+///
+/// The lengths of all values are written first using DELTA_BINARY_PACKED, followed
+/// by the concatenated value bytes. Lengths are handed to the length encoder in
+/// batches so that the value bytes can be appended in the same pass.
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool) {}
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + length_encoder_.EstimatedDataEncodedSize();
+  }
+
+  void Put(const ::arrow::Array& values) override;
+
+  void Put(const ByteArray* src, int num_values) override;
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ protected:
+  static constexpr int kBatchSize = 256;
+
+  template <typename ArrayType>
+  void PutBinaryArray(const ArrayType& array) {
+    const int64_t total_bytes =
+        array.value_offset(array.length()) - array.value_offset(0);
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_bytes));
+
+    std::array<int32_t, kBatchSize> lengths;
+    int num_lengths = 0;
+    PARQUET_THROW_NOT_OK(::arrow::VisitArraySpanInline<typename ArrayType::TypeClass>(
+        *array.data(),
+        [&](::std::string_view view) {
+          if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+            return Status::Invalid("Parquet cannot store strings with size 2GB or more");
+          }
+          lengths[num_lengths++] = static_cast<int32_t>(view.size());
+          if (num_lengths == kBatchSize) {
+            length_encoder_.Put(lengths.data(), num_lengths);
+            num_lengths = 0;
+          }
+          sink_.UnsafeAppend(view.data(), static_cast<int64_t>(view.size()));
+          return Status::OK();
+        },
+        []() { return Status::OK(); }));
+    length_encoder_.Put(lengths.data(), num_lengths);
+  }
+
+  ::arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+};
+
+void DeltaLengthByteArrayEncoder::Put(const ::arrow::Array& values) {
+  AssertBaseBinary(values);
+
+  if (::arrow::is_binary_like(values.type_id())) {
+    PutBinaryArray(checked_cast<const ::arrow::BinaryArray&>(values));
+  } else {
+    DCHECK(::arrow::is_large_binary_like(values.type_id()));
+    PutBinaryArray(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+  }
+}
+
+void DeltaLengthByteArrayEncoder::Put(const ByteArray* src, int num_values) {
+  std::array<int32_t, kBatchSize> lengths;
+  for (int idx = 0; idx < num_values; idx += kBatchSize) {
+    const int batch_size = std::min(kBatchSize, num_values - idx);
+    int64_t total_bytes = 0;
+    for (int j = 0; j < batch_size; ++j) {
+      const uint32_t len = src[idx + j].len;
+      if (ARROW_PREDICT_FALSE(len > kMaxByteArraySize)) {
+        throw ParquetException("Parquet cannot store strings with size 2GB or more");
+      }
+      lengths[j] = static_cast<int32_t>(len);
+      total_bytes += len;
+    }
+    length_encoder_.Put(lengths.data(), batch_size);
+
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_bytes));
+    for (int j = 0; j < batch_size; ++j) {
+      sink_.UnsafeAppend(src[idx + j].ptr, src[idx + j].len);
+    }
+  }
+}
+
+void DeltaLengthByteArrayEncoder::PutSpaced(const ByteArray* src, int num_values,
+                                            const uint8_t* valid_bits,
+                                            int64_t valid_bits_offset) {
+  if (valid_bits != NULLPTR) {
+    PARQUET_ASSIGN_OR_THROW(
+        auto buffer,
+        ::arrow::AllocateBuffer(num_values * sizeof(ByteArray), this->memory_pool()));
+    auto data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+    int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  } else {
+    Put(src, num_values);
+  }
+}
+
+std::shared_ptr<Buffer> DeltaLengthByteArrayEncoder::FlushValues() {
+  std::shared_ptr<Buffer> encoded_lengths = length_encoder_.FlushValues();
+  std::shared_ptr<Buffer> data;
+  PARQUET_THROW_NOT_OK(sink_.Finish(&data));
+
+  PARQUET_ASSIGN_OR_THROW(auto buffer,
+                          ::arrow::ConcatenateBuffers({encoded_lengths, data}, pool_));
+  return buffer;
+}
+
+// ----------------------------------------------------------------------
+// DELTA_BYTE_ARRAY encoder
+
+/// DeltaByteArrayEncoder is an encoder for the DELTA_BYTE_ARRAY format (incremental
+/// encoding) as per the parquet spec. See:
+/// https://github.com/apache/parquet-format/blob/master/Encodings.md#delta-strings-delta_byte_array--7
+///
+/// For each value, the length of the prefix it shares with the previous value is
+/// written using DELTA_BINARY_PACKED, and the remaining suffix using
+/// DELTA_LENGTH_BYTE_ARRAY. The first value of a page has no predecessor, so the
+/// previous value is reset whenever the encoded values are flushed.
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr, MemoryPool* pool)
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  void Put(const ::arrow::Array& values) override;
+
+  void Put(const ByteArray* src, int num_values) override;
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ private:
+  static constexpr int kBatchSize = 256;
+
+  // Calls `visit_values` with a callback that must be invoked on every non-null
+  // value, in order. Prefix lengths and suffixes are accumulated in small batches
+  // before being handed to the nested encoders. Suffixes point into the caller's
+  // data, which stays alive for the duration of the call.
+  template <typename VisitValues>
+  void PutValues(VisitValues&& visit_values) {
+    std::array<int32_t, kBatchSize> prefix_lengths;
+    std::array<ByteArray, kBatchSize> suffixes;
+    int num_batched = 0;
+    int64_t num_values = 0;
+    ::std::string_view previous{last_value_};
+
+    auto flush_batch = [&]() {
+      prefix_length_encoder_.Put(prefix_lengths.data(), num_batched);
+      suffix_encoder_.Put(suffixes.data(), num_batched);
+      num_batched = 0;
+    };
+
+    visit_values([&](::std::string_view view) {
+      if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+        throw ParquetException("Parquet cannot store strings with size 2GB or more");
+      }
+      const size_t max_prefix = std::min(view.size(), previous.size());
+      const char* mismatch =
+          std::mismatch(view.data(), view.data() + max_prefix, previous.data()).first;
+      const auto prefix_length = static_cast<uint32_t>(mismatch - view.data());
+
+      prefix_lengths[num_batched] = static_cast<int32_t>(prefix_length);
+      suffixes[num_batched] = view.substr(prefix_length);
+      previous = view;
+      ++num_values;
+      if (++num_batched == kBatchSize) {
+        flush_batch();
+      }
+    });
+    flush_batch();
+
+    // The input may be released after this call, so keep a copy of the last value
+    if (num_values > 0) {
+      last_value_.assign(previous.data(), previous.size());
+    }
+  }
+
+  template <typename ArrayType>
+  void PutBinaryArray(const ArrayType& array) {
+    PutValues([&](auto&& put_value) {
+      PARQUET_THROW_NOT_OK(::arrow::VisitArraySpanInline<typename ArrayType::TypeClass>(
+          *array.data(),
+          [&](::std::string_view view) {
+            put_value(view);
+            return Status::OK();
+          },
+          []() { return Status::OK(); }));
+    });
+  }
+
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
+void DeltaByteArrayEncoder::Put(const ::arrow::Array& values) {
+  AssertBaseBinary(values);
+
+  if (::arrow::is_binary_like(values.type_id())) {
+    PutBinaryArray(checked_cast<const ::arrow::BinaryArray&>(values));
+  } else {
+    DCHECK(::arrow::is_large_binary_like(values.type_id()));
+    PutBinaryArray(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+  }
+}
+
+void DeltaByteArrayEncoder::Put(const ByteArray* src, int num_values) {
+  PutValues([&](auto&& put_value) {
+    for (int i = 0; i < num_values; ++i) {
+      put_value(::std::string_view{reinterpret_cast<const char*>(src[i].ptr), src[i].len});
+    }
+  });
+}
+
+void DeltaByteArrayEncoder::PutSpaced(const ByteArray* src, int num_values,
+                                      const uint8_t* valid_bits,
+                                      int64_t valid_bits_offset) {
+  if (valid_bits != NULLPTR) {
+    PARQUET_ASSIGN_OR_THROW(
+        auto buffer,
+        ::arrow::AllocateBuffer(num_values * sizeof(ByteArray), this->memory_pool()));
+    auto data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+    int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  } else {
+    Put(src, num_values);
+  }
+}
+
+std::shared_ptr<Buffer> DeltaByteArrayEncoder::FlushValues() {
+  std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+  std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+  // Readers decode every page independently
+  last_value_.clear();
+
+  PARQUET_ASSIGN_OR_THROW(auto buffer,
+                          ::arrow::ConcatenateBuffers({prefix_lengths, suffixes}, pool_));
+  return buffer;
+}
+
 // ----------------------------------------------------------------------
 // DeltaBitPackDecoder
 
+// Turn the unpacked deltas of a miniblock into values, in place: each value is
+// the previous one plus `min_delta` plus its delta. Additions wrap around as
+// unsigned integers, as the Parquet spec requires. Returns the last value.
+template <typename T>
+T DeltaPrefixSum(T min_delta, T last_value, T* values, int num_values) {
+  using UT = std::make_unsigned_t<T>;
+  int i = 0;
+#if defined(ARROW_HAVE_SSE4_2)
+  // In-register prefix sum over 128-bit lanes: shift and add log2(lanes) times,
+  // then add the running total carried from the previous lane group.
+  if constexpr (sizeof(T) == 4) {
+    const __m128i min_deltas = _mm_set1_epi32(static_cast<int32_t>(min_delta));
+    __m128i carry = _mm_set1_epi32(static_cast<int32_t>(last_value));
+    for (; i + 4 <= num_values; i += 4) {
+      auto ptr = reinterpret_cast<__m128i*>(values + i);
+      __m128i x = _mm_add_epi32(_mm_loadu_si128(ptr), min_deltas);
+      x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+      x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+      x = _mm_add_epi32(x, carry);
+      _mm_storeu_si128(ptr, x);
+      carry = _mm_shuffle_epi32(x, 0xFF);
+    }
+    last_value = static_cast<T>(_mm_cvtsi128_si32(carry));
+  } else {
+    const __m128i min_deltas = _mm_set1_epi64x(static_cast<int64_t>(min_delta));
+    __m128i carry = _mm_set1_epi64x(static_cast<int64_t>(last_value));
+    for (; i + 2 <= num_values; i += 2) {
+      auto ptr = reinterpret_cast<__m128i*>(values + i);
+      __m128i x = _mm_add_epi64(_mm_loadu_si128(ptr), min_deltas);
+      x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+      x = _mm_add_epi64(x, carry);
+      _mm_storeu_si128(ptr, x);
+      carry = _mm_unpackhi_epi64(x, x);
+    }
+    last_value = static_cast<T>(_mm_cvtsi128_si64(carry));
+  }
+#endif
+  for (; i < num_values; ++i) {
+    last_value = static_cast<T>(static_cast<UT>(min_delta) + static_cast<UT>(values[i]) +
+                                static_cast<UT>(last_value));
+    values[i] = last_value;
+  }
+  return last_value;
+}
+
 template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
-  using UT = std::make_unsigned_t<T>;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = ::arrow::default_memory_pool())
@@ -2401,15 +2769,18 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
-    }
-    std::vector<T> values(num_values);
-    int decoded_count = GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->Reserve(decoded_count));
-    for (int i = 0; i < decoded_count; ++i) {
-      PARQUET_THROW_NOT_OK(out->Append(values[i]));
+    const int values_to_decode = num_values - null_count;
+    std::vector<T> values(values_to_decode);
+    const int decoded_count = GetInternal(values.data(), values_to_decode);
+    if (ARROW_PREDICT_FALSE(decoded_count != values_to_decode)) {
+      ParquetException::EofException();
     }
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    int offset = 0;
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { PARQUET_THROW_NOT_OK(out->Append(values[offset++])); },
+        [&]() { PARQUET_THROW_NOT_OK(out->AppendNull()); });
     return decoded_count;
   }
 
@@ -2519,17 +2890,14 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
 
       int values_decode = std::min(values_remaining_current_mini_block_,
                                    static_cast<uint32_t>(max_values - i));
-      if (decoder_->GetBatch(delta_bit_width_, buffer + i, values_decode) !=
-          values_decode) {
+      if (delta_bit_width_ == 0) {
+        // All deltas are equal to min_delta, nothing to unpack
+        std::fill(buffer + i, buffer + i + values_decode, T{0});
+      } else if (decoder_->GetBatch(delta_bit_width_, buffer + i, values_decode) !=
+                 values_decode) {
         ParquetException::EofException();
       }
-      for (int j = 0; j < values_decode; ++j) {
-        // Addition between min_delta, packed int and last_value should be treated as
-        // unsigned addition. Overflow is as expected.
-        buffer[i + j] = static_cast<UT>(min_delta_) + static_cast<UT>(buffer[i + j]) +
-                        static_cast<UT>(last_value_);
-        last_value_ = buffer[i + j];
-      }
+      last_value_ = DeltaPrefixSum<T>(min_delta_, last_value_, buffer + i, values_decode);
       values_remaining_current_mini_block_ -= values_decode;
       i += values_decode;
     }
@@ -2637,16 +3005,60 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeArrowDense(num_values, null_count, valid_bits,
+                                          valid_bits_offset, out, &result));
+    return result;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    std::vector<ByteArray> values(num_values - null_count);
+    const int num_valid_values = Decode(values.data(), num_values - null_count);
+    DCHECK_EQ(num_values - null_count, num_valid_values);
+
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    int value_idx = 0;
+    PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() {
+          const auto& val = values[value_idx++];
+          return out->Append(val.ptr, static_cast<int32_t>(val.len));
+        },
+        [&]() { return out->AppendNull(); }));
+    return num_valid_values;
   }
 
  private:
+  Status DecodeArrowDense(int num_values, int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::Accumulator* out,
+                          int* out_num_values) {
+    ArrowBinaryHelper helper(out);
+
+    std::vector<ByteArray> values(num_values - null_count);
+    const int num_valid_values = Decode(values.data(), num_values - null_count);
+    DCHECK_EQ(num_values - null_count, num_valid_values);
+
+    int value_idx = 0;
+    RETURN_NOT_OK(VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() {
+          const auto& val = values[value_idx];
+          if (ARROW_PREDICT_FALSE(!helper.CanFit(val.len))) {
+            RETURN_NOT_OK(helper.PushChunk());
+          }
+          RETURN_NOT_OK(helper.Append(val.ptr, static_cast<int32_t>(val.len)));
+          ++value_idx;
+          return Status::OK();
+        },
+        [&]() { return helper.AppendNull(); }));
+
+    *out_num_values = num_valid_values;
+    return Status::OK();
+  }
+
   // Decode all the encoded lengths. The decoder_ will be at the start of the encoded data
   // after that.
   void DecodeLengths() {
@@ -3014,7 +3426,24 @@ template <typename DType>
 int ByteStreamSplitDecoder<DType>::DecodeArrow(
     int num_values, int null_count, const uint8_t* valid_bits, int64_t valid_bits_offset,
     typename EncodingTraits<DType>::DictAccumulator* builder) {
-  ParquetException::NYI("DecodeArrow for ByteStreamSplitDecoder");
+  constexpr int value_size = static_cast<int>(kNumStreams);
+  const int values_to_decode = num_values - null_count;
+  if (ARROW_PREDICT_FALSE(len_ < value_size * values_to_decode)) {
+    ParquetException::EofException();
+  }
+
+  PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+
+  // Decode the valid values into a scratch buffer, then look them up in the
+  // dictionary one by one
+  T* decode_out = EnsureDecodeBuffer(values_to_decode);
+  const int values_decoded = Decode(decode_out, values_to_decode);
+  int offset = 0;
+  VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() { PARQUET_THROW_NOT_OK(builder->Append(decode_out[offset++])); },
+      [&]() { PARQUET_THROW_NOT_OK(builder->AppendNull()); });
+  return values_decoded;
 }
 
 }  // namespace
@@ -3088,6 +3517,16 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
             "DELTA_BINARY_PACKED encoder only supports INT32 and INT64");
         break;
     }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::make_unique<DeltaLengthByteArrayEncoder>(descr, pool);
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::make_unique<DeltaByteArrayEncoder>(descr, pool);
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
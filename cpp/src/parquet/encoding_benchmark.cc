@@ -30,9 +30,12 @@
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <random>
+#include <string>
+#include <vector>
 
 using arrow::default_memory_pool;
 using arrow::MemoryPool;
@@ -476,6 +479,21 @@ static auto MakeDeltaBitPackingInputWide(size_t length) {
   return numbers;
 }
 
+// Increasing values with small, irregular steps, like timestamps or sorted ids
+template <typename DType>
+static auto MakeDeltaBitPackingInputSorted(size_t length) {
+  using T = typename DType::c_type;
+  auto steps = std::vector<T>(length);
+  ::arrow::randint<T, T>(length, 0, 100, &steps);
+  auto numbers = std::vector<T>(length);
+  T value = 1600000000;
+  for (size_t i = 0; i < length; ++i) {
+    value += steps[i];
+    numbers[i] = value;
+  }
+  return numbers;
+}
+
 template <typename DType, typename NumberGenerator>
 static void BM_DeltaBitPackingEncode(benchmark::State& state, NumberGenerator gen) {
   using T = typename DType::c_type;
@@ -513,12 +531,22 @@ static void BM_DeltaBitPackingEncode_Int64_Wide(benchmark::State& state) {
   BM_DeltaBitPackingEncode<Int64Type>(state, MakeDeltaBitPackingInputWide<Int64Type>);
 }
 
+static void BM_DeltaBitPackingEncode_Int32_Sorted(benchmark::State& state) {
+  BM_DeltaBitPackingEncode<Int32Type>(state, MakeDeltaBitPackingInputSorted<Int32Type>);
+}
+
+static void BM_DeltaBitPackingEncode_Int64_Sorted(benchmark::State& state) {
+  BM_DeltaBitPackingEncode<Int64Type>(state, MakeDeltaBitPackingInputSorted<Int64Type>);
+}
+
 BENCHMARK(BM_DeltaBitPackingEncode_Int32_Fixed)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingEncode_Int64_Fixed)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingEncode_Int32_Narrow)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingEncode_Int64_Narrow)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingEncode_Int32_Wide)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingEncode_Int64_Wide)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingEncode_Int32_Sorted)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingEncode_Int64_Sorted)->Range(MIN_RANGE, MAX_RANGE);
 
 template <typename DType, typename NumberGenerator>
 static void BM_DeltaBitPackingDecode(benchmark::State& state, NumberGenerator gen) {
@@ -562,12 +590,22 @@ static void BM_DeltaBitPackingDecode_Int64_Wide(benchmark::State& state) {
   BM_DeltaBitPackingDecode<Int64Type>(state, MakeDeltaBitPackingInputWide<Int64Type>);
 }
 
+static void BM_DeltaBitPackingDecode_Int32_Sorted(benchmark::State& state) {
+  BM_DeltaBitPackingDecode<Int32Type>(state, MakeDeltaBitPackingInputSorted<Int32Type>);
+}
+
+static void BM_DeltaBitPackingDecode_Int64_Sorted(benchmark::State& state) {
+  BM_DeltaBitPackingDecode<Int64Type>(state, MakeDeltaBitPackingInputSorted<Int64Type>);
+}
+
 BENCHMARK(BM_DeltaBitPackingDecode_Int32_Fixed)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int64_Fixed)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int32_Narrow)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int64_Narrow)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int32_Wide)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int64_Wide)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingDecode_Int32_Sorted)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingDecode_Int64_Sorted)->Range(MIN_RANGE, MAX_RANGE);
 
 template <typename Type>
 static void DecodeDict(std::vector<typename Type::c_type>& values,
@@ -654,15 +692,19 @@ class BenchmarkDecodeArrow : public ::benchmark::Fixture {
     values_.clear();
   }
 
-  void InitDataInputs() {
+  virtual std::shared_ptr<::arrow::Array> MakeInputArray() {
     // Generate a random string dictionary without any nulls so that this dataset can
     // be used for benchmarking the DecodeArrowNonNull API
     constexpr int repeat_factor = 8;
     constexpr int64_t min_length = 2;
     constexpr int64_t max_length = 10;
     ::arrow::random::RandomArrayGenerator rag(0);
-    input_array_ = rag.StringWithRepeats(num_values_, num_values_ / repeat_factor,
-                                         min_length, max_length, /*null_probability=*/0);
+    return rag.StringWithRepeats(num_values_, num_values_ / repeat_factor, min_length,
+                                 max_length, /*null_probability=*/0);
+  }
+
+  void InitDataInputs() {
+    input_array_ = MakeInputArray();
     valid_bits_ = input_array_->null_bitmap_data();
     total_size_ = input_array_->data()->buffers[2]->size();
 
@@ -680,11 +722,16 @@ class BenchmarkDecodeArrow : public ::benchmark::Fixture {
 
   virtual std::unique_ptr<ByteArrayDecoder> InitializeDecoder() = 0;
 
+  // The number of bytes needed to store the encoded values, so that encodings
+  // can be compared on size as well as on speed
+  virtual int64_t EncodedSize() const { return buffer_->size(); }
+
   void EncodeArrowBenchmark(benchmark::State& state) {
     for (auto _ : state) {
       DoEncodeArrow();
     }
     state.SetBytesProcessed(state.iterations() * total_size_);
+    state.counters["encoded_size"] = static_cast<double>(EncodedSize());
   }
 
   void EncodeLowLevelBenchmark(benchmark::State& state) {
@@ -692,6 +739,7 @@ class BenchmarkDecodeArrow : public ::benchmark::Fixture {
       DoEncodeLowLevel();
     }
     state.SetBytesProcessed(state.iterations() * total_size_);
+    state.counters["encoded_size"] = static_cast<double>(EncodedSize());
   }
 
   void DecodeArrowDenseBenchmark(benchmark::State& state) {
@@ -792,6 +840,138 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Benchmark Decoding from Delta Length Byte Array Encoding
+class BM_ArrowBinaryDeltaLength : public BenchmarkDecodeArrow {
+ public:
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dict)
+(benchmark::State& state) { DecodeArrowDictBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dict)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+// ----------------------------------------------------------------------
+// Benchmark Decoding from Delta Byte Array Encoding
+class BM_ArrowBinaryDeltaByteArray : public BenchmarkDecodeArrow {
+ public:
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, EncodeLowLevel)
+    ->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+// Sorted values sharing long prefixes (keys, URLs, paths), where DELTA_BYTE_ARRAY
+// shines. Compare with BM_ArrowBinaryPlainSorted and BM_ArrowBinaryDictSorted.
+static std::shared_ptr<::arrow::Array> MakeSortedPathsArray(int num_values) {
+  std::vector<std::string> paths;
+  paths.reserve(num_values);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> dist(0, num_values);
+  for (int i = 0; i < num_values; ++i) {
+    paths.push_back("s3://bucket/warehouse/events/date=2023-01-" +
+                    std::to_string(10 + i % 20) + "/part-" + std::to_string(dist(gen)) +
+                    ".parquet");
+  }
+  std::sort(paths.begin(), paths.end());
+
+  ::arrow::StringBuilder builder;
+  ABORT_NOT_OK(builder.AppendValues(paths));
+  std::shared_ptr<::arrow::Array> out;
+  ABORT_NOT_OK(builder.Finish(&out));
+  return out;
+}
+
+class BM_ArrowBinaryPlainSorted : public BM_ArrowBinaryPlain {
+ public:
+  std::shared_ptr<::arrow::Array> MakeInputArray() override {
+    return MakeSortedPathsArray(num_values_);
+  }
+};
+
+class BM_ArrowBinaryDeltaByteArraySorted : public BM_ArrowBinaryDeltaByteArray {
+ public:
+  std::shared_ptr<::arrow::Array> MakeInputArray() override {
+    return MakeSortedPathsArray(num_values_);
+  }
+};
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryPlainSorted, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryPlainSorted, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryPlainSorted, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryPlainSorted, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArraySorted, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArraySorted, EncodeArrow)
+    ->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArraySorted, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArraySorted, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Benchmark Decoding from Dictionary Encoding
 class BM_ArrowBinaryDict : public BenchmarkDecodeArrow {
@@ -861,6 +1041,10 @@ class BM_ArrowBinaryDict : public BenchmarkDecodeArrow {
         dynamic_cast<ByteArrayDecoder*>(dict_decoder.release()));
   }
 
+  int64_t EncodedSize() const override {
+    return buffer_->size() + dict_buffer_->size();
+  }
+
   void TearDown(const ::benchmark::State& state) override {
     BenchmarkDecodeArrow::TearDown(state);
     dict_buffer_.reset();
@@ -916,4 +1100,20 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryDict, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryDict, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+class BM_ArrowBinaryDictSorted : public BM_ArrowBinaryDict {
+ public:
+  std::shared_ptr<::arrow::Array> MakeInputArray() override {
+    return MakeSortedPathsArray(num_values_);
+  }
+};
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDictSorted, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDictSorted, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDictSorted, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDictSorted, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
 }  // namespace parquet
@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -1493,5 +1494,191 @@ TYPED_TEST(TestDeltaBitPackEncoding, NonZeroPaddedMiniblockBitWidth) {
   }
 }
 
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests.
+
+class TestDeltaByteArrayEncodings : public TestEncodingBase<ByteArrayType>,
+                                    public ::testing::WithParamInterface<Encoding::type> {
+ public:
+  static constexpr size_t kNumRoundTrips = 3;
+  const std::vector<int> kReadBatchSizes = {1, 11};
+
+  // Sorted values with long shared prefixes, as found in keys, URLs or paths
+  void InitSortedData(int nvalues) {
+    num_values_ = nvalues;
+    input_bytes_.resize(num_values_ * sizeof(ByteArray));
+    output_bytes_.resize(num_values_ * sizeof(ByteArray));
+    draws_ = reinterpret_cast<ByteArray*>(input_bytes_.data());
+    decode_buf_ = reinterpret_cast<ByteArray*>(output_bytes_.data());
+
+    sorted_values_.clear();
+    for (int i = 0; i < nvalues; ++i) {
+      sorted_values_.push_back("https://example.com/path/to/item/" +
+                               std::to_string(1000000 + i * 7));
+    }
+    std::sort(sorted_values_.begin(), sorted_values_.end());
+    for (int i = 0; i < nvalues; ++i) {
+      draws_[i] = ByteArray(sorted_values_[i]);
+    }
+  }
+
+  void CheckDecoding() {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam(), descr_.get());
+    auto read_batch_sizes = kReadBatchSizes;
+    read_batch_sizes.push_back(num_values_);
+    // Exercise different batch sizes
+    for (const int read_batch_size : read_batch_sizes) {
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+
+      int values_decoded = 0;
+      while (values_decoded < num_values_) {
+        values_decoded += decoder->Decode(decode_buf_ + values_decoded, read_batch_size);
+      }
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<ByteArray>(decode_buf_, draws_, num_values_));
+    }
+  }
+
+  void CheckRoundtrip() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam(), false, descr_.get());
+    // Encode a number of times to exercise the flush logic
+    for (size_t i = 0; i < kNumRoundTrips; ++i) {
+      encoder->Put(draws_, num_values_);
+      encode_buffer_ = encoder->FlushValues();
+      ASSERT_NO_FATAL_FAILURE(CheckDecoding());
+    }
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam(), false, descr_.get());
+    auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam(), descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!bit_util::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    for (size_t i = 0; i < kNumRoundTrips; ++i) {
+      encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+      encode_buffer_ = encoder->FlushValues();
+      decoder->SetData(num_values_ - null_count, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                  valid_bits, valid_bits_offset);
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<ByteArray>(
+          decode_buf_, draws_, num_values_, valid_bits, valid_bits_offset));
+    }
+  }
+
+  void CheckArrowRoundtrip(const ::arrow::Array& values) {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam(), false, descr_.get());
+    auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam(), descr_.get());
+
+    for (size_t i = 0; i < kNumRoundTrips; ++i) {
+      ASSERT_NO_THROW(encoder->Put(values));
+      auto buf = encoder->FlushValues();
+
+      int num_values = static_cast<int>(values.length() - values.null_count());
+      decoder->SetData(num_values, buf->data(), static_cast<int>(buf->size()));
+
+      typename EncodingTraits<ByteArrayType>::Accumulator acc;
+      acc.builder.reset(new ::arrow::StringBuilder);
+      ASSERT_EQ(num_values,
+                decoder->DecodeArrow(static_cast<int>(values.length()),
+                                     static_cast<int>(values.null_count()),
+                                     values.null_bitmap_data(), values.offset(), &acc));
+
+      std::shared_ptr<::arrow::Array> result;
+      ASSERT_OK(acc.builder->Finish(&result));
+      ::arrow::AssertArraysEqual(values, *result);
+    }
+  }
+
+ protected:
+  std::vector<std::string> sorted_values_;
+};
+
+TEST_P(TestDeltaByteArrayEncodings, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(this->Execute(0, 0));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(250, 2));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(2000, 10));
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(
+      /*nvalues*/ 1234, /*repeats*/ 1, /*valid_bits_offset*/ 64,
+      /*null_probability*/ 0.1));
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(
+      /*nvalues*/ 1234, /*repeats*/ 10, /*valid_bits_offset*/ 3,
+      /*null_probability*/ 0.5));
+}
+
+TEST_P(TestDeltaByteArrayEncodings, SortedRoundTrip) {
+  this->InitSortedData(5000);
+  ASSERT_NO_FATAL_FAILURE(this->CheckRoundtrip());
+
+  if (GetParam() == Encoding::DELTA_BYTE_ARRAY) {
+    // Shared prefixes are only stored once
+    int64_t total_size = 0;
+    for (const auto& value : this->sorted_values_) {
+      total_size += static_cast<int64_t>(value.size());
+    }
+    ASSERT_LT(this->encode_buffer_->size(), total_size / 4);
+  }
+}
+
+TEST_P(TestDeltaByteArrayEncodings, ArrowDirectPut) {
+  const int64_t size = 500;
+  const int32_t min_length = 0;
+  const int32_t max_length = 10;
+
+  for (auto seed : {0, 1, 2}) {
+    ARROW_SCOPED_TRACE("seed = ", seed);
+    ::arrow::random::RandomArrayGenerator rag(seed);
+    for (double null_probability : {0.0, 0.25, 1.0}) {
+      ARROW_SCOPED_TRACE("null_probability = ", null_probability);
+      auto values = rag.String(size, min_length, max_length, null_probability);
+      ASSERT_NO_FATAL_FAILURE(this->CheckArrowRoundtrip(*values));
+      ASSERT_NO_FATAL_FAILURE(this->CheckArrowRoundtrip(*values->Slice(7, 300)));
+    }
+  }
+
+  // Values sharing their prefixes, including empty and repeated values
+  auto values = ::arrow::ArrayFromJSON(
+      ::arrow::utf8(),
+      R"(["", "a", "ab", "ab", null, "abc", "abd", "b", "", "bcd", "bcd", null])");
+  ASSERT_NO_FATAL_FAILURE(this->CheckArrowRoundtrip(*values));
+}
+
+TEST_P(TestDeltaByteArrayEncodings, ArrowLargeBinaryDirectPut) {
+  const char* json = R"(["foo", "foobar", null, "", "fob", "fob", "bar", null, "x"])";
+  auto values = ::arrow::ArrayFromJSON(::arrow::utf8(), json);
+  auto large_values = ::arrow::ArrayFromJSON(::arrow::large_utf8(), json);
+
+  auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam(), false, descr_.get());
+  ASSERT_NO_THROW(encoder->Put(*values));
+  auto expected = encoder->FlushValues();
+  ASSERT_NO_THROW(encoder->Put(*large_values));
+  auto actual = encoder->FlushValues();
+  ASSERT_TRUE(actual->Equals(*expected));
+}
+
+INSTANTIATE_TEST_SUITE_P(DeltaByteArray, TestDeltaByteArrayEncodings,
+                         ::testing::Values(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                           Encoding::DELTA_BYTE_ARRAY),
+                         [](const ::testing::TestParamInfo<Encoding::type>& info) {
+                           return EncodingToString(info.param);
+                         });
+
+TEST(DeltaByteArrayEncodings, UnsupportedTypes) {
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ASSERT_THROW(MakeTypedEncoder<Int32Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<DoubleType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FLBAType>(encoding), ParquetException);
+  }
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -32,6 +32,7 @@ namespace parquet {
 
 class ColumnReader;
 class FileMetaData;
+class BloomFilterReader;
 class PageIndexReader;
 class PageReader;
 class RowGroupMetaData;
@@ -100,6 +101,7 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
     virtual std::shared_ptr<PageIndexReader> GetPageIndexReader() = 0;
+    virtual BloomFilterReader& GetBloomFilterReader() = 0;
   };
 
   ParquetFileReader();
@@ -146,6 +148,14 @@ class PARQUET_EXPORT ParquetFileReader {
   /// WARNING: The returned PageIndexReader must not outlive the ParquetFileReader.
   std::shared_ptr<PageIndexReader> GetPageIndexReader();
 
+  /// Returns the BloomFilterReader. Only one instance is ever created.
+  ///
+  /// If a column chunk does not have a bloom filter, the RowGroupBloomFilterReader
+  /// returns nullptr for it.
+  ///
+  /// WARNING: The returned BloomFilterReader must not outlive the ParquetFileReader.
+  BloomFilterReader& GetBloomFilterReader();
+
   /// Pre-buffer the specified column indices in all row groups.
   ///
   /// Readers can optionally call this to cache the necessary slices
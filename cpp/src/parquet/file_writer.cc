@@ -24,10 +24,12 @@
 #include <utility>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/encryption/encryption_internal.h"
 #include "parquet/encryption/internal_file_encryptor.h"
 #include "parquet/exception.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -85,7 +87,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   RowGroupSerializer(std::shared_ptr<ArrowOutputStream> sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     PageIndexBuilder* page_index_builder = nullptr,
+                     BloomFilterBuilder* bloom_filter_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -95,7 +99,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        page_index_builder_(page_index_builder),
+        bloom_filter_builder_(bloom_filter_builder) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -131,18 +137,22 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     ++next_column_index_;
 
     const auto& path = col_meta->descr()->path();
+    const int32_t column_ordinal = next_column_index_ - 1;
     auto meta_encryptor =
         file_encryptor_ ? file_encryptor_->GetColumnMetaEncryptor(path->ToDotString())
                         : nullptr;
     auto data_encryptor =
         file_encryptor_ ? file_encryptor_->GetColumnDataEncryptor(path->ToDotString())
                         : nullptr;
+    auto ci_builder = GetColumnIndexBuilder(path, column_ordinal);
+    auto oi_builder = GetOffsetIndexBuilder(path, column_ordinal);
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
-        col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
+        col_meta, row_group_ordinal_, static_cast<int16_t>(column_ordinal),
         properties_->memory_pool(), false, meta_encryptor, data_encryptor,
-        properties_->page_checksum_enabled());
-    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+        properties_->page_checksum_enabled(), ci_builder, oi_builder);
+    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_,
+                                            GetBloomFilter(column_ordinal));
     return column_writers_[0].get();
   }
 
@@ -213,6 +223,31 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  PageIndexBuilder* page_index_builder_;
+  BloomFilterBuilder* bloom_filter_builder_;
+
+  BloomFilter* GetBloomFilter(int32_t column_ordinal) {
+    if (bloom_filter_builder_ == nullptr) {
+      return nullptr;
+    }
+    return bloom_filter_builder_->GetOrCreateBloomFilter(column_ordinal);
+  }
+
+  ColumnIndexBuilder* GetColumnIndexBuilder(
+      const std::shared_ptr<schema::ColumnPath>& path, int32_t column_ordinal) {
+    if (page_index_builder_ == nullptr || !properties_->page_index_enabled(path)) {
+      return nullptr;
+    }
+    return page_index_builder_->GetColumnIndexBuilder(column_ordinal);
+  }
+
+  OffsetIndexBuilder* GetOffsetIndexBuilder(
+      const std::shared_ptr<schema::ColumnPath>& path, int32_t column_ordinal) {
+    if (page_index_builder_ == nullptr || !properties_->page_index_enabled(path)) {
+      return nullptr;
+    }
+    return page_index_builder_->GetOffsetIndexBuilder(column_ordinal);
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -240,20 +275,23 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     for (int i = 0; i < num_columns(); i++) {
       auto col_meta = metadata_->NextColumnChunk();
       const auto& path = col_meta->descr()->path();
+      const int32_t column_ordinal = next_column_index_++;
       auto meta_encryptor =
           file_encryptor_ ? file_encryptor_->GetColumnMetaEncryptor(path->ToDotString())
                           : nullptr;
       auto data_encryptor =
           file_encryptor_ ? file_encryptor_->GetColumnDataEncryptor(path->ToDotString())
                           : nullptr;
+      auto ci_builder = GetColumnIndexBuilder(path, column_ordinal);
+      auto oi_builder = GetOffsetIndexBuilder(path, column_ordinal);
       std::unique_ptr<PageWriter> pager = PageWriter::Open(
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
-          static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
+          static_cast<int16_t>(column_ordinal), properties_->memory_pool(),
           buffered_row_group_, meta_encryptor, data_encryptor,
-          properties_->page_checksum_enabled());
-      column_writers_.push_back(
-          ColumnWriter::Make(col_meta, std::move(pager), properties_));
+          properties_->page_checksum_enabled(), ci_builder, oi_builder);
+      column_writers_.push_back(ColumnWriter::Make(
+          col_meta, std::move(pager), properties_, GetBloomFilter(column_ordinal)));
     }
   }
 
@@ -290,6 +328,9 @@ class FileSerializer : public ParquetFileWriter::Contents {
       }
       row_group_writer_.reset();
 
+      WriteBloomFilter();
+      WritePageIndex();
+
       // Write magic bytes and metadata
       auto file_encryption_properties = properties_->file_encryption_properties();
 
@@ -318,9 +359,16 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
     num_row_groups_++;
     auto rg_metadata = metadata_->AppendRowGroup();
+    if (page_index_builder_) {
+      page_index_builder_->AppendRowGroup();
+    }
+    if (bloom_filter_builder_) {
+      bloom_filter_builder_->AppendRowGroup();
+    }
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), page_index_builder_.get(),
+        bloom_filter_builder_.get()));
     row_group_writer_ = std::make_unique<RowGroupWriter>(std::move(contents));
     return row_group_writer_.get();
   }
@@ -385,6 +433,27 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
   }
 
+  void WriteBloomFilter() {
+    if (bloom_filter_builder_ != nullptr) {
+      // Serialize bloom filters after all row groups have been written and report
+      // their offsets to the file metadata.
+      BloomFilterLocation bloom_filter_location;
+      bloom_filter_builder_->WriteTo(sink_.get(), &bloom_filter_location);
+      metadata_->SetBloomFilterLocation(bloom_filter_location);
+    }
+  }
+
+  void WritePageIndex() {
+    if (page_index_builder_ != nullptr) {
+      // Serialize page index after all row groups have been written and report
+      // location to the file metadata.
+      PageIndexLocation page_index_location;
+      page_index_builder_->Finish();
+      page_index_builder_->WriteTo(sink_.get(), &page_index_location);
+      metadata_->SetPageIndexLocation(page_index_location);
+    }
+  }
+
   std::shared_ptr<ArrowOutputStream> sink_;
   bool is_open_;
   const std::shared_ptr<WriterProperties> properties_;
@@ -395,6 +464,8 @@ class FileSerializer : public ParquetFileWriter::Contents {
   std::unique_ptr<RowGroupWriter> row_group_writer_;
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
+  std::unique_ptr<PageIndexBuilder> page_index_builder_;
+  std::unique_ptr<BloomFilterBuilder> bloom_filter_builder_;
 
   void StartFile() {
     auto file_encryption_properties = properties_->file_encryption_properties();
@@ -432,6 +503,20 @@ class FileSerializer : public ParquetFileWriter::Contents {
         PARQUET_THROW_NOT_OK(sink_->Write(kParquetMagic, 4));
       }
     }
+
+    if (properties_->page_index_enabled()) {
+      if (file_encryption_properties != nullptr) {
+        ParquetException::NYI("Writing page index of encrypted files");
+      }
+      page_index_builder_ = PageIndexBuilder::Make(&schema_);
+    }
+
+    if (properties_->bloom_filter_enabled()) {
+      if (file_encryption_properties != nullptr) {
+        ParquetException::NYI("Writing bloom filter of encrypted files");
+      }
+      bloom_filter_builder_ = BloomFilterBuilder::Make(&schema_, properties_.get());
+    }
   }
 };
 
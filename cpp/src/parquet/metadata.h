@@ -127,6 +127,33 @@ struct IndexLocation {
   int32_t length;
 };
 
+/// \brief Public struct for location to all page indexes in a parquet file.
+struct PageIndexLocation {
+  /// Alias type of page index location of a row group. The index location
+  /// is located by column ordinal. If the column does not have the page index,
+  /// its value is set to std::nullopt.
+  using RowGroupIndexLocation = std::vector<std::optional<IndexLocation>>;
+  /// Alias type of page index location of a parquet file. The index location
+  /// is located by the row group ordinal. Row groups without any page index
+  /// are absent.
+  using FileIndexLocation = std::map<size_t, RowGroupIndexLocation>;
+  /// Row group column index locations which uses row group ordinal as the key.
+  FileIndexLocation column_index_location;
+  /// Row group offset index locations which uses row group ordinal as the key.
+  FileIndexLocation offset_index_location;
+};
+
+/// \brief Public struct for location to all bloom filters in a parquet file.
+struct BloomFilterLocation {
+  /// Alias type of bloom filter offsets of a row group. The offset is located by
+  /// column ordinal. If the column does not have a bloom filter, its value is set
+  /// to std::nullopt.
+  using RowGroupBloomFilterLocation = std::vector<std::optional<int64_t>>;
+  /// Row group bloom filter offsets which uses row group ordinal as the key. Row
+  /// groups without any bloom filter are absent.
+  std::map<size_t, RowGroupBloomFilterLocation> bloom_filter_location;
+};
+
 /// \brief ColumnChunkMetaData is a proxy around format::ColumnChunkMetaData.
 class PARQUET_EXPORT ColumnChunkMetaData {
  public:
@@ -518,6 +545,12 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Update location to serialized page index of all column chunks
+  void SetPageIndexLocation(const PageIndexLocation& location);
+
+  // Update location to serialized bloom filter of all column chunks
+  void SetBloomFilterLocation(const BloomFilterLocation& location);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
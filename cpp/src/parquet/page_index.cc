@@ -26,8 +26,11 @@
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/unreachable.h"
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <numeric>
+#include <sstream>
 
 namespace parquet {
 
@@ -426,6 +429,315 @@ class PageIndexReaderImpl : public PageIndexReader {
   std::unordered_map<int32_t, RowGroupIndexReadRange> index_read_ranges_;
 };
 
+/// \brief Internal state of page index builder.
+enum class BuilderState {
+  /// Created but not yet written.
+  kCreated,
+  /// Some pages are added but not yet finished.
+  kStarted,
+  /// All pages are added and finished.
+  kFinished,
+  /// The builder is corrupted or invalid and cannot produce any page index.
+  kDiscarded
+};
+
+template <typename DType>
+class ColumnIndexBuilderImpl final : public ColumnIndexBuilder {
+ public:
+  using T = typename DType::c_type;
+
+  explicit ColumnIndexBuilderImpl(const ColumnDescriptor* descr) : descr_(descr) {
+    /// Null counts are set to be valid until a page without null count is added.
+    column_index_.__isset.null_counts = true;
+    column_index_.boundary_order = format::BoundaryOrder::UNORDERED;
+  }
+
+  void AddPage(const EncodedStatistics& stats) override {
+    if (state_ == BuilderState::kFinished) {
+      throw ParquetException("Cannot add page to finished ColumnIndexBuilder.");
+    } else if (state_ == BuilderState::kDiscarded) {
+      /// The column index is discarded. Do nothing.
+      return;
+    }
+
+    state_ = BuilderState::kStarted;
+
+    if (stats.all_null_value) {
+      column_index_.null_pages.emplace_back(true);
+      column_index_.min_values.emplace_back("");
+      column_index_.max_values.emplace_back("");
+    } else if (stats.has_min && stats.has_max) {
+      column_index_.null_pages.emplace_back(false);
+      column_index_.min_values.emplace_back(stats.min());
+      column_index_.max_values.emplace_back(stats.max());
+    } else {
+      /// This is a non-null page but it lacks meaningful min/max values.
+      /// Discard the column index.
+      state_ = BuilderState::kDiscarded;
+      return;
+    }
+
+    if (column_index_.__isset.null_counts && stats.has_null_count) {
+      column_index_.null_counts.emplace_back(stats.null_count);
+    } else {
+      column_index_.__isset.null_counts = false;
+      column_index_.null_counts.clear();
+    }
+  }
+
+  void Finish() override {
+    switch (state_) {
+      case BuilderState::kCreated: {
+        /// No page is added. Discard the column index.
+        state_ = BuilderState::kDiscarded;
+        break;
+      }
+      case BuilderState::kFinished:
+        throw ParquetException("ColumnIndexBuilder is already finished.");
+      case BuilderState::kDiscarded:
+        // The column index is discarded. Do nothing.
+        break;
+      case BuilderState::kStarted:
+        /// Decode the min/max values to determine the boundary order.
+        column_index_.__set_boundary_order(
+            ToThrift(DetermineBoundaryOrder(TypedColumnIndexImpl<DType>(
+                *descr_, column_index_))));
+        state_ = BuilderState::kFinished;
+        break;
+    }
+  }
+
+  int64_t WriteTo(::arrow::io::OutputStream* sink) const override {
+    if (state_ == BuilderState::kFinished) {
+      return ThriftSerializer{}.Serialize(&column_index_, sink);
+    }
+    return 0;
+  }
+
+  std::unique_ptr<ColumnIndex> Build() const override {
+    if (state_ == BuilderState::kFinished) {
+      return std::make_unique<TypedColumnIndexImpl<DType>>(*descr_, column_index_);
+    }
+    return nullptr;
+  }
+
+ private:
+  BoundaryOrder::type DetermineBoundaryOrder(
+      const TypedColumnIndex<DType>& column_index) const {
+    const auto& non_null_page_indices = column_index.non_null_page_indices();
+    if (non_null_page_indices.empty()) {
+      return BoundaryOrder::Unordered;
+    }
+
+    const auto& min_values = column_index.min_values();
+    const auto& max_values = column_index.max_values();
+    auto comparator = MakeComparator<DType>(descr_);
+    bool is_ascending = true;
+    bool is_descending = true;
+    for (size_t i = 1; i < non_null_page_indices.size(); ++i) {
+      const int32_t prev = non_null_page_indices[i - 1];
+      const int32_t curr = non_null_page_indices[i];
+      // Copy the values as std::vector<bool> elements cannot be bound to a reference
+      const T prev_min = min_values[prev], curr_min = min_values[curr];
+      const T prev_max = max_values[prev], curr_max = max_values[curr];
+      if (comparator->Compare(curr_min, prev_min) ||
+          comparator->Compare(curr_max, prev_max)) {
+        is_ascending = false;
+      }
+      if (comparator->Compare(prev_min, curr_min) ||
+          comparator->Compare(prev_max, curr_max)) {
+        is_descending = false;
+      }
+      if (!is_ascending && !is_descending) {
+        return BoundaryOrder::Unordered;
+      }
+    }
+    return is_ascending ? BoundaryOrder::Ascending : BoundaryOrder::Descending;
+  }
+
+  const ColumnDescriptor* descr_;
+  format::ColumnIndex column_index_;
+  BuilderState state_ = BuilderState::kCreated;
+};
+
+class OffsetIndexBuilderImpl final : public OffsetIndexBuilder {
+ public:
+  OffsetIndexBuilderImpl() = default;
+
+  void AddPage(int64_t offset, int32_t compressed_page_size,
+               int64_t first_row_index) override {
+    if (state_ == BuilderState::kFinished) {
+      throw ParquetException("Cannot add page to finished OffsetIndexBuilder.");
+    } else if (state_ == BuilderState::kDiscarded) {
+      /// The offset index is discarded. Do nothing.
+      return;
+    }
+
+    state_ = BuilderState::kStarted;
+
+    format::PageLocation page_location;
+    page_location.__set_offset(offset);
+    page_location.__set_compressed_page_size(compressed_page_size);
+    page_location.__set_first_row_index(first_row_index);
+    offset_index_.page_locations.emplace_back(std::move(page_location));
+  }
+
+  void Finish(int64_t final_position) override {
+    switch (state_) {
+      case BuilderState::kCreated: {
+        /// No pages are added. Simply discard the offset index.
+        state_ = BuilderState::kDiscarded;
+        break;
+      }
+      case BuilderState::kStarted: {
+        /// Adjust page offsets according to the final position.
+        if (final_position > 0) {
+          for (auto& page_location : offset_index_.page_locations) {
+            page_location.__set_offset(page_location.offset + final_position);
+          }
+        }
+        state_ = BuilderState::kFinished;
+        break;
+      }
+      case BuilderState::kFinished:
+        throw ParquetException("OffsetIndexBuilder is already finished.");
+      case BuilderState::kDiscarded:
+        // The offset index is discarded. Do nothing.
+        break;
+    }
+  }
+
+  int64_t WriteTo(::arrow::io::OutputStream* sink) const override {
+    if (state_ == BuilderState::kFinished) {
+      return ThriftSerializer{}.Serialize(&offset_index_, sink);
+    }
+    return 0;
+  }
+
+  std::unique_ptr<OffsetIndex> Build() const override {
+    if (state_ == BuilderState::kFinished) {
+      return std::make_unique<OffsetIndexImpl>(offset_index_);
+    }
+    return nullptr;
+  }
+
+ private:
+  format::OffsetIndex offset_index_;
+  BuilderState state_ = BuilderState::kCreated;
+};
+
+class PageIndexBuilderImpl final : public PageIndexBuilder {
+ public:
+  explicit PageIndexBuilderImpl(const SchemaDescriptor* schema) : schema_(schema) {}
+
+  void AppendRowGroup() override {
+    if (finished_) {
+      throw ParquetException(
+          "Cannot call AppendRowGroup() to finished PageIndexBuilder.");
+    }
+
+    // Append new builders of next row group.
+    const auto num_columns = static_cast<size_t>(schema_->num_columns());
+    column_index_builders_.emplace_back();
+    offset_index_builders_.emplace_back();
+    column_index_builders_.back().resize(num_columns);
+    offset_index_builders_.back().resize(num_columns);
+  }
+
+  ColumnIndexBuilder* GetColumnIndexBuilder(int32_t i) override {
+    CheckState(i);
+    std::unique_ptr<ColumnIndexBuilder>& builder = column_index_builders_.back()[i];
+    if (builder == nullptr) {
+      builder = ColumnIndexBuilder::Make(schema_->Column(i));
+    }
+    return builder.get();
+  }
+
+  OffsetIndexBuilder* GetOffsetIndexBuilder(int32_t i) override {
+    CheckState(i);
+    std::unique_ptr<OffsetIndexBuilder>& builder = offset_index_builders_.back()[i];
+    if (builder == nullptr) {
+      builder = OffsetIndexBuilder::Make();
+    }
+    return builder.get();
+  }
+
+  void Finish() override { finished_ = true; }
+
+  void WriteTo(::arrow::io::OutputStream* sink,
+               PageIndexLocation* location) const override {
+    if (!finished_) {
+      throw ParquetException("Cannot call WriteTo() to unfinished PageIndexBuilder.");
+    }
+
+    location->column_index_location.clear();
+    location->offset_index_location.clear();
+
+    /// Serialize column index ordered by row group ordinal and then column ordinal.
+    SerializeIndex(column_index_builders_, sink, &location->column_index_location);
+
+    /// Serialize offset index ordered by row group ordinal and then column ordinal.
+    SerializeIndex(offset_index_builders_, sink, &location->offset_index_location);
+  }
+
+ private:
+  /// Make sure column ordinal is not out of bound and the builder is in good state.
+  void CheckState(int32_t column_ordinal) const {
+    if (finished_) {
+      throw ParquetException("PageIndexBuilder is already finished.");
+    }
+    if (column_ordinal < 0 || column_ordinal >= schema_->num_columns()) {
+      throw ParquetException("Invalid column ordinal: ", column_ordinal);
+    }
+    if (offset_index_builders_.empty() || column_index_builders_.empty()) {
+      throw ParquetException("No row group appended to PageIndexBuilder.");
+    }
+  }
+
+  template <typename Builder>
+  void SerializeIndex(
+      const std::vector<std::vector<std::unique_ptr<Builder>>>& page_index_builders,
+      ::arrow::io::OutputStream* sink,
+      PageIndexLocation::FileIndexLocation* location) const {
+    const auto num_columns = static_cast<size_t>(schema_->num_columns());
+
+    /// Serialize the same kind of page index row group by row group.
+    for (size_t row_group = 0; row_group < page_index_builders.size(); ++row_group) {
+      const auto& row_group_page_index_builders = page_index_builders[row_group];
+      DCHECK_EQ(row_group_page_index_builders.size(), num_columns);
+
+      PageIndexLocation::RowGroupIndexLocation row_group_location(num_columns);
+      bool has_index = false;
+
+      /// In the same row group, serialize the same kind of page index column by column.
+      for (size_t column = 0; column < num_columns; ++column) {
+        const auto& column_page_index_builder = row_group_page_index_builders[column];
+        if (column_page_index_builder != nullptr) {
+          /// Try serializing the page index.
+          PARQUET_ASSIGN_OR_THROW(int64_t pos_before_write, sink->Tell());
+          const int64_t len = column_page_index_builder->WriteTo(sink);
+          if (len > 0) {
+            if (len > std::numeric_limits<int32_t>::max()) {
+              throw ParquetException("Page index size overflows to INT32_MAX");
+            }
+            row_group_location[column] = {pos_before_write, static_cast<int32_t>(len)};
+            has_index = true;
+          }
+        }
+      }
+
+      if (has_index) {
+        location->emplace(row_group, std::move(row_group_location));
+      }
+    }
+  }
+
+  const SchemaDescriptor* schema_;
+  std::vector<std::vector<std::unique_ptr<ColumnIndexBuilder>>> column_index_builders_;
+  std::vector<std::vector<std::unique_ptr<OffsetIndexBuilder>>> offset_index_builders_;
+  bool finished_ = false;
+};
+
 }  // namespace
 
 RowGroupIndexReadRange PageIndexReader::DeterminePageIndexRangesInRowGroup(
@@ -523,6 +835,135 @@ std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
   return std::make_unique<OffsetIndexImpl>(offset_index);
 }
 
+std::unique_ptr<ColumnIndexBuilder> ColumnIndexBuilder::Make(
+    const ColumnDescriptor* descr) {
+  switch (descr->physical_type()) {
+    case Type::BOOLEAN:
+      return std::make_unique<ColumnIndexBuilderImpl<BooleanType>>(descr);
+    case Type::INT32:
+      return std::make_unique<ColumnIndexBuilderImpl<Int32Type>>(descr);
+    case Type::INT64:
+      return std::make_unique<ColumnIndexBuilderImpl<Int64Type>>(descr);
+    case Type::INT96:
+      return std::make_unique<ColumnIndexBuilderImpl<Int96Type>>(descr);
+    case Type::FLOAT:
+      return std::make_unique<ColumnIndexBuilderImpl<FloatType>>(descr);
+    case Type::DOUBLE:
+      return std::make_unique<ColumnIndexBuilderImpl<DoubleType>>(descr);
+    case Type::BYTE_ARRAY:
+      return std::make_unique<ColumnIndexBuilderImpl<ByteArrayType>>(descr);
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return std::make_unique<ColumnIndexBuilderImpl<FLBAType>>(descr);
+    case Type::UNDEFINED:
+      return nullptr;
+  }
+  ::arrow::Unreachable("Cannot make ColumnIndexBuilder of an unknown type");
+  return nullptr;
+}
+
+std::unique_ptr<OffsetIndexBuilder> OffsetIndexBuilder::Make() {
+  return std::make_unique<OffsetIndexBuilderImpl>();
+}
+
+std::unique_ptr<PageIndexBuilder> PageIndexBuilder::Make(const SchemaDescriptor* schema) {
+  return std::make_unique<PageIndexBuilderImpl>(schema);
+}
+
+RowRanges::RowRanges(const std::vector<Range>& ranges) {
+  for (const auto& range : ranges) {
+    Add(range);
+  }
+}
+
+RowRanges RowRanges::All(int64_t num_rows) { return RowRanges({{0, num_rows}}); }
+
+std::vector<RowRanges::Range> RowRanges::PageRanges(const OffsetIndex& offset_index,
+                                                    int64_t num_rows) {
+  const auto& page_locations = offset_index.page_locations();
+  std::vector<Range> pages(page_locations.size());
+  for (size_t i = 0; i < page_locations.size(); ++i) {
+    const int64_t end = i + 1 < page_locations.size()
+                            ? page_locations[i + 1].first_row_index
+                            : num_rows;
+    pages[i] = {page_locations[i].first_row_index, end};
+    if (pages[i].start < 0 || pages[i].end < pages[i].start || end > num_rows) {
+      throw ParquetException("Invalid first row index in offset index");
+    }
+  }
+  return pages;
+}
+
+RowRanges RowRanges::Intersection(const RowRanges& left, const RowRanges& right) {
+  RowRanges result;
+  auto l = left.ranges_.begin();
+  auto r = right.ranges_.begin();
+  while (l != left.ranges_.end() && r != right.ranges_.end()) {
+    result.Add({std::max(l->start, r->start), std::min(l->end, r->end)});
+    // Advance whichever range ends first
+    if (l->end < r->end) {
+      ++l;
+    } else {
+      ++r;
+    }
+  }
+  return result;
+}
+
+RowRanges RowRanges::Union(const RowRanges& left, const RowRanges& right) {
+  std::vector<Range> ranges;
+  ranges.reserve(left.ranges_.size() + right.ranges_.size());
+  std::merge(left.ranges_.begin(), left.ranges_.end(), right.ranges_.begin(),
+             right.ranges_.end(), std::back_inserter(ranges),
+             [](const Range& a, const Range& b) { return a.start < b.start; });
+  return RowRanges(ranges);
+}
+
+void RowRanges::Add(Range range) {
+  if (range.end <= range.start) return;
+  if (ranges_.empty()) {
+    ranges_.push_back(range);
+    return;
+  }
+  Range& last = ranges_.back();
+  if (range.start < last.start) {
+    throw ParquetException("RowRanges must be added in order, got ", range.start,
+                           " after ", last.start);
+  }
+  if (range.start <= last.end) {
+    last.end = std::max(last.end, range.end);
+  } else {
+    ranges_.push_back(range);
+  }
+}
+
+bool RowRanges::Overlaps(const Range& range) const {
+  if (range.end <= range.start) return false;
+  // First selected range ending after the start of the queried range
+  auto it = std::upper_bound(
+      ranges_.begin(), ranges_.end(), range.start,
+      [](int64_t row, const Range& candidate) { return row < candidate.end; });
+  return it != ranges_.end() && it->start < range.end;
+}
+
+int64_t RowRanges::num_rows() const {
+  int64_t num_rows = 0;
+  for (const auto& range : ranges_) {
+    num_rows += range.length();
+  }
+  return num_rows;
+}
+
+std::string RowRanges::ToString() const {
+  std::stringstream ss;
+  ss << "[";
+  for (size_t i = 0; i < ranges_.size(); ++i) {
+    if (i > 0) ss << ", ";
+    ss << "[" << ranges_[i].start << ", " << ranges_[i].end << ")";
+  }
+  ss << "]";
+  return ss.str();
+}
+
 std::shared_ptr<PageIndexReader> PageIndexReader::Make(
     ::arrow::io::RandomAccessFile* input, std::shared_ptr<FileMetaData> file_metadata,
     const ReaderProperties& properties,
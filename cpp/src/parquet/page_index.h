@@ -21,16 +21,20 @@
 #include "parquet/types.h"
 
 #include <optional>
+#include <string>
 #include <vector>
 
 namespace parquet {
 
 class ColumnDescriptor;
+class EncodedStatistics;
 class FileMetaData;
 class InternalFileDecryptor;
+struct PageIndexLocation;
 class ReaderProperties;
 class RowGroupMetaData;
 class RowGroupPageIndexReader;
+class SchemaDescriptor;
 
 /// \brief ColumnIndex is a proxy around format::ColumnIndex.
 class PARQUET_EXPORT ColumnIndex {
@@ -250,4 +254,193 @@ class PARQUET_EXPORT PageIndexReader {
       const RowGroupMetaData& row_group_metadata, const std::vector<int32_t>& columns);
 };
 
+/// \brief Interface for collecting column index of data pages in a column chunk.
+class PARQUET_EXPORT ColumnIndexBuilder {
+ public:
+  /// \brief API convenience to create a ColumnIndexBuilder.
+  static std::unique_ptr<ColumnIndexBuilder> Make(const ColumnDescriptor* descr);
+
+  virtual ~ColumnIndexBuilder() = default;
+
+  /// \brief Add statistics of a data page.
+  ///
+  /// If the page has no usable min/max values (e.g. statistics are disabled or
+  /// exceed the size limit), the whole column index is discarded since it can no
+  /// longer describe every page of the column chunk.
+  ///
+  /// \param stats Page statistics in the encoded form.
+  virtual void AddPage(const EncodedStatistics& stats) = 0;
+
+  /// \brief Complete the column index.
+  ///
+  /// Once called, AddPage() can no longer be called.
+  /// The boundary order is determined here from the collected min/max values.
+  virtual void Finish() = 0;
+
+  /// \brief Serialize the column index thrift message.
+  ///
+  /// Nothing is written if the column index has been discarded or has no pages.
+  ///
+  /// \param[out] sink output stream to write the serialized message.
+  /// \returns the number of bytes written.
+  virtual int64_t WriteTo(::arrow::io::OutputStream* sink) const = 0;
+
+  /// \brief Create a ColumnIndex directly.
+  ///
+  /// \returns the ColumnIndex created or nullptr if the column index has been
+  /// discarded or is not finished yet.
+  virtual std::unique_ptr<ColumnIndex> Build() const = 0;
+};
+
+/// \brief Interface for collecting offset index of data pages in a column chunk.
+class PARQUET_EXPORT OffsetIndexBuilder {
+ public:
+  /// \brief API convenience to create an OffsetIndexBuilder.
+  static std::unique_ptr<OffsetIndexBuilder> Make();
+
+  virtual ~OffsetIndexBuilder() = default;
+
+  /// \brief Add the location of a data page.
+  ///
+  /// \param offset offset of the page header in the output stream of the pages.
+  /// \param compressed_page_size total compressed size of the page and its header.
+  /// \param first_row_index row ordinal of the first row of the page in the row group.
+  virtual void AddPage(int64_t offset, int32_t compressed_page_size,
+                       int64_t first_row_index) = 0;
+
+  /// \brief Add the location of a data page.
+  void AddPage(const PageLocation& page_location) {
+    AddPage(page_location.offset, page_location.compressed_page_size,
+            page_location.first_row_index);
+  }
+
+  /// \brief Complete the offset index.
+  ///
+  /// Pages of a buffered row group are first written to an in-memory stream, in
+  /// which case their offsets need to be shifted by the position where the column
+  /// chunk finally lands in the file.
+  ///
+  /// \param final_position position of the column chunk's output stream in the file.
+  virtual void Finish(int64_t final_position) = 0;
+
+  /// \brief Serialize the offset index thrift message.
+  ///
+  /// Nothing is written if no pages have been added.
+  ///
+  /// \param[out] sink output stream to write the serialized message.
+  /// \returns the number of bytes written.
+  virtual int64_t WriteTo(::arrow::io::OutputStream* sink) const = 0;
+
+  /// \brief Create an OffsetIndex directly.
+  ///
+  /// \returns the OffsetIndex created or nullptr if it has no pages or is not
+  /// finished yet.
+  virtual std::unique_ptr<OffsetIndex> Build() const = 0;
+};
+
+/// \brief Interface for collecting the page index of a Parquet file while it is
+/// written.
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  /// \brief API convenience to create a PageIndexBuilder.
+  static std::unique_ptr<PageIndexBuilder> Make(const SchemaDescriptor* schema);
+
+  virtual ~PageIndexBuilder() = default;
+
+  /// \brief Start a new row group.
+  virtual void AppendRowGroup() = 0;
+
+  /// \brief Get the ColumnIndexBuilder of a column chunk in the current row group.
+  ///
+  /// \param i column ordinal.
+  /// \returns the ColumnIndexBuilder, owned by this PageIndexBuilder.
+  virtual ColumnIndexBuilder* GetColumnIndexBuilder(int32_t i) = 0;
+
+  /// \brief Get the OffsetIndexBuilder of a column chunk in the current row group.
+  ///
+  /// \param i column ordinal.
+  /// \returns the OffsetIndexBuilder, owned by this PageIndexBuilder.
+  virtual OffsetIndexBuilder* GetOffsetIndexBuilder(int32_t i) = 0;
+
+  /// \brief Complete the page index builder; no more row groups can be appended.
+  virtual void Finish() = 0;
+
+  /// \brief Serialize the page index of all row groups.
+  ///
+  /// Column indexes of all column chunks are written first, followed by the offset
+  /// indexes, so that readers can fetch each kind in one contiguous range.
+  ///
+  /// \param[out] sink output stream to write the page index.
+  /// \param[out] location file locations of the serialized page index, to be
+  /// recorded in the column chunk metadata.
+  virtual void WriteTo(::arrow::io::OutputStream* sink,
+                       PageIndexLocation* location) const = 0;
+};
+
+/// \brief A selection of rows within a row group, stored as sorted, non-overlapping
+/// ranges of row ordinals.
+///
+/// RowRanges are usually derived by evaluating a predicate against the page index
+/// of a row group, and let readers skip the data pages holding no selected rows.
+class PARQUET_EXPORT RowRanges {
+ public:
+  /// \brief A contiguous range of rows [start, end).
+  struct Range {
+    int64_t start;
+    int64_t end;
+
+    int64_t length() const { return end - start; }
+
+    bool operator==(const Range& other) const {
+      return start == other.start && end == other.end;
+    }
+  };
+
+  RowRanges() = default;
+
+  /// \brief Create a selection from ranges sorted by start row. Adjacent or
+  /// overlapping ranges are merged and empty ranges are dropped.
+  explicit RowRanges(const std::vector<Range>& ranges);
+
+  /// \brief Select all the rows of a row group.
+  static RowRanges All(int64_t num_rows);
+
+  /// \brief Return the rows held by each data page of a column chunk.
+  ///
+  /// \param offset_index offset index of the column chunk.
+  /// \param num_rows number of rows in the row group.
+  static std::vector<Range> PageRanges(const OffsetIndex& offset_index,
+                                       int64_t num_rows);
+
+  /// \brief Return the rows selected by both selections.
+  static RowRanges Intersection(const RowRanges& left, const RowRanges& right);
+
+  /// \brief Return the rows selected by either selection.
+  static RowRanges Union(const RowRanges& left, const RowRanges& right);
+
+  /// \brief Add a range of rows which starts at or after the start of the last
+  /// range. It is merged with the last range when they overlap or are adjacent.
+  ///
+  /// \throws ParquetException if the range starts before the last range.
+  void Add(Range range);
+
+  /// \brief Whether any row in [range.start, range.end) is selected.
+  bool Overlaps(const Range& range) const;
+
+  /// \brief Total number of selected rows.
+  int64_t num_rows() const;
+
+  bool empty() const { return ranges_.empty(); }
+
+  const std::vector<Range>& ranges() const { return ranges_; }
+
+  bool operator==(const RowRanges& other) const { return ranges_ == other.ranges_; }
+  bool operator!=(const RowRanges& other) const { return !(*this == other); }
+
+  std::string ToString() const;
+
+ private:
+  std::vector<Range> ranges_;
+};
+
 }  // namespace parquet
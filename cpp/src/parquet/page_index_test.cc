@@ -20,8 +20,14 @@
 #include <gtest/gtest.h>
 
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/testing/gtest_util.h"
+#include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/metadata.h"
 #include "parquet/schema.h"
+#include "parquet/statistics.h"
 #include "parquet/test_util.h"
 #include "parquet/thrift_internal.h"
 
@@ -416,4 +422,298 @@ TEST(PageIndex, DeterminePageIndexRangesInRowGroupWithMissingPageIndex) {
                          -1);
 }
 
+namespace {
+
+std::string EncodeInt64(int64_t value) {
+  return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+EncodedStatistics Int64PageStats(int64_t min, int64_t max, int64_t null_count) {
+  EncodedStatistics stats;
+  stats.set_min(EncodeInt64(min)).set_max(EncodeInt64(max)).set_null_count(null_count);
+  return stats;
+}
+
+EncodedStatistics NullPageStats(int64_t null_count) {
+  EncodedStatistics stats;
+  stats.set_null_count(null_count);
+  stats.all_null_value = true;
+  return stats;
+}
+
+std::unique_ptr<ColumnIndex> RoundTripColumnIndex(const ColumnDescriptor& descr,
+                                                  const ColumnIndexBuilder& builder) {
+  auto sink = CreateOutputStream();
+  const int64_t length = builder.WriteTo(sink.get());
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  EXPECT_EQ(length, buffer->size());
+  return ColumnIndex::Make(descr, buffer->data(), static_cast<uint32_t>(buffer->size()),
+                           default_reader_properties());
+}
+
+}  // namespace
+
+TEST(PageIndex, WriteInt64ColumnIndex) {
+  schema::NodeVector fields = {schema::Int64("c1")};
+  SchemaDescriptor schema;
+  schema.Init(schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  const ColumnDescriptor* descr = schema.Column(0);
+
+  auto check = [&](const std::vector<EncodedStatistics>& page_stats,
+                   BoundaryOrder::type expected_order) {
+    auto builder = ColumnIndexBuilder::Make(descr);
+    for (const auto& stats : page_stats) {
+      builder->AddPage(stats);
+    }
+    builder->Finish();
+    ASSERT_THROW(builder->AddPage(page_stats[0]), ParquetException);
+
+    auto column_index = RoundTripColumnIndex(*descr, *builder);
+    ASSERT_NE(column_index, nullptr);
+    auto typed_index = dynamic_cast<Int64ColumnIndex*>(column_index.get());
+    ASSERT_NE(typed_index, nullptr);
+    ASSERT_EQ(column_index->null_pages().size(), page_stats.size());
+    ASSERT_TRUE(column_index->has_null_counts());
+    EXPECT_EQ(column_index->boundary_order(), expected_order);
+    for (size_t i = 0; i < page_stats.size(); ++i) {
+      EXPECT_EQ(column_index->null_pages()[i], page_stats[i].all_null_value);
+      EXPECT_EQ(column_index->null_counts()[i], page_stats[i].null_count);
+      if (!page_stats[i].all_null_value) {
+        EXPECT_EQ(column_index->encoded_min_values()[i], page_stats[i].min());
+        EXPECT_EQ(column_index->encoded_max_values()[i], page_stats[i].max());
+      }
+    }
+
+    // The directly built column index is identical
+    auto built_index = builder->Build();
+    ASSERT_NE(built_index, nullptr);
+    EXPECT_EQ(built_index->null_pages(), column_index->null_pages());
+    EXPECT_EQ(built_index->encoded_min_values(), column_index->encoded_min_values());
+    EXPECT_EQ(built_index->boundary_order(), column_index->boundary_order());
+  };
+
+  check({Int64PageStats(1, 2, 0), NullPageStats(10), Int64PageStats(2, 5, 3)},
+        BoundaryOrder::Ascending);
+  check({Int64PageStats(5, 9, 1), Int64PageStats(-3, 4, 0), Int64PageStats(-5, 4, 0)},
+        BoundaryOrder::Descending);
+  check({Int64PageStats(1, 2, 0), Int64PageStats(0, 5, 0)}, BoundaryOrder::Unordered);
+  check({NullPageStats(1), NullPageStats(2)}, BoundaryOrder::Unordered);
+}
+
+TEST(PageIndex, DiscardColumnIndex) {
+  schema::NodeVector fields = {schema::Int64("c1")};
+  SchemaDescriptor schema;
+  schema.Init(schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  // A non-null page without min/max values discards the column index
+  auto builder = ColumnIndexBuilder::Make(schema.Column(0));
+  builder->AddPage(Int64PageStats(1, 2, 0));
+  EncodedStatistics no_min_max;
+  no_min_max.set_null_count(0);
+  builder->AddPage(no_min_max);
+  builder->AddPage(Int64PageStats(3, 4, 0));
+  builder->Finish();
+  ASSERT_EQ(builder->Build(), nullptr);
+  auto sink = CreateOutputStream();
+  ASSERT_EQ(builder->WriteTo(sink.get()), 0);
+
+  // So does a column chunk without any page
+  builder = ColumnIndexBuilder::Make(schema.Column(0));
+  builder->Finish();
+  ASSERT_EQ(builder->Build(), nullptr);
+
+  // Missing null counts only drop the null counts
+  builder = ColumnIndexBuilder::Make(schema.Column(0));
+  builder->AddPage(Int64PageStats(1, 2, 0));
+  EncodedStatistics no_null_count;
+  no_null_count.set_min(EncodeInt64(3)).set_max(EncodeInt64(4));
+  builder->AddPage(no_null_count);
+  builder->Finish();
+  auto column_index = RoundTripColumnIndex(*schema.Column(0), *builder);
+  ASSERT_EQ(column_index->null_pages().size(), 2);
+  ASSERT_FALSE(column_index->has_null_counts());
+}
+
+TEST(PageIndex, WriteOffsetIndex) {
+  const std::vector<PageLocation> page_locations = {
+      {/*offset=*/4, /*compressed_page_size=*/100, /*first_row_index=*/0},
+      {/*offset=*/104, /*compressed_page_size=*/120, /*first_row_index=*/1000},
+      {/*offset=*/224, /*compressed_page_size=*/80, /*first_row_index=*/2500}};
+  const int64_t final_position = 4096;
+
+  auto builder = OffsetIndexBuilder::Make();
+  for (const auto& page_location : page_locations) {
+    builder->AddPage(page_location);
+  }
+  builder->Finish(final_position);
+
+  auto sink = CreateOutputStream();
+  const int64_t length = builder->WriteTo(sink.get());
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  ASSERT_EQ(length, buffer->size());
+  auto offset_index = OffsetIndex::Make(
+      buffer->data(), static_cast<uint32_t>(buffer->size()), default_reader_properties());
+
+  // Page offsets are shifted to the final position of the column chunk
+  ASSERT_EQ(offset_index->page_locations().size(), page_locations.size());
+  for (size_t i = 0; i < page_locations.size(); ++i) {
+    const auto& location = offset_index->page_locations()[i];
+    EXPECT_EQ(location.offset, page_locations[i].offset + final_position);
+    EXPECT_EQ(location.compressed_page_size, page_locations[i].compressed_page_size);
+    EXPECT_EQ(location.first_row_index, page_locations[i].first_row_index);
+  }
+
+  // No offset index is written without any page
+  builder = OffsetIndexBuilder::Make();
+  builder->Finish(final_position);
+  ASSERT_EQ(builder->Build(), nullptr);
+  ASSERT_EQ(builder->WriteTo(sink.get()), 0);
+}
+
+class TestWritePageIndex : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestWritePageIndex, RoundTrip) {
+  const bool buffered_row_group = GetParam();
+  constexpr int kNumRowGroups = 3;
+  constexpr int kRowsPerRowGroup = 1000;
+
+  schema::NodeVector fields = {schema::Int64("c1"), schema::Int64("c2")};
+  auto schema_node = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  // Small pages so that each column chunk spans several of them. The page index
+  // is only collected for c1.
+  auto properties = WriterProperties::Builder()
+                        .disable_dictionary()
+                        ->data_pagesize(512)
+                        ->write_batch_size(100)
+                        ->enable_write_page_index("c1")
+                        ->build();
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema_node, properties);
+  std::vector<int16_t> def_levels(kRowsPerRowGroup);
+  std::vector<int64_t> values;
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    values.clear();
+    for (int i = 0; i < kRowsPerRowGroup; ++i) {
+      // Ascending values with every 7th row null
+      def_levels[i] = i % 7 == 0 ? 0 : 1;
+      if (def_levels[i] == 1) {
+        values.push_back(rg * kRowsPerRowGroup + i);
+      }
+    }
+    auto rg_writer = buffered_row_group ? file_writer->AppendBufferedRowGroup()
+                                        : file_writer->AppendRowGroup();
+    for (int col = 0; col < 2; ++col) {
+      auto col_writer = static_cast<Int64Writer*>(
+          buffered_row_group ? rg_writer->column(col) : rg_writer->NextColumn());
+      col_writer->WriteBatch(kRowsPerRowGroup, def_levels.data(), nullptr,
+                             values.data());
+    }
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto metadata = reader->metadata();
+  auto page_index_reader = reader->GetPageIndexReader();
+  ASSERT_NE(page_index_reader, nullptr);
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    ARROW_SCOPED_TRACE("row group = ", rg);
+    auto rg_metadata = metadata->RowGroup(rg);
+    ASSERT_FALSE(rg_metadata->ColumnChunk(1)->GetColumnIndexLocation().has_value());
+    ASSERT_FALSE(rg_metadata->ColumnChunk(1)->GetOffsetIndexLocation().has_value());
+
+    auto rg_page_index_reader = page_index_reader->RowGroup(rg);
+    ASSERT_NE(rg_page_index_reader, nullptr);
+    auto column_index = rg_page_index_reader->GetColumnIndex(0);
+    auto offset_index = rg_page_index_reader->GetOffsetIndex(0);
+    ASSERT_NE(column_index, nullptr);
+    ASSERT_NE(offset_index, nullptr);
+    ASSERT_EQ(rg_page_index_reader->GetColumnIndex(1), nullptr);
+    ASSERT_EQ(rg_page_index_reader->GetOffsetIndex(1), nullptr);
+
+    const auto& page_locations = offset_index->page_locations();
+    ASSERT_GT(page_locations.size(), 1);
+    ASSERT_EQ(column_index->null_pages().size(), page_locations.size());
+    EXPECT_EQ(column_index->boundary_order(), BoundaryOrder::Ascending);
+    ASSERT_TRUE(column_index->has_null_counts());
+
+    // Pages are contiguous in the column chunk, starting at its first data page
+    auto col_metadata = rg_metadata->ColumnChunk(0);
+    EXPECT_EQ(page_locations[0].offset, col_metadata->data_page_offset());
+    EXPECT_EQ(page_locations[0].first_row_index, 0);
+    int64_t total_page_size = 0;
+    for (size_t i = 0; i < page_locations.size(); ++i) {
+      if (i > 0) {
+        const auto& prev = page_locations[i - 1];
+        EXPECT_EQ(page_locations[i].offset, prev.offset + prev.compressed_page_size);
+        EXPECT_GT(page_locations[i].first_row_index, prev.first_row_index);
+      }
+      total_page_size += page_locations[i].compressed_page_size;
+    }
+    EXPECT_EQ(total_page_size, col_metadata->total_compressed_size());
+
+    // Page statistics agree with the data
+    auto typed_index = std::dynamic_pointer_cast<Int64ColumnIndex>(column_index);
+    ASSERT_NE(typed_index, nullptr);
+    for (size_t i = 0; i < page_locations.size(); ++i) {
+      const int64_t first_row = page_locations[i].first_row_index;
+      const int64_t end_row = i + 1 < page_locations.size()
+                                  ? page_locations[i + 1].first_row_index
+                                  : kRowsPerRowGroup;
+      int64_t null_count = 0;
+      for (int64_t row = first_row; row < end_row; ++row) {
+        null_count += row % 7 == 0;
+      }
+      const int64_t first_valid = first_row % 7 == 0 ? first_row + 1 : first_row;
+      const int64_t last_valid = (end_row - 1) % 7 == 0 ? end_row - 2 : end_row - 1;
+      EXPECT_FALSE(column_index->null_pages()[i]);
+      EXPECT_EQ(column_index->null_counts()[i], null_count);
+      EXPECT_EQ(typed_index->min_values()[i], rg * kRowsPerRowGroup + first_valid);
+      EXPECT_EQ(typed_index->max_values()[i], rg * kRowsPerRowGroup + last_valid);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(PageIndex, TestWritePageIndex, ::testing::Bool());
+
+TEST(RowRanges, Basics) {
+  RowRanges ranges({{0, 10}, {10, 15}, {20, 20}, {30, 40}, {35, 45}});
+  ASSERT_EQ(ranges, RowRanges({{0, 15}, {30, 45}}));
+  ASSERT_EQ(ranges.num_rows(), 30);
+  ASSERT_EQ(ranges.ToString(), "[[0, 15), [30, 45)]");
+  ASSERT_TRUE(RowRanges().empty());
+  ASSERT_EQ(RowRanges::All(100), RowRanges({{0, 100}}));
+  ASSERT_THROW(ranges.Add({5, 10}), ParquetException);
+
+  ASSERT_TRUE(ranges.Overlaps({14, 20}));
+  ASSERT_FALSE(ranges.Overlaps({15, 30}));
+  ASSERT_TRUE(ranges.Overlaps({29, 31}));
+  ASSERT_FALSE(ranges.Overlaps({45, 50}));
+  ASSERT_FALSE(ranges.Overlaps({5, 5}));
+
+  RowRanges other({{5, 12}, {14, 32}, {44, 100}});
+  ASSERT_EQ(RowRanges::Intersection(ranges, other),
+            RowRanges({{5, 12}, {14, 15}, {30, 32}, {44, 45}}));
+  ASSERT_EQ(RowRanges::Intersection(ranges, RowRanges()), RowRanges());
+  ASSERT_EQ(RowRanges::Union(ranges, other), RowRanges({{0, 100}}));
+  ASSERT_EQ(RowRanges::Union(RowRanges({{0, 1}}), RowRanges({{5, 6}})),
+            RowRanges({{0, 1}, {5, 6}}));
+}
+
+TEST(RowRanges, PageRanges) {
+  auto builder = OffsetIndexBuilder::Make();
+  builder->AddPage(/*offset=*/100, /*compressed_page_size=*/10, /*first_row_index=*/0);
+  builder->AddPage(/*offset=*/110, /*compressed_page_size=*/10, /*first_row_index=*/40);
+  builder->AddPage(/*offset=*/120, /*compressed_page_size=*/10, /*first_row_index=*/70);
+  builder->Finish(/*final_position=*/0);
+  auto offset_index = builder->Build();
+
+  const std::vector<RowRanges::Range> expected = {{0, 40}, {40, 70}, {70, 100}};
+  ASSERT_EQ(RowRanges::PageRanges(*offset_index, /*num_rows=*/100), expected);
+  ASSERT_THROW(RowRanges::PageRanges(*offset_index, /*num_rows=*/50), ParquetException);
+}
+
 }  // namespace parquet
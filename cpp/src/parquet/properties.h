@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -116,6 +117,19 @@ class PARQUET_EXPORT ReaderProperties {
     page_checksum_verification_ = check_crc;
   }
 
+  /// \brief Return the number of pages decompressed ahead of the decoder.
+  ///
+  /// When greater than zero, the page reader of a compressed column chunk keeps
+  /// up to this many pages in flight, decompressing them on the CPU thread pool
+  /// while the previous pages are being decoded. Each page in flight holds its
+  /// own decompressed buffer, so memory usage grows with this setting.
+  /// The default of 0 decompresses each page in the decoding thread.
+  int32_t page_decompression_readahead() const { return page_decompression_readahead_; }
+  /// Set the number of pages decompressed ahead of the decoder.
+  void set_page_decompression_readahead(int32_t num_pages) {
+    page_decompression_readahead_ = num_pages;
+  }
+
  private:
   MemoryPool* pool_;
   int64_t buffer_size_ = kDefaultBufferSize;
@@ -123,6 +137,7 @@ class PARQUET_EXPORT ReaderProperties {
   int32_t thrift_container_size_limit_ = kDefaultThriftContainerSizeLimit;
   bool buffered_stream_enabled_ = false;
   bool page_checksum_verification_ = false;
+  int32_t page_decompression_readahead_ = 0;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
 };
 
@@ -135,10 +150,21 @@ static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
+static constexpr int32_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
 
+/// \brief Options used to size the bloom filter of a column chunk.
+struct PARQUET_EXPORT BloomFilterOptions {
+  /// Expected number of distinct values in a column chunk.
+  int32_t ndv = DEFAULT_BLOOM_FILTER_NDV;
+  /// Desired false positive probability, must be in the range (0, 1).
+  double fpp = DEFAULT_BLOOM_FILTER_FPP;
+};
+
 class PARQUET_EXPORT ColumnProperties {
  public:
   ColumnProperties(Encoding::type encoding = DEFAULT_ENCODING,
@@ -151,6 +177,7 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
+        page_index_enabled_(DEFAULT_IS_PAGE_INDEX_ENABLED),
         compression_level_(Codec::UseDefaultCompressionLevel()) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
@@ -173,6 +200,23 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_page_index_enabled(bool page_index_enabled) {
+    page_index_enabled_ = page_index_enabled;
+  }
+
+  void set_bloom_filter_options(std::optional<BloomFilterOptions> bloom_filter_options) {
+    if (bloom_filter_options) {
+      if (bloom_filter_options->fpp <= 0 || bloom_filter_options->fpp >= 1) {
+        throw ParquetException(
+            "Bloom filter false positive probability must be in (0, 1)");
+      }
+      if (bloom_filter_options->ndv <= 0) {
+        throw ParquetException("Bloom filter number of distinct values must be positive");
+      }
+    }
+    bloom_filter_options_ = bloom_filter_options;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -185,12 +229,20 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool page_index_enabled() const { return page_index_enabled_; }
+
+  const std::optional<BloomFilterOptions>& bloom_filter_options() const {
+    return bloom_filter_options_;
+  }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
   bool dictionary_enabled_;
   bool statistics_enabled_;
   size_t max_stats_size_;
+  bool page_index_enabled_;
+  std::optional<BloomFilterOptions> bloom_filter_options_;
   int compression_level_;
 };
 
@@ -469,6 +521,89 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Enable writing page index in general for all columns. Default disabled.
+    ///
+    /// Page index contains statistics for data pages and can be used to skip pages
+    /// when scanning data in ordered and unordered columns.
+    ///
+    /// Please check the link below for more details:
+    /// https://github.com/apache/parquet-format/blob/master/PageIndex.md
+    Builder* enable_write_page_index() {
+      default_column_properties_.set_page_index_enabled(true);
+      return this;
+    }
+
+    /// Disable writing page index in general for all columns. Default disabled.
+    Builder* disable_write_page_index() {
+      default_column_properties_.set_page_index_enabled(false);
+      return this;
+    }
+
+    /// Enable writing page index for column specified by `path`. Default disabled.
+    Builder* enable_write_page_index(const std::string& path) {
+      page_index_enabled_[path] = true;
+      return this;
+    }
+
+    /// Enable writing page index for column specified by `path`. Default disabled.
+    Builder* enable_write_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_write_page_index(path->ToDotString());
+    }
+
+    /// Disable writing page index for column specified by `path`. Default disabled.
+    Builder* disable_write_page_index(const std::string& path) {
+      page_index_enabled_[path] = false;
+      return this;
+    }
+
+    /// Disable writing page index for column specified by `path`. Default disabled.
+    Builder* disable_write_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_write_page_index(path->ToDotString());
+    }
+
+    /// Enable writing bloom filters in general for all columns. Default disabled.
+    ///
+    /// A bloom filter is built for each column chunk and written before the page
+    /// index. Readers can use it to skip row groups that cannot contain a value
+    /// tested for equality. BOOLEAN columns never get a bloom filter.
+    ///
+    /// Please check the link below for more details:
+    /// https://github.com/apache/parquet-format/blob/master/BloomFilter.md
+    Builder* enable_bloom_filter(const BloomFilterOptions& options = {}) {
+      default_column_properties_.set_bloom_filter_options(options);
+      return this;
+    }
+
+    /// Disable writing bloom filters in general for all columns. Default disabled.
+    Builder* disable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_options(std::nullopt);
+      return this;
+    }
+
+    /// Enable writing bloom filter for column specified by `path`. Default disabled.
+    Builder* enable_bloom_filter(const std::string& path,
+                                 const BloomFilterOptions& options = {}) {
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    /// Enable writing bloom filter for column specified by `path`. Default disabled.
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 const BloomFilterOptions& options = {}) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    /// Disable writing bloom filter for column specified by `path`. Default disabled.
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_options_[path] = std::nullopt;
+      return this;
+    }
+
+    /// Disable writing bloom filter for column specified by `path`. Default disabled.
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     /// Allow decimals with 1 <= precision <= 18 to be stored as integers.
     ///
     /// In Parquet, DECIMAL can be stored in any of the following physical types:
@@ -521,6 +656,10 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : page_index_enabled_)
+        get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : bloom_filter_options_)
+        get(item.first).set_bloom_filter_options(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
@@ -550,6 +689,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, std::optional<BloomFilterOptions>>
+        bloom_filter_options_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -621,6 +763,44 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  /// \brief Return whether page index is enabled for the column.
+  bool page_index_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).page_index_enabled();
+  }
+
+  /// \brief Return whether page index is enabled for any column.
+  bool page_index_enabled() const {
+    if (default_column_properties_.page_index_enabled()) {
+      return true;
+    }
+    for (const auto& item : column_properties_) {
+      if (item.second.page_index_enabled()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// \brief Return the bloom filter options of the column, or std::nullopt if
+  /// bloom filter is disabled for it.
+  const std::optional<BloomFilterOptions>& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
+  /// \brief Return whether bloom filter is enabled for any column.
+  bool bloom_filter_enabled() const {
+    if (default_column_properties_.bloom_filter_options()) {
+      return true;
+    }
+    for (const auto& item : column_properties_) {
+      if (item.second.bloom_filter_options()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -693,7 +873,8 @@ class PARQUET_EXPORT ArrowReaderProperties {
         batch_size_(kArrowDefaultBatchSize),
         pre_buffer_(false),
         cache_options_(::arrow::io::CacheOptions::Defaults()),
-        coerce_int96_timestamp_unit_(::arrow::TimeUnit::NANO) {}
+        coerce_int96_timestamp_unit_(::arrow::TimeUnit::NANO),
+        column_chunk_split_bytes_(0) {}
 
   /// \brief Set whether to use the IO thread pool to parse columns in parallel.
   ///
@@ -706,8 +887,10 @@ class PARQUET_EXPORT ArrowReaderProperties {
   ///
   /// If the file metadata contains a serialized Arrow schema, then ...
   ////
-  /// This is only supported for columns with a Parquet physical type of
-  /// BYTE_ARRAY, such as string or binary types.
+  /// This is supported for columns with a Parquet physical type of BYTE_ARRAY
+  /// (such as string or binary types), FIXED_LEN_BYTE_ARRAY, INT32, INT64,
+  /// FLOAT or DOUBLE, unless their logical type needs a conversion of the
+  /// values (such as decimals).
   void set_read_dictionary(int column_index, bool read_dict) {
     if (read_dict) {
       read_dict_indices_.insert(column_index);
@@ -761,6 +944,25 @@ class PARQUET_EXPORT ArrowReaderProperties {
     return coerce_int96_timestamp_unit_;
   }
 
+  /// \brief Set the size of the pieces column chunks are split into (default 0,
+  /// no splitting).
+  ///
+  /// When use_threads() is enabled and this is greater than zero, the
+  /// ReadTable and ReadRowGroups family of methods split the column chunks of
+  /// flat columns which have an offset index into ranges of whole pages holding
+  /// about this many compressed bytes, and decode the ranges in parallel. This
+  /// spreads the decoding of a row group with few large columns across the
+  /// thread pool.
+  ///
+  /// Each range reads the column chunk stream from its start, skipping the pages
+  /// before it, so this is meant for in-memory or memory-mapped files, or
+  /// together with set_pre_buffer().
+  void set_column_chunk_split_bytes(int64_t split_bytes) {
+    column_chunk_split_bytes_ = split_bytes;
+  }
+  /// Return the size of the pieces column chunks are split into.
+  int64_t column_chunk_split_bytes() const { return column_chunk_split_bytes_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
@@ -769,6 +971,7 @@ class PARQUET_EXPORT ArrowReaderProperties {
   ::arrow::io::IOContext io_context_;
   ::arrow::io::CacheOptions cache_options_;
   ::arrow::TimeUnit::type coerce_int96_timestamp_unit_;
+  int64_t column_chunk_split_bytes_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -869,6 +1072,10 @@ class PARQUET_EXPORT ArrowWriterProperties {
     /// \brief Set whether to use multiple threads to write columns
     /// in parallel in the buffered row group mode.
     ///
+    /// This also applies to FileWriter::WriteTable, which then encodes
+    /// each row group in memory as a buffered row group before writing
+    /// it out. The file written is the same as without threads.
+    ///
     /// WARNING: If writing multiple files in parallel in the same
     /// executor, deadlock may occur if use_threads is true. Please
     /// disable it in this case.
@@ -70,6 +70,31 @@ TEST(TestWriterProperties, AdvancedHandling) {
   ASSERT_EQ(ParquetDataPageVersion::V2, props->data_page_version());
 }
 
+TEST(TestWriterProperties, BloomFilter) {
+  std::shared_ptr<WriterProperties> props = WriterProperties::Builder().build();
+  ASSERT_FALSE(props->bloom_filter_enabled());
+  ASSERT_FALSE(props->bloom_filter_options(ColumnPath::FromDotString("a")).has_value());
+
+  BloomFilterOptions options;
+  options.ndv = 100;
+  options.fpp = 0.01;
+  props = WriterProperties::Builder()
+              .enable_bloom_filter(options)
+              ->disable_bloom_filter("b")
+              ->enable_bloom_filter("c")
+              ->build();
+  ASSERT_TRUE(props->bloom_filter_enabled());
+  const auto& a_options = props->bloom_filter_options(ColumnPath::FromDotString("a"));
+  ASSERT_TRUE(a_options.has_value());
+  ASSERT_EQ(100, a_options->ndv);
+  ASSERT_EQ(0.01, a_options->fpp);
+  ASSERT_FALSE(props->bloom_filter_options(ColumnPath::FromDotString("b")).has_value());
+  const auto& c_options = props->bloom_filter_options(ColumnPath::FromDotString("c"));
+  ASSERT_TRUE(c_options.has_value());
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_NDV, c_options->ndv);
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_FPP, c_options->fpp);
+}
+
 TEST(TestReaderProperties, GetStreamInsufficientData) {
   // ARROW-6058
   std::string data = "shorter than expected";